@@ -36,10 +36,12 @@ class OpioOpioConan(ConanFile):
     options = {
         "fPIC": [True, False],
         "asio": ["boost", "standalone"],
+        "io_uring": [True, False],
     }
     default_options = {
         "fPIC": True,
         "asio": "standalone",
+        "io_uring": False,
     }
 
     name = "opio"
@@ -105,6 +107,9 @@ class OpioOpioConan(ConanFile):
         self.requires("logr/0.8.0")
         self.requires("rapidjson/cci.20230929", override=True)
 
+        if self.options.get_safe("io_uring"):
+            self.requires("liburing/2.11")
+
     def configure(self):
         self.options["logr"].backend = "spdlog"
 
@@ -119,6 +124,9 @@ class OpioOpioConan(ConanFile):
         if self.settings.os == "Windows":
             self.options.rm_safe("fPIC")
 
+        if self.settings.os != "Linux":
+            self.options.rm_safe("io_uring")
+
     def validate(self):
         minimal_cpp_standard = "20"
         if self.settings.compiler.get_safe("cppstd"):
@@ -147,6 +155,9 @@ class OpioOpioConan(ConanFile):
         tc.variables[
             "OPIO_BUILD_TESTS"
         ] = not self._is_package_only()
+        tc.variables["OPIO_NET_ASIO_IO_URING"] = bool(
+            self.options.get_safe("io_uring", False)
+        )
 
         tc.generate()
 
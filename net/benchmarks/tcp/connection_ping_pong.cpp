@@ -0,0 +1,222 @@
+/**
+ * @file
+ *
+ * Ping-pong benchmark for raw connection_t.
+ *
+ * Runs a number of client/server connection pairs over loopback
+ * on a single io_context. Server side echoes everything it receives,
+ * client side sends next message once the previous one comes back.
+ *
+ * The benchmark itself is backend agnostic: to compare epoll reactor
+ * with io_uring build the tree twice (with and without
+ * `-DOPIO_NET_ASIO_IO_URING=ON`) and run both binaries with the same params.
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+
+#include <fmt/format.h>
+
+#include <logr/null_backend.hpp>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/tcp/connection.hpp>
+
+namespace asio_ns = opio::net::asio_ns;
+
+struct traits_t : public opio::net::tcp::default_traits_st_t
+{
+    using logger_t = logr::null_logger_t<>;
+    using input_handler_t =
+        std::function< void( opio::net::tcp::input_ctx_t< traits_t > & ) >;
+};
+
+using connection_t = opio::net::tcp::connection_t< traits_t >;
+using input_ctx_t  = opio::net::tcp::input_ctx_t< traits_t >;
+
+//
+// bench_params_t
+//
+
+struct bench_params_t
+{
+    std::size_t connections{ 16 };
+    std::size_t message_size{ 64 };
+    std::size_t messages_in_flight{ 1 };
+    std::uint32_t duration_sec{ 5 };
+};
+
+//
+// client_state_t
+//
+
+/**
+ * @brief Client side counters.
+ */
+struct client_state_t
+{
+    std::size_t pending_bytes{};
+    std::uint64_t round_trips{};
+    bool running{ true };
+};
+
+//
+// make_connected_pair()
+//
+
+/**
+ * @brief Connects two sockets over loopback.
+ */
+std::pair< asio_ns::ip::tcp::socket, asio_ns::ip::tcp::socket >
+make_connected_pair( asio_ns::io_context & ioctx,
+                     asio_ns::ip::tcp::acceptor & acceptor )
+{
+    asio_ns::ip::tcp::socket client{ ioctx };
+    asio_ns::ip::tcp::socket server{ ioctx };
+
+    client.connect( acceptor.local_endpoint() );
+    acceptor.accept( server );
+
+    client.set_option( asio_ns::ip::tcp::no_delay{ true } );
+    server.set_option( asio_ns::ip::tcp::no_delay{ true } );
+
+    return { std::move( client ), std::move( server ) };
+}
+
+int main( int argc, char * argv[] )
+{
+    try
+    {
+        bench_params_t params;
+
+        CLI::App app{ "_benchmark.opio.net.tcp.connection_ping_pong" };
+
+        app.add_option(
+               "--connections,-c", params.connections, "number of connections" )
+            ->required( false );
+        app.add_option(
+               "--message-size,-s", params.message_size, "message size in bytes" )
+            ->required( false );
+        app.add_option( "--in-flight,-f",
+                        params.messages_in_flight,
+                        "messages in flight per connection" )
+            ->required( false );
+        app.add_option(
+               "--duration,-d", params.duration_sec, "duration in seconds" )
+            ->required( false );
+
+        CLI11_PARSE( app, argc, argv );
+
+        asio_ns::io_context ioctx( 1 );
+        asio_ns::ip::tcp::acceptor acceptor{
+            ioctx,
+            asio_ns::ip::tcp::endpoint{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                        0 }
+        };
+
+        std::vector< connection_t::sptr_t > connections;
+        std::vector< std::shared_ptr< client_state_t > > clients;
+
+        for( std::size_t i = 0; i < params.connections; ++i )
+        {
+            auto [ client_socket, server_socket ] =
+                make_connected_pair( ioctx, acceptor );
+
+            auto server = connection_t::make(
+                std::move( server_socket ), [ & ]( auto & p ) {
+                    p.connection_id( 2 * i ).input_handler(
+                        []( input_ctx_t & ctx ) {
+                            ctx.connection().schedule_send(
+                                std::move( ctx.buf() ) );
+                        } );
+                } );
+
+            auto state = std::make_shared< client_state_t >();
+            auto client = connection_t::make(
+                std::move( client_socket ), [ & ]( auto & p ) {
+                    p.connection_id( 2 * i + 1 )
+                        .input_handler( [ state,
+                                          message_size = params.message_size ](
+                                            input_ctx_t & ctx ) {
+                            state->pending_bytes += ctx.buf().size();
+                            const auto n = state->pending_bytes / message_size;
+                            state->pending_bytes %= message_size;
+                            state->round_trips += n;
+
+                            if( state->running )
+                            {
+                                for( std::size_t k = 0; k < n; ++k )
+                                {
+                                    ctx.connection().schedule_send(
+                                        opio::net::simple_buffer_t{
+                                            message_size, std::byte{ 'x' } } );
+                                }
+                            }
+                        } );
+                } );
+
+            server->start_reading();
+            client->start_reading();
+
+            connections.push_back( std::move( server ) );
+            connections.push_back( client );
+            clients.push_back( std::move( state ) );
+
+            for( std::size_t k = 0; k < params.messages_in_flight; ++k )
+            {
+                client->schedule_send( opio::net::simple_buffer_t{
+                    params.message_size, std::byte{ 'x' } } );
+            }
+        }
+
+        asio_ns::steady_timer timer{ ioctx };
+        timer.expires_after( std::chrono::seconds( params.duration_sec ) );
+        timer.async_wait( [ & ]( const auto & ) {
+            for( auto & c : clients )
+            {
+                c->running = false;
+            }
+            for( auto & c : connections )
+            {
+                c->shutdown();
+            }
+        } );
+
+        const auto started_at = std::chrono::steady_clock::now();
+        ioctx.run();
+        const auto elapsed = std::chrono::duration< double >(
+                                 std::chrono::steady_clock::now() - started_at )
+                                 .count();
+
+        std::uint64_t round_trips = 0;
+        for( const auto & c : clients )
+        {
+            round_trips += c->round_trips;
+        }
+
+        const auto rps = static_cast< double >( round_trips ) / elapsed;
+
+        std::cout << fmt::format(
+            "backend: {}; connections: {}; message size: {}; in flight: {}\n"
+            "round trips: {} ({:.0f} per sec, {:.2f} MB/s one way)\n",
+            opio::net::io_backend_name(),
+            params.connections,
+            params.message_size,
+            params.messages_in_flight,
+            round_trips,
+            rps,
+            rps * static_cast< double >( params.message_size )
+                / ( 1024.0 * 1024.0 ) );
+    }
+    catch( const std::exception & ex )
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file
+ *
+ * Cross-thread send contention benchmark for connection_t.
+ *
+ * A number of producer threads send messages through a single connection
+ * while asio runs on its own thread. Compares the ways to send
+ * from a foreign thread:
+ *
+ * - `mutex`: `aggressive_dispatch_send()` on a connection
+ *   with `mutex_locking_t`;
+ * - `post`: `post_send()` (an asio handler per send);
+ * - `submit`: `submit_send()` (lock-free submission queue).
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+
+#include <fmt/format.h>
+
+#include <logr/null_backend.hpp>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/tcp/connection.hpp>
+
+namespace asio_ns = opio::net::asio_ns;
+
+struct traits_t : public opio::net::tcp::default_traits_st_t
+{
+    using logger_t = logr::null_logger_t<>;
+    using input_handler_t =
+        std::function< void( opio::net::tcp::input_ctx_t< traits_t > & ) >;
+    using locking_t = opio::net::noop_locking_t;
+};
+
+struct mutex_traits_t : public opio::net::tcp::default_traits_st_t
+{
+    using logger_t = logr::null_logger_t<>;
+    using input_handler_t =
+        std::function< void( opio::net::tcp::input_ctx_t< mutex_traits_t > & ) >;
+    using locking_t = opio::net::mutex_locking_t;
+};
+
+//
+// bench_params_t
+//
+
+struct bench_params_t
+{
+    std::string mode{ "submit" };
+    std::size_t producers{ 4 };
+    std::size_t messages_per_producer{ 100000 };
+    std::size_t message_size{ 64 };
+};
+
+//
+// make_connected_pair()
+//
+
+/**
+ * @brief Connects two sockets over loopback.
+ */
+std::pair< asio_ns::ip::tcp::socket, asio_ns::ip::tcp::socket >
+make_connected_pair( asio_ns::io_context & ioctx,
+                     asio_ns::ip::tcp::acceptor & acceptor )
+{
+    asio_ns::ip::tcp::socket client{ ioctx };
+    asio_ns::ip::tcp::socket server{ ioctx };
+
+    client.connect( acceptor.local_endpoint() );
+    acceptor.accept( server );
+
+    client.set_option( asio_ns::ip::tcp::no_delay{ true } );
+    server.set_option( asio_ns::ip::tcp::no_delay{ true } );
+
+    return { std::move( client ), std::move( server ) };
+}
+
+//
+// run_bench()
+//
+
+/**
+ * @brief Run producers sending through a client connection.
+ *
+ * @return Seconds elapsed from starting producers till the moment
+ *         server side received all the data.
+ */
+template < typename Traits, typename Send >
+double run_bench( const bench_params_t & params, Send send )
+{
+    using client_connection_t = opio::net::tcp::connection_t< Traits >;
+    using server_connection_t = opio::net::tcp::connection_t< traits_t >;
+
+    asio_ns::io_context ioctx( 1 );
+    asio_ns::ip::tcp::acceptor acceptor{
+        ioctx,
+        asio_ns::ip::tcp::endpoint{ asio_ns::ip::make_address( "127.0.0.1" ), 0 }
+    };
+
+    auto [ client_socket, server_socket ] = make_connected_pair( ioctx, acceptor );
+
+    const std::size_t total_size =
+        params.producers * params.messages_per_producer * params.message_size;
+
+    std::size_t received = 0;
+    std::promise< void > all_received;
+
+    auto server = server_connection_t::make(
+        std::move( server_socket ), [ & ]( auto & p ) {
+            p.connection_id( 0 ).input_handler(
+                [ & ]( opio::net::tcp::input_ctx_t< traits_t > & ctx ) {
+                    received += ctx.buf().size();
+                    if( received == total_size )
+                    {
+                        all_received.set_value();
+                    }
+                } );
+        } );
+
+    auto client = client_connection_t::make(
+        std::move( client_socket ), [ & ]( auto & p ) {
+            p.connection_id( 1 ).input_handler(
+                []( [[maybe_unused]] auto & ctx ) {} );
+        } );
+
+    server->start_reading();
+    client->start_reading();
+
+    auto work_guard = asio_ns::make_work_guard( ioctx );
+    std::thread io_thread{ [ & ] { ioctx.run(); } };
+
+    const auto started_at = std::chrono::steady_clock::now();
+
+    std::vector< std::thread > producers;
+    for( std::size_t i = 0; i < params.producers; ++i )
+    {
+        producers.emplace_back( [ &, c = client.get() ] {
+            for( std::size_t k = 0; k < params.messages_per_producer; ++k )
+            {
+                send( *c,
+                      opio::net::simple_buffer_t{ params.message_size,
+                                                  std::byte{ 'x' } } );
+            }
+        } );
+    }
+
+    for( auto & t : producers )
+    {
+        t.join();
+    }
+
+    all_received.get_future().wait();
+
+    const auto elapsed = std::chrono::duration< double >(
+                             std::chrono::steady_clock::now() - started_at )
+                             .count();
+
+    asio_ns::post( ioctx, [ & ] {
+        client->shutdown();
+        server->shutdown();
+    } );
+    work_guard.reset();
+    io_thread.join();
+
+    return elapsed;
+}
+
+int main( int argc, char * argv[] )
+{
+    try
+    {
+        bench_params_t params;
+
+        CLI::App app{ "_benchmark.opio.net.tcp.connection_send_contention" };
+
+        app.add_option( "--mode,-m", params.mode, "send mode" )
+            ->check( CLI::IsMember( { "mutex", "post", "submit" } ) )
+            ->required( false );
+        app.add_option(
+               "--producers,-p", params.producers, "number of producer threads" )
+            ->required( false );
+        app.add_option( "--messages,-n",
+                        params.messages_per_producer,
+                        "messages per producer" )
+            ->required( false );
+        app.add_option(
+               "--message-size,-s", params.message_size, "message size in bytes" )
+            ->required( false );
+
+        CLI11_PARSE( app, argc, argv );
+
+        double elapsed = 0.0;
+        if( "mutex" == params.mode )
+        {
+            elapsed =
+                run_bench< mutex_traits_t >( params, []( auto & c, auto buf ) {
+                    c.aggressive_dispatch_send( std::move( buf ) );
+                } );
+        }
+        else if( "post" == params.mode )
+        {
+            elapsed = run_bench< traits_t >( params, []( auto & c, auto buf ) {
+                c.post_send( std::move( buf ) );
+            } );
+        }
+        else
+        {
+            elapsed = run_bench< traits_t >( params, []( auto & c, auto buf ) {
+                c.submit_send( std::move( buf ) );
+            } );
+        }
+
+        const auto messages = params.producers * params.messages_per_producer;
+        const auto mps      = static_cast< double >( messages ) / elapsed;
+
+        std::cout << fmt::format(
+            "mode: {}; producers: {}; messages per producer: {}; "
+            "message size: {}\n"
+            "elapsed: {:.3f} sec ({:.0f} msg per sec, {:.2f} MB/s)\n",
+            params.mode,
+            params.producers,
+            params.messages_per_producer,
+            params.message_size,
+            elapsed,
+            mps,
+            mps * static_cast< double >( params.message_size )
+                / ( 1024.0 * 1024.0 ) );
+    }
+    catch( const std::exception & ex )
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 
 #if !defined( OPIO_USE_BOOST_ASIO )
 #    include <asio.hpp>
@@ -79,6 +80,10 @@ using error_category_base_t = asio_ns::error_category;
 #        error "ASIO version macro not defined"
 #    endif
 
+#    if defined( ASIO_HAS_IO_URING ) && defined( ASIO_DISABLE_EPOLL )
+#        define OPIO_NET_ASIO_IO_URING_BACKEND
+#    endif
+
 // =============================================================================
 #else  // => #if !defined( OPIO_USE_BOOST_ASIO )
 // =============================================================================
@@ -87,6 +92,7 @@ namespace asio_ns
 {
 using namespace ::boost::asio;
 using error_code = ::boost::system::error_code;
+using system_error = ::boost::system::system_error;
 }  // namespace asio_ns
 
 //! @name Adoptation functions to cover differences between snad-alone and beast
@@ -138,10 +144,44 @@ using error_category_base_t = ::boost::system::error_category;
 #        error "ASIO version macro not defined"
 #    endif
 
+#    if defined( BOOST_ASIO_HAS_IO_URING ) && defined( BOOST_ASIO_DISABLE_EPOLL )
+#        define OPIO_NET_ASIO_IO_URING_BACKEND
+#    endif
+
 // =============================================================================
 #endif
 // =============================================================================
 
+#if defined( OPIO_NET_ASIO_IO_URING ) && !defined( OPIO_NET_ASIO_IO_URING_BACKEND )
+#    error "OPIO_NET_ASIO_IO_URING is set, but asio is not configured to use io_uring"
+#endif
+
+//
+// io_backend_name()
+//
+
+/**
+ * @brief The name of the backend asio runs socket operations on.
+ *
+ * When the library is built with `OPIO_NET_ASIO_IO_URING` cmake option
+ * asio is configured to submit all socket operations (including
+ * `async_read_some()`/`async_write()` issued by `tcp::connection_t`)
+ * to io_uring instead of running them through epoll reactor.
+ * Nothing changes for the code built on top of `opio::net`,
+ * so this function is the way to tell one build from another
+ * (e.g. in logs or benchmark reports).
+ */
+[[nodiscard]] constexpr std::string_view io_backend_name() noexcept
+{
+#if defined( OPIO_NET_ASIO_IO_URING_BACKEND )
+    return "io_uring";
+#elif defined( OPIO_NET_ASIO_WINDOWS )
+    return "iocp";
+#else
+    return "reactor";
+#endif
+}
+
 //
 // ec_fmt_integrator_t
 //
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <thread>
 
 #include <opio/log.hpp>
@@ -13,6 +16,170 @@
 namespace opio::net
 {
 
+//
+// event_loop_cfg_t
+//
+
+/**
+ * @brief Parameters of running io_context on a thread.
+ */
+struct event_loop_cfg_t
+{
+    //! Poll the context in a loop instead of blocking on waiting for events.
+    //! Gives the lowest latency, but burns a CPU core even when idle.
+    bool busy_wait{ false };
+
+    //! If not zero (and `busy_wait` is off) the loop keeps polling
+    //! the context for a given time after the last event and only then
+    //! blocks on waiting for the next one (spin-then-park).
+    //! So bursts are handled with almost busy-wait latency
+    //! while an idle thread doesn't consume CPU.
+    std::chrono::microseconds spin_window{};
+};
+
+//
+// event_loop_stats_t
+//
+
+/**
+ * @brief Counters of spin-then-park event loop.
+ *
+ * Updated by the thread running the loop, can be read from any thread.
+ */
+struct event_loop_stats_t
+{
+    //! The number of handlers executed while spinning.
+    std::atomic< std::uint64_t > spin_hits{ 0 };
+
+    //! The number of times the loop blocked on waiting for events.
+    std::atomic< std::uint64_t > parks{ 0 };
+};
+
+namespace details
+{
+
+//
+// run_spin_then_park()
+//
+
+/**
+ * @brief Run io_context polling it for spin window after each event
+ *        and blocking on waiting for the next event when the window expires.
+ */
+inline void run_spin_then_park( net::asio_ns::io_context & ioctx,
+                                std::chrono::microseconds spin_window,
+                                event_loop_stats_t & stats )
+{
+    using clock_t = std::chrono::steady_clock;
+
+    auto last_event_at = clock_t::now();
+    while( !ioctx.stopped() )
+    {
+        if( const auto n = ioctx.poll(); 0 != n )
+        {
+            stats.spin_hits.fetch_add( n, std::memory_order_relaxed );
+            last_event_at = clock_t::now();
+            continue;
+        }
+
+        if( clock_t::now() - last_event_at < spin_window ) [[likely]]
+        {
+            continue;
+        }
+
+        stats.parks.fetch_add( 1, std::memory_order_relaxed );
+        // Blocks until a handler is executed or the context is stopped.
+        ioctx.run_one();
+        last_event_at = clock_t::now();
+    }
+}
+
+//
+// run_io_context()
+//
+
+/**
+ * @brief Run io_context on the current thread until it is stopped.
+ *
+ * Once the context is stopped it is given a chance to finish
+ * pending handlers gracefully.
+ *
+ * @param ioctx   Context to run.
+ * @param cfg     Parameters of the event loop.
+ * @param stats   Counters of spin-then-park loop.
+ * @param logger  Logger.
+ */
+template < typename Logger >
+void run_io_context( net::asio_ns::io_context & ioctx,
+                     const event_loop_cfg_t & cfg,
+                     event_loop_stats_t & stats,
+                     Logger & logger )
+{
+    try
+    {
+        net::asio_ns::executor_work_guard< net::asio_ns::any_io_executor >
+            ioctx_guard{ ioctx.get_executor() };
+
+        if( cfg.busy_wait )
+        {
+            logger.info( OPIO_SRC_LOCATION,
+                         "start running io context (busy wait)" );
+            while( !ioctx.stopped() )
+            {
+                ioctx.poll();
+                ioctx.poll();
+                ioctx.poll();
+                ioctx.poll();
+
+                ioctx.poll();
+                ioctx.poll();
+                ioctx.poll();
+                ioctx.poll();
+            }
+        }
+        else if( 0 != cfg.spin_window.count() )
+        {
+            logger.info( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "start running io context (spin-then-park, "
+                           "spin window {}us)",
+                           cfg.spin_window.count() );
+            } );
+            run_spin_then_park( ioctx, cfg.spin_window, stats );
+        }
+        else
+        {
+            logger.info( OPIO_SRC_LOCATION, "start running io context" );
+            ioctx.run();
+        }
+
+        logger.info( OPIO_SRC_LOCATION, "finish running io context" );
+        ioctx_guard.reset();
+
+        constexpr int gracefull_finish_timeout = 10;
+        logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "io context's main event loop was stopped, "
+                       "will apply gracefull_finish_timeout of {} sec",
+                       gracefull_finish_timeout );
+        } );
+
+        // Let the iocontext finish gracefully:
+        ioctx.restart();
+        ioctx.run_for( std::chrono::seconds( gracefull_finish_timeout ) );
+
+        logger.trace( OPIO_SRC_LOCATION, "io context stopped completely" );
+    }
+    catch( const std::exception & ex )
+    {
+        logger.critical( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out, "Error running asio io context: {}", ex.what() );
+        } );
+    }
+}
+
+}  // namespace details
+
 //
 // asio_thread_t
 //
@@ -20,7 +187,7 @@ namespace opio::net
 /**
  * @brief a wrapper class to run ASIO io_context object on a separate thread.
  *
- * @todo: Add thread pinning.
+ * @see asio_thread_pool_t for running several contexts on pinned threads.
  *
  * @pre This class is intended to be used from a single (or externally
  * synchronized) context. Which effectively means calling it's member function is
@@ -32,13 +199,18 @@ class asio_thread_t
 public:
     inline static constexpr int concurrency_hint_1 = 1;
 
-    asio_thread_t( bool busy_wait, Logger logger )
+    asio_thread_t( event_loop_cfg_t cfg, Logger logger )
         : m_ioctx{ concurrency_hint_1 }
-        , m_busy_wait{ busy_wait }
+        , m_cfg{ cfg }
         , m_logger{ std::move( logger ) }
     {
     }
 
+    asio_thread_t( bool busy_wait, Logger logger )
+        : asio_thread_t{ event_loop_cfg_t{ busy_wait, {} }, std::move( logger ) }
+    {
+    }
+
     ~asio_thread_t()
     {
         if( m_thread )
@@ -50,6 +222,14 @@ public:
 
     [[nodiscard]] net::asio_ns::io_context & ioctx() noexcept { return m_ioctx; }
 
+    /**
+     * @brief Counters of spin-then-park event loop.
+     */
+    [[nodiscard]] const event_loop_stats_t & stats() const noexcept
+    {
+        return m_stats;
+    }
+
     /**
      * @brief Start running asio io_context in a separate thread.
      *
@@ -60,63 +240,7 @@ public:
         if( !m_thread )
         {
             m_thread = std::make_unique< std::thread >( [ this ] {
-                try
-                {
-                    net::asio_ns::executor_work_guard<
-                        net::asio_ns::any_io_executor >
-                        ioctx_guard{ m_ioctx.get_executor() };
-
-                    if( m_busy_wait )
-                    {
-                        m_logger.info( OPIO_SRC_LOCATION,
-                                       "start running io context (busy wait)" );
-                        while( !m_ioctx.stopped() )
-                        {
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-                            m_ioctx.poll();
-                        }
-                    }
-                    else
-                    {
-                        m_logger.info( OPIO_SRC_LOCATION,
-                                       "start running io context" );
-                        m_ioctx.run();
-                    }
-
-                    m_logger.info( OPIO_SRC_LOCATION,
-                                   "finish running io context" );
-                    ioctx_guard.reset();
-
-                    constexpr int gracefull_finish_timeout = 10;
-                    m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
-                        format_to( out,
-                                   "io context's main event loop was stopped, "
-                                   "will apply gracefull_finish_timeout of {} sec",
-                                   gracefull_finish_timeout );
-                    } );
-
-                    // Let the iocontext finish gracefully:
-                    m_ioctx.restart();
-                    m_ioctx.run_for(
-                        std::chrono::seconds( gracefull_finish_timeout ) );
-
-                    m_logger.trace( OPIO_SRC_LOCATION,
-                                    "io context stopped completely" );
-                }
-                catch( const std::exception & ex )
-                {
-                    m_logger.critical( OPIO_SRC_LOCATION, [ & ]( auto out ) {
-                        format_to(
-                            out, "Error running asio io context: {}", ex.what() );
-                    } );
-                }
+                details::run_io_context( m_ioctx, m_cfg, m_stats, m_logger );
             } );
         }
         else
@@ -165,7 +289,8 @@ public:
 
 private:
     net::asio_ns::io_context m_ioctx;
-    const bool m_busy_wait;
+    const event_loop_cfg_t m_cfg;
+    event_loop_stats_t m_stats;
     [[no_unique_address]] Logger m_logger;
 
     std::unique_ptr< std::thread > m_thread;
@@ -0,0 +1,562 @@
+/**
+ * @file
+ *
+ * This header file contains a pool of threads each running
+ * its own io_context (a shard-per-core model).
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined( __linux__ )
+#    include <pthread.h>
+#    include <sched.h>
+#endif  // defined( __linux__ )
+
+#include <opio/log.hpp>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/asio_thread.hpp>
+
+namespace opio::net
+{
+
+//
+// io_context_picker
+//
+
+/**
+ * @brief A strategy to pick an io_context for a new piece of work.
+ */
+enum class io_context_picker
+{
+    //! Contexts are picked one after another.
+    round_robin,
+    //! A context with the least load is picked
+    //! (see asio_thread_pool_t::add_load()).
+    least_loaded
+};
+
+//
+// asio_thread_pool_cfg_t
+//
+
+/**
+ * @brief Parameters of asio_thread_pool_t.
+ */
+struct asio_thread_pool_cfg_t
+{
+    //! The number of threads (and io_contexts).
+    std::size_t threads_count{ 1 };
+
+    //! CPUs to pin threads to: i-th thread is pinned to `cpus[i % size]`.
+    //! No pinning if empty (unless `numa_node` is set).
+    //! A CPU must be in `[0, CPU_SETSIZE)`.
+    std::vector< int > cpus;
+
+    //! If set and `cpus` are empty, threads are pinned to CPUs
+    //! of a given NUMA node (one after another).
+    std::optional< int > numa_node;
+
+    //! Threads are named `<prefix><index>`
+    //! (truncated to 15 chars, as the OS requires).
+    std::string thread_name_prefix{ "opio_io" };
+
+    //! If set, threads run with SCHED_FIFO policy and a given priority.
+    std::optional< int > sched_fifo_priority;
+
+    //! Poll io_contexts in a loop instead of blocking on waiting for events.
+    bool busy_wait{ false };
+
+    //! Spin-then-park window (see event_loop_cfg_t::spin_window).
+    std::chrono::microseconds spin_window{};
+
+    //! A strategy of `asio_thread_pool_t::pick_ioctx()`.
+    io_context_picker picker{ io_context_picker::round_robin };
+};
+
+namespace details
+{
+
+//
+// parse_cpu_list()
+//
+
+/**
+ * @brief Parse a list of CPUs in Linux format (e.g. `0-3,8,10-11`).
+ *
+ * @return A list of CPUs or an empty list if the input is malformed.
+ */
+[[nodiscard]] inline std::vector< int > parse_cpu_list( std::string_view s )
+{
+    std::vector< int > res;
+
+    const auto parse_int = [ & ]( int & value ) {
+        const auto r = std::from_chars( s.data(), s.data() + s.size(), value );
+        if( r.ec != std::errc{} )
+        {
+            return false;
+        }
+        s.remove_prefix( static_cast< std::size_t >( r.ptr - s.data() ) );
+        return true;
+    };
+
+    while( !s.empty() && ( s.back() == '\n' || s.back() == ' ' ) )
+    {
+        s.remove_suffix( 1 );
+    }
+
+    while( !s.empty() )
+    {
+        int first{};
+        if( !parse_int( first ) )
+        {
+            return {};
+        }
+
+        int last = first;
+        if( !s.empty() && s.front() == '-' )
+        {
+            s.remove_prefix( 1 );
+            if( !parse_int( last ) || last < first )
+            {
+                return {};
+            }
+        }
+
+        for( int cpu = first; cpu <= last; ++cpu )
+        {
+            res.push_back( cpu );
+        }
+
+        if( !s.empty() )
+        {
+            if( s.front() != ',' )
+            {
+                return {};
+            }
+            s.remove_prefix( 1 );
+        }
+    }
+
+    return res;
+}
+
+//
+// numa_node_cpus()
+//
+
+/**
+ * @brief Get CPUs of a given NUMA node.
+ *
+ * @return A list of CPUs or an empty list if the information
+ *         is not available.
+ */
+[[nodiscard]] inline std::vector< int > numa_node_cpus( int node )
+{
+    std::ifstream f{ "/sys/devices/system/node/node" + std::to_string( node )
+                     + "/cpulist" };
+    std::string line;
+    if( !f || !std::getline( f, line ) )
+    {
+        return {};
+    }
+
+    return parse_cpu_list( line );
+}
+
+//
+// is_valid_cpu()
+//
+
+/**
+ * @brief Check if a given CPU number can be used for thread affinity.
+ */
+[[nodiscard]] constexpr bool is_valid_cpu( int cpu ) noexcept
+{
+#if defined( __linux__ )
+    return 0 <= cpu && cpu < CPU_SETSIZE;
+#else
+    return 0 <= cpu;
+#endif  // defined( __linux__ )
+}
+
+//
+// setup_current_thread()
+//
+
+/**
+ * @brief Apply name, CPU affinity and scheduling policy to current thread.
+ *
+ * Failures are not fatal: they are logged and the thread keeps running
+ * with default settings.
+ */
+template < typename Logger >
+void setup_current_thread( const std::string & name,
+                           std::optional< int > cpu,
+                           std::optional< int > sched_fifo_priority,
+                           Logger & logger )
+{
+#if defined( __linux__ )
+    constexpr std::size_t max_thread_name_length = 15;
+    const auto short_name = name.substr( 0, max_thread_name_length );
+    if( const int rc =
+            ::pthread_setname_np( ::pthread_self(), short_name.c_str() );
+        0 != rc )
+    {
+        logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out, "failed to set thread name '{}': {}", name, rc );
+        } );
+    }
+
+    if( cpu )
+    {
+        assert( is_valid_cpu( *cpu ) );
+
+        cpu_set_t cpuset;
+        CPU_ZERO( &cpuset );
+        CPU_SET( *cpu, &cpuset );
+        if( const int rc = ::pthread_setaffinity_np(
+                ::pthread_self(), sizeof( cpuset ), &cpuset );
+            0 != rc )
+        {
+            logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out, "failed to pin thread to cpu {}: {}", *cpu, rc );
+            } );
+        }
+    }
+
+    if( sched_fifo_priority )
+    {
+        sched_param param{};
+        param.sched_priority = *sched_fifo_priority;
+        if( const int rc =
+                ::pthread_setschedparam( ::pthread_self(), SCHED_FIFO, &param );
+            0 != rc )
+        {
+            logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "failed to set SCHED_FIFO priority {}: {}",
+                           *sched_fifo_priority,
+                           rc );
+            } );
+        }
+    }
+#else
+    if( cpu || sched_fifo_priority )
+    {
+        logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "thread {}: cpu affinity and scheduling policy are "
+                       "supported only on linux",
+                       name );
+        } );
+    }
+#endif  // defined( __linux__ )
+}
+
+}  // namespace details
+
+//
+// asio_thread_pool_t
+//
+
+/**
+ * @brief A pool of threads each running its own io_context.
+ *
+ * Unlike running a single io_context on several threads,
+ * each thread here runs its own context (created with concurrency hint 1),
+ * so objects bound to a context never need a real strand and
+ * there is no contention on a shared queue of handlers.
+ * New work (e.g. accepted connections) is distributed between contexts
+ * with `pick_ioctx()`.
+ *
+ * @pre Start/stop/join are intended to be used from a single (or externally
+ * synchronized) context. Picking contexts and load accounting are thread safe.
+ *
+ * @note The logger is shared by all threads of the pool,
+ *       so it must be thread safe.
+ */
+template < typename Logger >
+class asio_thread_pool_t
+{
+public:
+    inline static constexpr int concurrency_hint_1 = 1;
+
+    asio_thread_pool_t( asio_thread_pool_cfg_t cfg, Logger logger )
+        : m_cfg{ std::move( cfg ) }
+        , m_logger{ std::move( logger ) }
+    {
+        if( 0 == m_cfg.threads_count )
+        {
+            throw std::runtime_error{ "asio_thread_pool_t: zero threads count" };
+        }
+
+        if( m_cfg.cpus.empty() && m_cfg.numa_node )
+        {
+            m_cfg.cpus = details::numa_node_cpus( *m_cfg.numa_node );
+            if( m_cfg.cpus.empty() )
+            {
+                m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                    format_to( out,
+                               "no cpus found for numa node {}, "
+                               "threads will not be pinned",
+                               *m_cfg.numa_node );
+                } );
+            }
+        }
+
+        for( const auto cpu : m_cfg.cpus )
+        {
+            if( !details::is_valid_cpu( cpu ) )
+            {
+                throw std::runtime_error{ "asio_thread_pool_t: invalid cpu "
+                                          + std::to_string( cpu ) };
+            }
+        }
+
+        m_shards.reserve( m_cfg.threads_count );
+        for( std::size_t i = 0; i < m_cfg.threads_count; ++i )
+        {
+            m_shards.push_back( std::make_unique< shard_t >() );
+        }
+    }
+
+    ~asio_thread_pool_t()
+    {
+        stop();
+        join();
+    }
+
+    asio_thread_pool_t( const asio_thread_pool_t & ) = delete;
+    asio_thread_pool_t( asio_thread_pool_t && )      = delete;
+    asio_thread_pool_t & operator=( const asio_thread_pool_t & ) = delete;
+    asio_thread_pool_t & operator=( asio_thread_pool_t && ) = delete;
+
+    [[nodiscard]] const asio_thread_pool_cfg_t & cfg() const noexcept
+    {
+        return m_cfg;
+    }
+
+    /**
+     * @brief The number of io_contexts (and threads).
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_shards.size(); }
+
+    /**
+     * @brief Get io_context by index.
+     */
+    [[nodiscard]] net::asio_ns::io_context & ioctx( std::size_t i ) noexcept
+    {
+        return m_shards[ i ]->ioctx;
+    }
+
+    /**
+     * @brief Pick an index of io_context with the strategy set in cfg.
+     */
+    [[nodiscard]] std::size_t pick_index() noexcept
+    {
+        const auto start =
+            m_next_index.fetch_add( 1, std::memory_order_relaxed ) % size();
+
+        if( io_context_picker::round_robin == m_cfg.picker )
+        {
+            return start;
+        }
+
+        // Start scanning from the next round-robin position
+        // so ties are spread between contexts.
+        std::size_t best      = start;
+        std::size_t best_load = load( start );
+        for( std::size_t k = 1; k < size() && 0 != best_load; ++k )
+        {
+            const auto i = ( start + k ) % size();
+            const auto l = load( i );
+            if( l < best_load )
+            {
+                best      = i;
+                best_load = l;
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Pick an io_context with the strategy set in cfg.
+     */
+    [[nodiscard]] net::asio_ns::io_context & pick_ioctx() noexcept
+    {
+        return ioctx( pick_index() );
+    }
+
+    /**
+     * @brief Pick an executor of io_context with the strategy set in cfg.
+     *
+     * Can be used as acceptor_options_cfg_t::socket_executor_picker
+     * to spread accepted sockets between contexts.
+     */
+    [[nodiscard]] net::asio_ns::any_io_executor pick_executor() noexcept
+    {
+        return pick_ioctx().get_executor();
+    }
+
+    /**
+     * @brief Get an index of io_context a given executor refers to.
+     *
+     * Handy for load accounting of objects created on picked executors
+     * (e.g. `add_load( *index_of( socket.get_executor() ), 1 )`).
+     * Executors wrapping a context's executor (e.g. strands)
+     * refer to the same context.
+     *
+     * @return An index or nullopt if executor doesn't belong to this pool.
+     */
+    [[nodiscard]] std::optional< std::size_t > index_of(
+        const net::asio_ns::any_io_executor & ex ) const noexcept
+    {
+        if( !ex )
+        {
+            return std::nullopt;
+        }
+
+        const auto * ctx =
+            &net::asio_ns::query( ex, net::asio_ns::execution::context );
+        for( std::size_t i = 0; i < m_shards.size(); ++i )
+        {
+            if( ctx == &m_shards[ i ]->ioctx )
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @name Load accounting for io_context_picker::least_loaded.
+     *
+     * The meaning of the load is up to the user,
+     * e.g. the number of connections running on a context:
+     * `add_load(i, 1)` when connection is created
+     * and `add_load(i, -1)` when it is closed.
+     * Or the number of bytes queued for sending on a context.
+     */
+    ///@{
+    void add_load( std::size_t i, std::ptrdiff_t delta ) noexcept
+    {
+        m_shards[ i ]->load.fetch_add( static_cast< std::size_t >( delta ),
+                                       std::memory_order_relaxed );
+    }
+
+    [[nodiscard]] std::size_t load( std::size_t i ) const noexcept
+    {
+        return m_shards[ i ]->load.load( std::memory_order_relaxed );
+    }
+    ///@}
+
+    /**
+     * @brief Counters of spin-then-park event loop of a given context.
+     */
+    [[nodiscard]] const event_loop_stats_t & stats( std::size_t i ) const noexcept
+    {
+        return m_shards[ i ]->stats;
+    }
+
+    /**
+     * @brief Start running io_contexts, each on its own thread.
+     */
+    void start()
+    {
+        if( m_shards.front()->thread )
+        {
+            m_logger.error( OPIO_SRC_LOCATION,
+                            "Duplicate call to asio_thread_pool_t::start()" );
+            return;
+        }
+
+        for( std::size_t i = 0; i < size(); ++i )
+        {
+            std::optional< int > cpu;
+            if( !m_cfg.cpus.empty() )
+            {
+                cpu = m_cfg.cpus[ i % m_cfg.cpus.size() ];
+            }
+
+            m_shards[ i ]->thread =
+                std::make_unique< std::thread >( [ this, i, cpu ] {
+                    details::setup_current_thread(
+                        m_cfg.thread_name_prefix + std::to_string( i ),
+                        cpu,
+                        m_cfg.sched_fifo_priority,
+                        m_logger );
+
+                    details::run_io_context(
+                        m_shards[ i ]->ioctx,
+                        event_loop_cfg_t{ m_cfg.busy_wait, m_cfg.spin_window },
+                        m_shards[ i ]->stats,
+                        m_logger );
+                } );
+        }
+    }
+
+    /**
+     * @brief Stop running io_contexts.
+     */
+    void stop()
+    {
+        for( auto & shard : m_shards )
+        {
+            shard->ioctx.stop();
+        }
+    }
+
+    /**
+     * @brief Wait for all threads to finish.
+     */
+    void join()
+    {
+        for( auto & shard : m_shards )
+        {
+            if( shard->thread )
+            {
+                shard->thread->join();
+                shard->thread.reset();
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief A context with its thread.
+     */
+    struct shard_t
+    {
+        net::asio_ns::io_context ioctx{ concurrency_hint_1 };
+        std::unique_ptr< std::thread > thread;
+        event_loop_stats_t stats;
+
+        //! Load of the context, padded to keep contexts' counters
+        //! from sharing a cache line.
+        alignas( 64 ) std::atomic< std::size_t > load{ 0 };
+    };
+
+    asio_thread_pool_cfg_t m_cfg;
+    [[no_unique_address]] Logger m_logger;
+
+    std::vector< std::unique_ptr< shard_t > > m_shards;
+
+    std::atomic< std::size_t > m_next_index{ 0 };
+};
+
+}  // namespace opio::net
@@ -234,9 +234,17 @@ public:
 
     [[nodiscard]] asio_ns::mutable_buffer make_asio_mutable_buffer() override
     {
-        return asio_ns::mutable_buffer{
-            static_cast< void * >( m_custom_buffer.data() ), m_custom_buffer.size()
-        };
+        if constexpr( is_mutable_datasizeable_v< Datasizeable > )
+        {
+            return asio_ns::mutable_buffer{
+                static_cast< void * >( m_custom_buffer.data() ),
+                m_custom_buffer.size()
+            };
+        }
+        else
+        {
+            throw_exception( "constant buffer cannot act as a write to buffer" );
+        }
     }
 
     [[nodiscard]] std::size_t get_size() const override
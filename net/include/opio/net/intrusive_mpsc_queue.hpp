@@ -0,0 +1,114 @@
+/**
+ * @file
+ *
+ * This header file contains a lock-free intrusive
+ * multiple-producers-single-consumer queue.
+ */
+
+#pragma once
+
+#include <atomic>
+
+namespace opio::net
+{
+
+//
+// intrusive_mpsc_queue_t
+//
+
+/**
+ * @brief Lock-free intrusive multiple-producers-single-consumer queue.
+ *
+ * Producers push nodes with a single CAS on queue's head and
+ * the consumer takes all the accumulated nodes at once
+ * with a single exchange (so it is a batch-only consumer).
+ * Internally nodes are linked as a stack and the consumer
+ * reverses the grabbed list to restore the order in which
+ * nodes were pushed.
+ *
+ * The queue doesn't own nodes: whoever pops a node is responsible for it.
+ *
+ * @tparam Node  Type of node. Must have `Node * next` data member.
+ */
+template < typename Node >
+class intrusive_mpsc_queue_t
+{
+public:
+    intrusive_mpsc_queue_t() = default;
+
+    intrusive_mpsc_queue_t( const intrusive_mpsc_queue_t & ) = delete;
+    intrusive_mpsc_queue_t( intrusive_mpsc_queue_t && )      = delete;
+    intrusive_mpsc_queue_t & operator=( const intrusive_mpsc_queue_t & ) = delete;
+    intrusive_mpsc_queue_t & operator=( intrusive_mpsc_queue_t && ) = delete;
+
+    /**
+     * @brief Push a node to the queue.
+     *
+     * Can be called from any thread.
+     *
+     * @return True if the queue was empty before the push.
+     *         That allows the producer to decide whether it must
+     *         notify the consumer: only the first producer in a batch
+     *         needs to do it.
+     */
+    bool push( Node * node ) noexcept
+    {
+        Node * head = m_head.load( std::memory_order_relaxed );
+        do
+        {
+            node->next = head;
+        } while( !m_head.compare_exchange_weak(
+            head, node, std::memory_order_release, std::memory_order_relaxed ) );
+
+        return nullptr == head;
+    }
+
+    /**
+     * @brief Take all the nodes from the queue.
+     *
+     * Must be called from a single (consumer) thread at a time.
+     *
+     * @return A list of nodes linked with `next` in the order
+     *         they were pushed (nullptr if queue is empty).
+     */
+    [[nodiscard]] Node * pop_all() noexcept
+    {
+        if( nullptr == m_head.load( std::memory_order_relaxed ) )
+        {
+            return nullptr;
+        }
+
+        Node * head = m_head.exchange( nullptr, std::memory_order_acquire );
+
+        Node * fifo = nullptr;
+        while( nullptr != head )
+        {
+            Node * next = head->next;
+            head->next  = fifo;
+            fifo        = head;
+            head        = next;
+        }
+
+        return fifo;
+    }
+
+    /**
+     * @brief Check if queue is empty.
+     *
+     * @note The result is only a hint if producers are running.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return nullptr == m_head.load( std::memory_order_relaxed );
+    }
+
+private:
+    /**
+     * @brief The last pushed node.
+     *
+     * Sits on its own cache line as it is a contention point for producers.
+     */
+    alignas( 64 ) std::atomic< Node * > m_head{ nullptr };
+};
+
+}  // namespace opio::net
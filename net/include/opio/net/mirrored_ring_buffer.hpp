@@ -0,0 +1,809 @@
+/**
+ * @file
+ *
+ * This header file contains an input buffer backed by a mirror-mapped
+ * ring of virtual memory and a buffer driver using it.
+ *
+ * The ring memory (a memfd) is mapped twice, one mapping right after
+ * the other, so any range of ring bytes no longer than ring capacity
+ * is contiguous in virtual memory regardless of where it wraps.
+ * Reads go straight into the ring's free space and the data read
+ * by consecutive reads can be glued into a single contiguous buffer
+ * (see mirrored_ring_buffer_t::try_merge()), so the consumer
+ * never has to copy data to get a package that straddles reads.
+ *
+ * @note Linux only (relies on `memfd_create()`).
+ */
+
+#pragma once
+
+#if defined( __linux__ )
+
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    if defined( MFD_CLOEXEC )
+#        define OPIO_NET_HAS_MIRRORED_RING_BUFFER
+#    endif
+
+#endif  // defined( __linux__ )
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+#    include <algorithm>
+#    include <cassert>
+#    include <cerrno>
+#    include <cstdint>
+#    include <cstring>
+#    include <memory>
+#    include <mutex>
+#    include <new>
+#    include <span>
+#    include <string_view>
+#    include <system_error>
+#    include <type_traits>
+#    include <utility>
+#    include <vector>
+
+#    include <opio/net/asio_include.hpp>
+#    include <opio/net/buffer.hpp>
+
+namespace opio::net
+{
+
+namespace details
+{
+
+//
+// mirrored_ring_t
+//
+
+/**
+ * @brief A ring of bytes mapped twice into adjacent virtual memory regions.
+ *
+ * Positions in the ring are logical (ever-growing) offsets,
+ * a byte at offset `x` is located at `base + x % capacity`.
+ *
+ * A single writer reserves the free space right after committed data,
+ * reads data into it and commits what was read.
+ * Committed ranges are released by their owners (possibly on
+ * other threads and not in the order they were committed),
+ * the space becomes free once all the ranges before it are released.
+ */
+class mirrored_ring_t
+{
+public:
+    /**
+     * @brief Create a ring.
+     *
+     * @param capacity  Capacity of the ring, is rounded up to page size.
+     *
+     * @throw std::system_error if memory mapping fails.
+     */
+    explicit mirrored_ring_t( std::size_t capacity )
+        : m_capacity{ round_up_to_page_size( capacity ) }
+    {
+        const int fd = ::memfd_create( "opio_net_ring", MFD_CLOEXEC );
+        if( -1 == fd ) [[unlikely]]
+        {
+            throw std::system_error{
+                errno, std::system_category(), "memfd_create() failed" };
+        }
+
+        // Mappings keep the memory, so fd is not needed after all.
+        const int err = map_mirrors( fd );
+        ::close( fd );
+
+        if( 0 != err ) [[unlikely]]
+        {
+            throw std::system_error{
+                err, std::system_category(), "mapping ring memory failed" };
+        }
+    }
+
+    mirrored_ring_t( const mirrored_ring_t & ) = delete;
+    mirrored_ring_t & operator=( const mirrored_ring_t & ) = delete;
+
+    ~mirrored_ring_t() { ::munmap( m_base, 2 * m_capacity ); }
+
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+    /**
+     * @brief Get the address of a byte at a given offset.
+     *
+     * The next `capacity()` bytes after it are contiguous.
+     */
+    [[nodiscard]] std::byte * at( std::uint64_t offset ) const noexcept
+    {
+        return m_base + offset % m_capacity;
+    }
+
+    /**
+     * @brief Reserve free space right after committed data.
+     *
+     * The lock is held only to update the bookkeeping: data is read
+     * into the reserved space without it (the space belongs to the writer
+     * until commit() or cancel_reservation()), so releases from other
+     * threads don't wait for a read.
+     *
+     * @param n       Desired size.
+     * @param offset  Receives the offset of the reserved space.
+     *
+     * @return The size of reserved space which is `min(n, free space)`,
+     *         zero if nothing can be reserved
+     *         (no free space or there is a reservation already).
+     */
+    [[nodiscard]] std::size_t reserve( std::size_t n,
+                                       std::uint64_t & offset ) noexcept
+    {
+        std::lock_guard lock{ m_lock };
+        if( m_is_reserved ) [[unlikely]]
+        {
+            return 0;
+        }
+
+        const auto size = std::min( n, m_capacity - ( m_tail - m_head ) );
+        if( 0 != size )
+        {
+            m_is_reserved = true;
+            offset        = m_tail;
+        }
+        return size;
+    }
+
+    /**
+     * @brief Commit the first n bytes of reserved space.
+     *
+     * The rest of reservation is dropped.
+     */
+    void commit( std::size_t n ) noexcept
+    {
+        std::lock_guard lock{ m_lock };
+        assert( m_is_reserved );
+        assert( m_capacity - ( m_tail - m_head ) >= n );
+
+        m_tail += n;
+        m_is_reserved = false;
+    }
+
+    /**
+     * @brief Drop the reservation.
+     */
+    void cancel_reservation() noexcept
+    {
+        std::lock_guard lock{ m_lock };
+        m_is_reserved = false;
+    }
+
+    /**
+     * @brief Release a range of committed data.
+     */
+    void release( std::uint64_t offset, std::size_t n ) noexcept
+    {
+        if( 0 == n )
+        {
+            return;
+        }
+
+        std::lock_guard lock{ m_lock };
+        assert( m_head <= offset && offset + n <= m_tail );
+
+        if( offset != m_head ) [[unlikely]]
+        {
+            // Wait for the preceding ranges.
+            keep_released_range( offset, n );
+            return;
+        }
+
+        m_head += n;
+
+        // Absorb the ranges that were released earlier.
+        for( auto it = m_released_ranges.begin(); it != m_released_ranges.end(); )
+        {
+            if( it->first == m_head )
+            {
+                m_head += it->second;
+                m_released_ranges.erase( it );
+                it = m_released_ranges.begin();
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * @brief The size of committed data which is not released yet.
+     */
+    [[nodiscard]] std::size_t used_size() noexcept
+    {
+        std::lock_guard lock{ m_lock };
+        return m_tail - m_head;
+    }
+
+private:
+    /**
+     * @brief Keep a range released out of order until the head reaches it.
+     *
+     * A range adjacent to an already kept one extends it.
+     * There are just a few buffers alive at a time, so preallocated
+     * memory is usually enough. Otherwise the storage grows, as a lost
+     * range would never let the head pass it (and the ring is lost).
+     */
+    void keep_released_range( std::uint64_t offset, std::size_t n ) noexcept
+    {
+        for( auto & r : m_released_ranges )
+        {
+            if( r.first + r.second == offset )
+            {
+                r.second += n;
+                return;
+            }
+            if( offset + n == r.first )
+            {
+                r.first = offset;
+                r.second += n;
+                return;
+            }
+        }
+
+        try
+        {
+            m_released_ranges.emplace_back( offset, n );
+        }
+        catch( const std::bad_alloc & )
+        {
+            assert( false && "mirrored ring range is lost" );
+        }
+    }
+
+    [[nodiscard]] static std::size_t round_up_to_page_size(
+        std::size_t n ) noexcept
+    {
+        const auto page_size =
+            static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+        return std::max< std::size_t >( 1, ( n + page_size - 1 ) / page_size )
+               * page_size;
+    }
+
+    /**
+     * @brief Map the memory of a given file twice into adjacent regions.
+     *
+     * @return 0 on success, errno value otherwise.
+     */
+    [[nodiscard]] int map_mirrors( int fd ) noexcept
+    {
+        if( -1 == ::ftruncate( fd, static_cast< off_t >( m_capacity ) ) )
+        {
+            return errno;
+        }
+
+        // Reserve the whole region first, so mirrors are adjacent.
+        void * region = ::mmap( nullptr,
+                                2 * m_capacity,
+                                PROT_NONE,
+                                MAP_PRIVATE | MAP_ANONYMOUS,
+                                -1,
+                                0 );
+        if( MAP_FAILED == region )
+        {
+            return errno;
+        }
+        m_base = static_cast< std::byte * >( region );
+
+        for( auto * half : { m_base, m_base + m_capacity } )
+        {
+            if( MAP_FAILED
+                == ::mmap( half,
+                           m_capacity,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_FIXED,
+                           fd,
+                           0 ) )
+            {
+                const int err = errno;
+                ::munmap( m_base, 2 * m_capacity );
+                return err;
+            }
+        }
+
+        return 0;
+    }
+
+    const std::size_t m_capacity;
+    std::byte * m_base{ nullptr };
+
+    std::mutex m_lock;
+
+    //! The beginning of committed data (is moved on release).
+    std::uint64_t m_head{};
+
+    //! The end of committed data (is moved on commit).
+    std::uint64_t m_tail{};
+
+    bool m_is_reserved{ false };
+
+    //! Ranges released out of order.
+    std::vector< std::pair< std::uint64_t, std::size_t > > m_released_ranges =
+        [] {
+            std::vector< std::pair< std::uint64_t, std::size_t > > v;
+            v.reserve( 64 );
+            return v;
+        }();
+};
+
+}  // namespace details
+
+//
+// mirrored_ring_buffer_t
+//
+
+/**
+ * @brief A byte buffer referring a range of a mirror-mapped ring.
+ *
+ * A buffer is either a reservation of ring free space (a buffer
+ * to read into, see mirrored_ring_input_buffer_driver_t::allocate_input())
+ * or a range of committed data which is released back to the ring
+ * when the buffer is destroyed.
+ *
+ * When a buffer has to grow beyond the range it owns (see `resize()`)
+ * it gets detached from the ring and carries a heap copy of its data.
+ */
+class mirrored_ring_buffer_t
+{
+public:
+    using size_type  = std::size_t;
+    using value_type = std::byte;
+
+    using ring_sptr_t = std::shared_ptr< details::mirrored_ring_t >;
+
+    mirrored_ring_buffer_t() = default;
+
+    /**
+     * @brief Creates a buffer that has a given size (detached from any ring).
+     *
+     * @note the data is not initialized.
+     */
+    explicit mirrored_ring_buffer_t( size_type n )
+        : m_size{ n }
+        , m_detached{ n }
+    {
+    }
+
+    /**
+     * @brief Creates a buffer referring reserved space of a ring.
+     *
+     * @pre The space of a given size at a given offset
+     *      is reserved in the ring.
+     */
+    mirrored_ring_buffer_t( ring_sptr_t ring,
+                            std::uint64_t offset,
+                            size_type n ) noexcept
+        : m_ring{ std::move( ring ) }
+        , m_offset{ offset }
+        , m_size{ n }
+        , m_range_size{ n }
+        , m_is_reserved{ true }
+    {
+    }
+
+    mirrored_ring_buffer_t( const mirrored_ring_buffer_t & ) = delete;
+    mirrored_ring_buffer_t & operator=( const mirrored_ring_buffer_t & ) = delete;
+
+    mirrored_ring_buffer_t( mirrored_ring_buffer_t && b ) noexcept
+        : m_ring{ std::move( b.m_ring ) }
+        , m_offset{ b.m_offset }
+        , m_size{ std::exchange( b.m_size, 0 ) }
+        , m_range_size{ std::exchange( b.m_range_size, 0 ) }
+        , m_is_reserved{ std::exchange( b.m_is_reserved, false ) }
+        , m_detached{ std::move( b.m_detached ) }
+    {
+    }
+
+    mirrored_ring_buffer_t & operator=( mirrored_ring_buffer_t && b ) noexcept
+    {
+        if( this != &b )
+        {
+            release();
+            m_ring        = std::move( b.m_ring );
+            m_offset      = b.m_offset;
+            m_size        = std::exchange( b.m_size, 0 );
+            m_range_size  = std::exchange( b.m_range_size, 0 );
+            m_is_reserved = std::exchange( b.m_is_reserved, false );
+            m_detached    = std::move( b.m_detached );
+        }
+        return *this;
+    }
+
+    ~mirrored_ring_buffer_t() { release(); }
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_ring ? m_range_size : m_detached.capacity();
+    }
+    [[nodiscard]] const value_type * data() const noexcept
+    {
+        return m_ring ? m_ring->at( m_offset ) : m_detached.data();
+    }
+    [[nodiscard]] value_type * data() noexcept
+    {
+        return m_ring ? m_ring->at( m_offset ) : m_detached.data();
+    }
+
+    [[nodiscard]] const value_type * offset_data( size_type n ) const noexcept
+    {
+        return data() + n;
+    }
+    [[nodiscard]] value_type * offset_data( size_type n ) noexcept
+    {
+        return data() + n;
+    }
+
+    /**
+     * @brief Is the buffer a part of a ring.
+     */
+    [[nodiscard]] bool is_in_ring() const noexcept
+    {
+        return static_cast< bool >( m_ring );
+    }
+
+    [[nodiscard]] std::string_view make_string_view() const noexcept
+    {
+        return { reinterpret_cast< const char * >( data() ), size() };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< const Char_Type > make_const_span() const noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< const Char_Type >{
+            reinterpret_cast< const Char_Type * >( data() ), size()
+        };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::const_buffer make_asio_const_buffer() const noexcept
+    {
+        return { data(), size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::mutable_buffer make_asio_mutable_buffer() noexcept
+    {
+        return { static_cast< void * >( data() ), size() };
+    }
+
+    /**
+     * @brief Commit the first n bytes of reserved ring space as data.
+     *
+     * Does nothing for a buffer that is not a reservation
+     * besides shrinking its size.
+     *
+     * @pre `size() >= n`
+     */
+    void commit( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        if( m_is_reserved )
+        {
+            m_ring->commit( n );
+            m_is_reserved = false;
+            m_range_size  = n;
+        }
+        m_size = n;
+    }
+
+    /**
+     * @brief Make a buffer represent less data.
+     *
+     * @note Capacity remains the same.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void shrink_size( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        m_size = n;
+    }
+
+    /**
+     * @brief Resize the buffer preserving the data curently stored in.
+     *
+     * If a buffer has to grow beyond its range of the ring
+     * it is detached from the ring.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void resize( size_type n )
+    {
+        if( n <= capacity() )
+        {
+            m_size = n;
+            return;
+        }
+
+        simple_buffer_t detached{ n };
+        if( 0 != size() )
+        {
+            std::memcpy( detached.data(), data(), size() );
+        }
+        release();
+        m_size     = n;
+        m_detached = std::move( detached );
+    }
+
+    /**
+     * @brief Append the buffer that immediately follows this one in the ring.
+     *
+     * Both buffers must be committed data of the same ring, and
+     * the data of a given buffer must go right after the range of this one.
+     * Resulting buffer is still contiguous in memory (as the ring is mirrored).
+     *
+     * @param next  A buffer to append, it is emptied on success.
+     *
+     * @return True if the buffer was appended.
+     */
+    [[nodiscard]] bool try_merge( mirrored_ring_buffer_t & next ) noexcept
+    {
+        if( !m_ring || m_ring != next.m_ring || m_is_reserved || next.m_is_reserved
+            || m_size != m_range_size || m_offset + m_range_size != next.m_offset )
+        {
+            return false;
+        }
+
+        m_size += next.m_size;
+        m_range_size += next.m_range_size;
+        next.m_ring.reset();
+        next.m_size       = 0;
+        next.m_range_size = 0;
+        return true;
+    }
+
+    /**
+     * @brief Drop the first n bytes of data.
+     *
+     * The dropped prefix of committed data is released back to the ring
+     * right away, so a buffer that keeps absorbing next data
+     * (see `try_merge()`) doesn't hold the ring space that was consumed.
+     * The data of a detached buffer is moved to its beginning.
+     *
+     * @pre `size() >= n` and the buffer is not a reservation.
+     *
+     * @param n  Number of bytes to drop.
+     */
+    void consume( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        assert( !m_is_reserved );
+
+        if( 0 == n )
+        {
+            return;
+        }
+
+        if( m_ring )
+        {
+            m_ring->release( m_offset, n );
+            m_offset += n;
+            m_range_size -= n;
+        }
+        else
+        {
+            std::memmove(
+                m_detached.data(), m_detached.offset_data( n ), m_size - n );
+        }
+        m_size -= n;
+    }
+
+private:
+    /**
+     * @brief Give the range of the ring back.
+     */
+    void release() noexcept
+    {
+        if( m_ring )
+        {
+            if( m_is_reserved )
+            {
+                m_ring->cancel_reservation();
+            }
+            else
+            {
+                m_ring->release( m_offset, m_range_size );
+            }
+            m_ring.reset();
+        }
+
+        m_size        = 0;
+        m_range_size  = 0;
+        m_is_reserved = false;
+        m_detached    = simple_buffer_t{};
+    }
+
+    ring_sptr_t m_ring;
+    std::uint64_t m_offset{};
+    size_type m_size{};
+
+    //! The size of the range of the ring owned by this buffer.
+    size_type m_range_size{};
+
+    //! Whether the buffer is a reservation of free space (not data yet).
+    bool m_is_reserved{ false };
+
+    //! The storage of a buffer detached from the ring.
+    simple_buffer_t m_detached;
+};
+
+[[nodiscard]] inline buffer_fmt_integrator_t buf_fmt_integrator(
+    const mirrored_ring_buffer_t & buf ) noexcept
+{
+    return buf_fmt_integrator( buf.data(), buf.size() );
+}
+
+//
+// mirrored_ring_input_buffer_driver_t
+//
+
+/**
+ * @brief A buffer driver that reads input into a mirror-mapped ring.
+ *
+ * Each instance of a driver (a connection owns its own copy) lazily
+ * creates its ring on first input allocation.
+ * If the ring has no free space (the consumer keeps too much
+ * unconsumed data) a new ring is started, the data at the junction
+ * of the rings would be not contiguous, so ring capacity should be
+ * chosen so that it fits a few largest packages.
+ *
+ * @tparam Output_Driver  A buffer driver for output buffers.
+ */
+template < typename Output_Driver = simple_buffer_driver_t >
+class mirrored_ring_input_buffer_driver_t : public Output_Driver
+{
+public:
+    using input_buffer_t  = mirrored_ring_buffer_t;
+    using output_buffer_t = typename Output_Driver::output_buffer_t;
+
+    static constexpr std::size_t default_ring_capacity = 4 * 1024 * 1024;
+
+    explicit mirrored_ring_input_buffer_driver_t(
+        std::size_t ring_capacity = default_ring_capacity,
+        Output_Driver output_driver = {} )
+        : Output_Driver{ std::move( output_driver ) }
+        , m_ring_capacity{ ring_capacity }
+    {
+    }
+
+    // Copies start their own rings.
+    mirrored_ring_input_buffer_driver_t(
+        const mirrored_ring_input_buffer_driver_t & d )
+        : Output_Driver{ static_cast< const Output_Driver & >( d ) }
+        , m_ring_capacity{ d.m_ring_capacity }
+    {
+    }
+    mirrored_ring_input_buffer_driver_t( mirrored_ring_input_buffer_driver_t && ) =
+        default;
+    mirrored_ring_input_buffer_driver_t & operator=(
+        const mirrored_ring_input_buffer_driver_t & d )
+    {
+        static_cast< Output_Driver & >( *this ) =
+            static_cast< const Output_Driver & >( d );
+        m_ring_capacity = d.m_ring_capacity;
+        m_ring.reset();
+        return *this;
+    }
+    mirrored_ring_input_buffer_driver_t & operator=(
+        mirrored_ring_input_buffer_driver_t && ) = default;
+
+    [[nodiscard]] std::size_t ring_capacity() const noexcept
+    {
+        return m_ring_capacity;
+    }
+
+    /**
+     * @brief Reserve a given amount of ring free space for input.
+     *
+     * The buffer might be smaller than requested
+     * if there is not enough free space in the ring.
+     *
+     * @param size  The size of a requested buffer.
+     */
+    [[nodiscard]] input_buffer_t allocate_input( std::size_t n )
+    {
+        std::uint64_t offset{};
+
+        if( m_ring ) [[likely]]
+        {
+            // It makes no sense to read into small leftovers.
+            constexpr std::size_t min_read_size = 4096;
+            const auto size                     = m_ring->reserve( n, offset );
+            if( std::min( n, min_read_size ) <= size ) [[likely]]
+            {
+                return mirrored_ring_buffer_t{ m_ring, offset, size };
+            }
+
+            if( 0 != size )
+            {
+                m_ring->cancel_reservation();
+            }
+        }
+
+        m_ring = std::make_shared< details::mirrored_ring_t >( m_ring_capacity );
+        const auto size = m_ring->reserve( n, offset );
+        return mirrored_ring_buffer_t{ m_ring, offset, size };
+    }
+
+    /**
+     * @brief Get a new input buffer instead of a given one.
+     *
+     * Ring space can't be reused out of order,
+     * so the old buffer is released and a new space is reserved.
+     *
+     * @param old_buf  The old buffer (with ownership).
+     * @param size     The size of a requested buffer.
+     */
+    [[nodiscard]] input_buffer_t reallocate_input( input_buffer_t old_buf,
+                                                   std::size_t n )
+    {
+        old_buf = mirrored_ring_buffer_t{};
+        return allocate_input( n );
+    }
+
+    /**
+     * @brief Commit the data read into a given input buffer.
+     *
+     * @param old_buf  The buffer the data was read into.
+     * @param size     The size of the data.
+     *
+     * @pre `old_buf.size() >= n`
+     */
+    [[nodiscard]] input_buffer_t reduce_size_input( input_buffer_t old_buf,
+                                                    std::size_t n ) const noexcept
+    {
+        old_buf.commit( n );
+        return old_buf;
+    }
+
+    using Output_Driver::make_asio_const_buffer;
+    using Output_Driver::make_asio_mutable_buffer;
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] static asio_ns::const_buffer make_asio_const_buffer(
+        const input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_const_buffer();
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] static asio_ns::mutable_buffer make_asio_mutable_buffer(
+        input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_mutable_buffer();
+    }
+
+private:
+    std::size_t m_ring_capacity;
+    std::shared_ptr< details::mirrored_ring_t > m_ring;
+};
+
+static_assert(
+    Buffer_Driver_Concept< mirrored_ring_input_buffer_driver_t<> > );
+
+}  // namespace opio::net
+
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
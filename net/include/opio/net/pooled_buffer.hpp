@@ -0,0 +1,924 @@
+/**
+ * @file
+ *
+ * This header file contains a pooled buffer and buffer drivers using it.
+ *
+ * Buffers memory is taken from a set of power-of-two size classes.
+ * Released blocks go to a per-thread cache of a thread releasing it
+ * and when it overflows they go to a global (shared by all threads) pool,
+ * so a steady IO load doesn't imply memory allocations.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/buffer.hpp>
+#include <opio/net/heterogeneous_buffer.hpp>
+#include <opio/net/shared_buffer.hpp>
+
+namespace opio::net
+{
+
+namespace details
+{
+
+/**
+ * @name Size classes of pooled buffers.
+ *
+ * The smallest class is 64 bytes, the largest is 4 MB.
+ * Larger buffers are allocated (and freed) directly.
+ */
+///@{
+inline constexpr std::size_t pooled_min_block_size_log2 = 6;
+inline constexpr std::size_t pooled_max_block_size_log2 = 22;
+inline constexpr std::size_t pooled_size_classes_count =
+    pooled_max_block_size_log2 - pooled_min_block_size_log2 + 1;
+
+inline constexpr std::uint32_t unpooled_size_class = ~std::uint32_t{};
+
+[[nodiscard]] constexpr std::size_t pooled_size_class_of( std::size_t n ) noexcept
+{
+    constexpr std::size_t min_block_size = std::size_t{ 1 }
+                                           << pooled_min_block_size_log2;
+    if( n <= min_block_size )
+    {
+        return 0;
+    }
+
+    return static_cast< std::size_t >( std::bit_width( n - 1 ) )
+           - pooled_min_block_size_log2;
+}
+
+[[nodiscard]] constexpr std::size_t pooled_size_class_capacity(
+    std::size_t size_class ) noexcept
+{
+    return std::size_t{ 1 } << ( size_class + pooled_min_block_size_log2 );
+}
+
+/**
+ * @brief The number of blocks of a given class a thread cache can keep.
+ *
+ * Gives about 1 MB per class (but at least one block
+ * and at most 64 blocks).
+ */
+[[nodiscard]] constexpr std::size_t pooled_thread_cache_limit(
+    std::size_t size_class ) noexcept
+{
+    constexpr std::size_t bytes_per_class = 1024 * 1024;
+    return std::clamp< std::size_t >(
+        bytes_per_class / pooled_size_class_capacity( size_class ), 1, 64 );
+}
+
+/**
+ * @brief The number of blocks of a given class a global pool can keep.
+ */
+[[nodiscard]] constexpr std::size_t pooled_global_pool_limit(
+    std::size_t size_class ) noexcept
+{
+    return 4 * pooled_thread_cache_limit( size_class );
+}
+///@}
+
+//
+// pooled_block_t
+//
+
+/**
+ * @brief A header of a memory block of pooled buffer.
+ *
+ * Buffer data goes right after the header.
+ */
+struct alignas( 16 ) pooled_block_t
+{
+    pooled_block_t( std::uint32_t cls, std::size_t cap ) noexcept
+        : size_class{ cls }
+        , capacity{ cap }
+    {
+    }
+
+    std::atomic< std::uint32_t > refs{ 1 };
+    std::uint32_t size_class;
+    std::size_t capacity;
+
+    //! A link in a list of free blocks.
+    pooled_block_t * next{ nullptr };
+
+    [[nodiscard]] std::byte * data() noexcept
+    {
+        return reinterpret_cast< std::byte * >( this + 1 );
+    }
+};
+
+[[nodiscard]] inline pooled_block_t * allocate_pooled_block(
+    std::uint32_t size_class,
+    std::size_t capacity )
+{
+    void * mem = ::operator new( sizeof( pooled_block_t ) + capacity );
+    return new( mem ) pooled_block_t{ size_class, capacity };
+}
+
+inline void free_pooled_block( pooled_block_t * block ) noexcept
+{
+    block->~pooled_block_t();
+    ::operator delete( static_cast< void * >( block ) );
+}
+
+//
+// pooled_free_list_t
+//
+
+/**
+ * @brief A list of free blocks (LIFO).
+ */
+struct pooled_free_list_t
+{
+    pooled_block_t * head{ nullptr };
+    std::size_t count{};
+
+    void push( pooled_block_t * block ) noexcept
+    {
+        block->next = head;
+        head        = block;
+        ++count;
+    }
+
+    [[nodiscard]] pooled_block_t * pop() noexcept
+    {
+        pooled_block_t * block = head;
+        if( nullptr != block )
+        {
+            head        = block->next;
+            block->next = nullptr;
+            --count;
+        }
+        return block;
+    }
+
+    /**
+     * @brief Move up to n blocks to another list.
+     */
+    void move_to( pooled_free_list_t & other, std::size_t n ) noexcept
+    {
+        for( ; 0 < n && nullptr != head; --n )
+        {
+            other.push( pop() );
+        }
+    }
+
+    void free_all() noexcept
+    {
+        while( auto * block = pop() )
+        {
+            free_pooled_block( block );
+        }
+    }
+};
+
+//
+// pooled_global_pool_t
+//
+
+/**
+ * @brief A pool of free blocks shared by all threads.
+ *
+ * Thread caches exchange blocks with it in batches,
+ * so the lock is taken once per a number of allocations.
+ */
+class pooled_global_pool_t
+{
+public:
+    /**
+     * @brief Take up to n blocks of a given class.
+     */
+    void take( std::size_t size_class,
+               pooled_free_list_t & dest,
+               std::size_t n ) noexcept
+    {
+        auto & cls = m_classes[ size_class ];
+        std::lock_guard lock{ cls.lock };
+        cls.blocks.move_to( dest, n );
+    }
+
+    /**
+     * @brief Put blocks of a given class to the pool.
+     *
+     * Blocks exceeding the limit of the pool are freed.
+     */
+    void put( std::size_t size_class, pooled_free_list_t & src ) noexcept
+    {
+        auto & cls = m_classes[ size_class ];
+        {
+            std::lock_guard lock{ cls.lock };
+            const auto limit = pooled_global_pool_limit( size_class );
+            if( cls.blocks.count < limit )
+            {
+                src.move_to( cls.blocks, limit - cls.blocks.count );
+            }
+        }
+        src.free_all();
+    }
+
+    /**
+     * @brief The number of free blocks of a given class kept by the pool.
+     */
+    [[nodiscard]] std::size_t free_blocks_count( std::size_t size_class ) noexcept
+    {
+        auto & cls = m_classes[ size_class ];
+        std::lock_guard lock{ cls.lock };
+        return cls.blocks.count;
+    }
+
+private:
+    struct size_class_pool_t
+    {
+        std::mutex lock;
+        pooled_free_list_t blocks;
+    };
+
+    std::array< size_class_pool_t, pooled_size_classes_count > m_classes;
+};
+
+[[nodiscard]] inline pooled_global_pool_t & pooled_global_pool() noexcept
+{
+    // The pool is never destroyed: blocks might be released
+    // by objects destroyed after it (statics, thread locals).
+    static auto * pool = new pooled_global_pool_t{};
+    return *pool;
+}
+
+//
+// pooled_thread_cache_t
+//
+
+/**
+ * @brief Whether the cache of the current thread is already destroyed.
+ *
+ * It is a trivially destructible variable, so it is safe to check it
+ * in the middle of thread locals destruction.
+ */
+inline thread_local bool pooled_thread_cache_is_destroyed = false;
+
+/**
+ * @brief A cache of free blocks of the current thread.
+ */
+class pooled_thread_cache_t
+{
+public:
+    pooled_thread_cache_t() = default;
+
+    pooled_thread_cache_t( const pooled_thread_cache_t & ) = delete;
+    pooled_thread_cache_t & operator=( const pooled_thread_cache_t & ) = delete;
+
+    ~pooled_thread_cache_t()
+    {
+        pooled_thread_cache_is_destroyed = true;
+
+        auto & global_pool = pooled_global_pool();
+        for( std::size_t i = 0; i < m_classes.size(); ++i )
+        {
+            global_pool.put( i, m_classes[ i ] );
+        }
+    }
+
+    [[nodiscard]] pooled_block_t * take( std::size_t size_class ) noexcept
+    {
+        auto & blocks = m_classes[ size_class ];
+        if( nullptr == blocks.head ) [[unlikely]]
+        {
+            // Refill half of the cache at once.
+            pooled_global_pool().take(
+                size_class,
+                blocks,
+                ( pooled_thread_cache_limit( size_class ) + 1 ) / 2 );
+        }
+
+        return blocks.pop();
+    }
+
+    void put( pooled_block_t * block ) noexcept
+    {
+        const std::size_t size_class = block->size_class;
+        auto & blocks                = m_classes[ size_class ];
+
+        if( pooled_thread_cache_limit( size_class ) <= blocks.count ) [[unlikely]]
+        {
+            // Give away half of the cache at once.
+            pooled_free_list_t overflow;
+            blocks.move_to( overflow, ( blocks.count + 1 ) / 2 );
+            pooled_global_pool().put( size_class, overflow );
+        }
+
+        blocks.push( block );
+    }
+
+    /**
+     * @brief The number of free blocks of a given class kept by the cache.
+     */
+    [[nodiscard]] std::size_t free_blocks_count(
+        std::size_t size_class ) const noexcept
+    {
+        return m_classes[ size_class ].count;
+    }
+
+private:
+    std::array< pooled_free_list_t, pooled_size_classes_count > m_classes;
+};
+
+/**
+ * @brief Get the cache of the current thread.
+ *
+ * @return Cache instance or nullptr if thread's cache is already destroyed
+ *         (thread is finishing).
+ */
+[[nodiscard]] inline pooled_thread_cache_t * pooled_thread_cache() noexcept
+{
+    if( pooled_thread_cache_is_destroyed ) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    thread_local pooled_thread_cache_t cache;
+    return &cache;
+}
+
+[[nodiscard]] inline pooled_block_t * acquire_pooled_block( std::size_t n )
+{
+    const auto size_class = pooled_size_class_of( n );
+
+    if( pooled_size_classes_count <= size_class ) [[unlikely]]
+    {
+        return allocate_pooled_block( unpooled_size_class, n );
+    }
+
+    pooled_block_t * block = nullptr;
+    if( auto * cache = pooled_thread_cache(); nullptr != cache ) [[likely]]
+    {
+        block = cache->take( size_class );
+    }
+
+    if( nullptr == block ) [[unlikely]]
+    {
+        return allocate_pooled_block(
+            static_cast< std::uint32_t >( size_class ),
+            pooled_size_class_capacity( size_class ) );
+    }
+
+    block->refs.store( 1, std::memory_order_relaxed );
+    return block;
+}
+
+inline void release_pooled_block( pooled_block_t * block ) noexcept
+{
+    if( unpooled_size_class == block->size_class ) [[unlikely]]
+    {
+        free_pooled_block( block );
+        return;
+    }
+
+    if( auto * cache = pooled_thread_cache(); nullptr != cache ) [[likely]]
+    {
+        cache->put( block );
+        return;
+    }
+
+    pooled_free_list_t single;
+    single.push( block );
+    pooled_global_pool().put( block->size_class, single );
+}
+
+}  // namespace details
+
+//
+// pooled_buffer_t
+//
+
+/**
+ * @brief A byte buffer which memory is taken from a pool.
+ *
+ * Memory block is reference counted: a buffer is unique by default,
+ * but it is possible to get another owner of the same block
+ * with `share()` (e.g. to send the same data to several connections
+ * without copies). The block returns to the pool when its last owner
+ * releases it.
+ *
+ * Capacity of a buffer is the size of its size class (the next power of two),
+ * so growing a buffer within it doesn't imply reallocation.
+ *
+ * @note Shared owners refer the same data,
+ *       so a shared buffer is assumed not to be modified.
+ */
+class pooled_buffer_t
+{
+public:
+    using size_type  = std::size_t;
+    using value_type = std::byte;
+
+    constexpr pooled_buffer_t() = default;
+
+    /**
+     * @brief Creates a buffer that has a given size
+     *
+     * @note the data is not initialized.
+     */
+    explicit pooled_buffer_t( size_type n )
+        : m_block{ n ? details::acquire_pooled_block( n ) : nullptr }
+        , m_size{ n }
+    {
+    }
+
+    /**
+     * @brief Creates a buffer that has a given size and fill it with a given
+     * value.
+     */
+    explicit pooled_buffer_t( size_type n, value_type v )
+        : pooled_buffer_t( n )
+    {
+        std::fill( data(), data() + size(), v );
+    }
+
+    /**
+     * @brief Creates a buffer and initializes it to a given data.
+     */
+    explicit pooled_buffer_t( const void * src, size_type n )
+        : pooled_buffer_t( n )
+    {
+        if( 0 != n )
+        {
+            std::memcpy( data(), src, size() );
+        }
+    }
+
+    // No unintended copies allowed,
+    // use make_copy() or share().
+    pooled_buffer_t( const pooled_buffer_t & ) = delete;
+    pooled_buffer_t & operator=( const pooled_buffer_t & ) = delete;
+
+    pooled_buffer_t( pooled_buffer_t && b ) noexcept
+        : m_block{ std::exchange( b.m_block, nullptr ) }
+        , m_size{ std::exchange( b.m_size, 0 ) }
+    {
+    }
+
+    pooled_buffer_t & operator=( pooled_buffer_t && b ) noexcept
+    {
+        if( this != &b )
+        {
+            release();
+            m_block = std::exchange( b.m_block, nullptr );
+            m_size  = std::exchange( b.m_size, 0 );
+        }
+        return *this;
+    }
+
+    ~pooled_buffer_t() { release(); }
+
+    /**
+     * @brief Get one more owner of the same memory block.
+     */
+    [[nodiscard]] pooled_buffer_t share() const noexcept
+    {
+        if( nullptr != m_block )
+        {
+            m_block->refs.fetch_add( 1, std::memory_order_relaxed );
+        }
+        return pooled_buffer_t{ m_block, m_size };
+    }
+
+    /**
+     * @brief The number of owners of the memory block.
+     */
+    [[nodiscard]] std::size_t use_count() const noexcept
+    {
+        return m_block ? m_block->refs.load( std::memory_order_acquire ) : 0;
+    }
+
+    /**
+     * @brief Get a slice of the buffer.
+     *
+     * The slice holds one more owner of the memory block,
+     * so the block is not reused while the slice exists.
+     *
+     * @pre `offset + n <= size()`.
+     */
+    [[nodiscard]] shared_buffer_slice_t make_slice( size_type offset,
+                                                    size_type n ) const
+    {
+        assert( offset + n <= size() );
+        auto owner = std::make_shared< const pooled_buffer_t >( share() );
+        return { std::shared_ptr< const value_type >{ owner,
+                                                      owner->data() + offset },
+                 n };
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_block ? m_block->capacity : 0;
+    }
+    [[nodiscard]] const value_type * data() const noexcept
+    {
+        return m_block ? m_block->data() : nullptr;
+    }
+    [[nodiscard]] value_type * data() noexcept
+    {
+        return m_block ? m_block->data() : nullptr;
+    }
+
+    [[nodiscard]] const value_type * offset_data( size_type n ) const noexcept
+    {
+        return data() + n;
+    }
+    [[nodiscard]] value_type * offset_data( size_type n ) noexcept
+    {
+        return data() + n;
+    }
+
+    [[nodiscard]] pooled_buffer_t make_copy() const
+    {
+        return pooled_buffer_t{ data(), size() };
+    }
+
+    [[nodiscard]] std::string_view make_string_view() const noexcept
+    {
+        return { reinterpret_cast< const char * >( data() ), size() };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< const Char_Type > make_const_span() const noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< const Char_Type >{
+            reinterpret_cast< const Char_Type * >( data() ), size()
+        };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< Char_Type > make_mutable_span() noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< Char_Type >{ reinterpret_cast< Char_Type * >( data() ),
+                                       size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::const_buffer make_asio_const_buffer() const noexcept
+    {
+        return { data(), size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::mutable_buffer make_asio_mutable_buffer() noexcept
+    {
+        return { static_cast< void * >( data() ), size() };
+    }
+
+    /**
+     * @brief Make a buffer represent less data.
+     *
+     * @note Capacity remains the same.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void shrink_size( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        m_size = n;
+    }
+
+    /**
+     * @brief Resize the buffer preserving the data curently stored in.
+     *
+     * If capacity allows it the buffer will be extended without
+     * new allocation.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void resize( size_type n )
+    {
+        if( n <= capacity() )
+        {
+            m_size = n;
+            return;
+        }
+
+        pooled_buffer_t new_buf{ n };
+        if( 0 != size() )
+        {
+            std::memcpy( new_buf.data(), data(), size() );
+        }
+        *this = std::move( new_buf );
+    }
+
+    /**
+     * @brief Resize the buffer not preserving the data curently stored in.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void resize_drop_data( size_type n )
+    {
+        if( n <= capacity() )
+        {
+            m_size = n;
+            return;
+        }
+
+        *this = pooled_buffer_t{ n };
+    }
+
+private:
+    pooled_buffer_t( details::pooled_block_t * block, size_type n ) noexcept
+        : m_block{ block }
+        , m_size{ n }
+    {
+    }
+
+    void release() noexcept
+    {
+        if( nullptr == m_block )
+        {
+            return;
+        }
+
+        // A sole owner doesn't need an atomic RMW operation:
+        // no one else can add an owner.
+        if( 1 == m_block->refs.load( std::memory_order_acquire )
+            || 1 == m_block->refs.fetch_sub( 1, std::memory_order_acq_rel ) )
+        {
+            details::release_pooled_block( m_block );
+        }
+
+        m_block = nullptr;
+        m_size  = 0;
+    }
+
+    details::pooled_block_t * m_block{ nullptr };
+    size_type m_size{};
+};
+
+[[nodiscard]] inline buffer_fmt_integrator_t buf_fmt_integrator(
+    const pooled_buffer_t & buf ) noexcept
+{
+    return buf_fmt_integrator( buf.data(), buf.size() );
+}
+
+//
+// pooled_buffer_driver_t
+//
+
+/**
+ * @brief A buffer driver that uses pooled buffers for both
+ *        input and output.
+ */
+struct pooled_buffer_driver_t
+{
+    using input_buffer_t  = pooled_buffer_t;
+    using output_buffer_t = pooled_buffer_t;
+
+    /**
+     * @brief Create an instance of an inputs buffer of a given size.
+     *
+     * @param size  The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t allocate_input( std::size_t n ) const
+    {
+        return pooled_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given input buffer.
+     *
+     * The old buffer is reused only if it is not shared
+     * (otherwise the data of other owners would be overwritten).
+     *
+     * @param old_buf  The old buffer we might reuse (with ownership).
+     * @param size     The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t reallocate_input( input_buffer_t old_buf,
+                                                   std::size_t n ) const
+    {
+        if( 1 == old_buf.use_count() ) [[likely]]
+        {
+            old_buf.resize_drop_data( n );
+            return old_buf;
+        }
+
+        return pooled_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given input buffer.
+     *
+     * @param old_buf  The old buffer we might reuse (with ownership).
+     * @param size     The ruduced size for a buffer to represent.
+     *
+     * @pre `old_buf.size() >= n`
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t reduce_size_input( input_buffer_t old_buf,
+                                                    std::size_t n ) const noexcept
+    {
+        old_buf.shrink_size( n );
+        return old_buf;
+    }
+
+    /**
+     * @brief Create an instance of an outputs buffer of a given size.
+     *
+     * @param size  The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] output_buffer_t allocate_output( std::size_t n ) const
+    {
+        return pooled_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given output buffer.
+     *
+     * @param old_buf  The old buffer we might reuse.
+     * @param size     The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] output_buffer_t reallocate_output( output_buffer_t old_buf,
+                                                     std::size_t n ) const
+    {
+        if( 1 == old_buf.use_count() ) [[likely]]
+        {
+            old_buf.resize( n );
+            return old_buf;
+        }
+
+        pooled_buffer_t buf{ n };
+        std::memcpy( buf.data(), old_buf.data(), std::min( n, old_buf.size() ) );
+        return buf;
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::const_buffer make_asio_const_buffer(
+        const output_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_const_buffer();
+    }
+
+    /**
+     * @brief Obtain the size of the buffer.
+     *
+     * @param buf  A reference to a buffer to ask for size.
+     */
+    [[nodiscard]] static std::size_t buffer_size(
+        const output_buffer_t & buf ) noexcept
+    {
+        return buf.size();
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::mutable_buffer make_asio_mutable_buffer(
+        input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_mutable_buffer();
+    }
+};
+
+static_assert( Buffer_Driver_Concept< pooled_buffer_driver_t > );
+
+//
+// pooled_heterogeneous_buffer_driver_t
+//
+
+/**
+ * @brief A buffer driver that uses pooled buffers for input
+ *        and for output buffers it allocates itself,
+ *        but still accepts output buffers of different origin.
+ *
+ * @see heterogeneous_buffer_driver_t.
+ */
+struct pooled_heterogeneous_buffer_driver_t : public pooled_buffer_driver_t
+{
+    using input_buffer_t  = pooled_buffer_t;
+    using output_buffer_t = heterogeneous_buffer_t;
+
+    /**
+     * @brief Create an instance of an outputs buffer of a given size.
+     *
+     * @param size  The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size
+     *         (which is convertible to output_buffer_t).
+     */
+    [[nodiscard]] pooled_buffer_t allocate_output( std::size_t n ) const
+    {
+        return pooled_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given output buffer.
+     *
+     * @param old_buf  The old buffer.
+     * @param size     The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size
+     *         with the data of the old one.
+     */
+    [[nodiscard]] output_buffer_t reallocate_output( output_buffer_t && old_buf,
+                                                     std::size_t n ) const
+    {
+        const auto old_data = old_buf.make_asio_const_buffer();
+
+        pooled_buffer_t buf{ n };
+        std::memcpy( buf.data(), old_data.data(), std::min( n, old_data.size() ) );
+        return buf;
+    }
+
+    using pooled_buffer_driver_t::buffer_size;
+    using pooled_buffer_driver_t::make_asio_const_buffer;
+    using pooled_buffer_driver_t::make_asio_mutable_buffer;
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::const_buffer make_asio_const_buffer(
+        const output_buffer_t & buf )
+    {
+        return buf.make_asio_const_buffer();
+    }
+
+    /**
+     * @brief Obtain the size of the buffer.
+     *
+     * @param buf  A reference to a buffer to ask for size.
+     */
+    [[nodiscard]] static std::size_t buffer_size( const output_buffer_t & buf )
+    {
+        return buf.get_size();
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::mutable_buffer make_asio_mutable_buffer(
+        output_buffer_t & buf )
+    {
+        return buf.make_asio_mutable_buffer();
+    }
+};
+
+static_assert( Buffer_Driver_Concept< pooled_heterogeneous_buffer_driver_t > );
+
+}  // namespace opio::net
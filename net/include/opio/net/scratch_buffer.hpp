@@ -0,0 +1,434 @@
+/**
+ * @file
+ *
+ * This header file contains an input buffer referring a per-thread
+ * scratch memory and a buffer driver using it.
+ *
+ * All connections running on a given thread read into the same
+ * (large) scratch memory of that thread, the data is handed
+ * to the consumer as a view into the scratch and only the incomplete tail
+ * the consumer asks to keep is copied to a (small) per-connection carry
+ * buffer which is put in front of the data of the next read.
+ * So resident read memory is O(threads × scratch) and not
+ * O(connections × input_buffer_size).
+ *
+ * The scratch is reused by the next read on the thread, so input buffers
+ * are valid only during the call to the input handler: consumer must
+ * handle the data right away and must not keep the buffer (e.g. by posting
+ * it somewhere). Connection reads into such buffers only when the socket
+ * is known to be readable (see scratch_input_buffer_driver_t).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/buffer.hpp>
+
+namespace opio::net
+{
+
+namespace details
+{
+
+//
+// thread_scratch_memory()
+//
+
+/**
+ * @brief Get the scratch memory of the current thread.
+ *
+ * @param n  Minimal size of the memory.
+ *
+ * @return Pointer to at least n bytes. The memory is the same for each call
+ *         unless it has to grow, in which case the previous content is lost.
+ */
+[[nodiscard]] inline std::byte * thread_scratch_memory( std::size_t n )
+{
+    struct scratch_t
+    {
+        std::unique_ptr< std::byte[] > data;  // NOLINT(*-avoid-c-arrays)
+        std::size_t size{};
+    };
+
+    thread_local scratch_t scratch{};
+
+    if( scratch.size < n ) [[unlikely]]
+    {
+        scratch.data.reset();
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        scratch.data = std::make_unique_for_overwrite< std::byte[] >( n );
+        scratch.size = n;
+    }
+
+    return scratch.data.get();
+}
+
+//
+// scratch_carry_t
+//
+
+/**
+ * @brief Per-connection storage for the incomplete tail of data.
+ */
+class scratch_carry_t
+{
+public:
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_buf.capacity();
+    }
+
+    /**
+     * @brief Store a copy of the given data (replacing the previous one).
+     */
+    void assign( const std::byte * data, std::size_t n )
+    {
+        if( m_buf.capacity() < n )
+        {
+            m_buf = simple_buffer_t{ n };
+        }
+        std::memcpy( m_buf.data(), data, n );
+        m_size = n;
+    }
+
+    /**
+     * @brief Copy stored data to a given memory.
+     *
+     * @return The number of bytes copied.
+     */
+    std::size_t copy_to( std::byte * dest ) const noexcept
+    {
+        if( 0 != m_size )
+        {
+            std::memcpy( dest, m_buf.data(), m_size );
+        }
+        return m_size;
+    }
+
+    /**
+     * @brief Forget stored data.
+     */
+    void clear() noexcept { m_size = 0; }
+
+private:
+    simple_buffer_t m_buf;
+    std::size_t m_size{};
+};
+
+}  // namespace details
+
+//
+// scratch_input_buffer_t
+//
+
+/**
+ * @brief A byte buffer referring the scratch memory of the current thread.
+ *
+ * A buffer is either a space to read into (see
+ * scratch_input_buffer_driver_t::allocate_input()) or a view of data read
+ * (prepended with the tail kept since the previous read, if any).
+ *
+ * The buffer doesn't own the memory and is valid only during
+ * the input handler call.
+ */
+class scratch_input_buffer_t
+{
+public:
+    using size_type  = std::size_t;
+    using value_type = std::byte;
+
+    scratch_input_buffer_t() = default;
+
+    /**
+     * @brief Creates a buffer to read into.
+     *
+     * @param base    The beginning of the memory (the tail kept before).
+     * @param prefix  The size of the tail kept before.
+     * @param n       The size of a space to read into (after the tail).
+     * @param carry   The storage for the tail to keep.
+     */
+    scratch_input_buffer_t( value_type * base,
+                            size_type prefix,
+                            size_type n,
+                            details::scratch_carry_t * carry ) noexcept
+        : m_base{ base }
+        , m_prefix{ prefix }
+        , m_size{ n }
+        , m_carry{ carry }
+    {
+    }
+
+    scratch_input_buffer_t( const scratch_input_buffer_t & ) = delete;
+    scratch_input_buffer_t & operator=( const scratch_input_buffer_t & ) = delete;
+
+    scratch_input_buffer_t( scratch_input_buffer_t && b ) noexcept
+        : m_base{ std::exchange( b.m_base, nullptr ) }
+        , m_prefix{ std::exchange( b.m_prefix, 0 ) }
+        , m_size{ std::exchange( b.m_size, 0 ) }
+        , m_carry{ std::exchange( b.m_carry, nullptr ) }
+    {
+    }
+
+    scratch_input_buffer_t & operator=( scratch_input_buffer_t && b ) noexcept
+    {
+        if( this != &b )
+        {
+            m_base   = std::exchange( b.m_base, nullptr );
+            m_prefix = std::exchange( b.m_prefix, 0 );
+            m_size   = std::exchange( b.m_size, 0 );
+            m_carry  = std::exchange( b.m_carry, nullptr );
+        }
+        return *this;
+    }
+
+    ~scratch_input_buffer_t() = default;
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] const value_type * data() const noexcept
+    {
+        return m_base + m_prefix;
+    }
+    [[nodiscard]] value_type * data() noexcept { return m_base + m_prefix; }
+
+    [[nodiscard]] const value_type * offset_data( size_type n ) const noexcept
+    {
+        return data() + n;
+    }
+    [[nodiscard]] value_type * offset_data( size_type n ) noexcept
+    {
+        return data() + n;
+    }
+
+    [[nodiscard]] std::string_view make_string_view() const noexcept
+    {
+        return { reinterpret_cast< const char * >( data() ), size() };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< const Char_Type > make_const_span() const noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< const Char_Type >{
+            reinterpret_cast< const Char_Type * >( data() ), size()
+        };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::const_buffer make_asio_const_buffer() const noexcept
+    {
+        return { data(), size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::mutable_buffer make_asio_mutable_buffer() noexcept
+    {
+        return { static_cast< void * >( data() ), size() };
+    }
+
+    /**
+     * @brief Turn a space to read into to a view of data.
+     *
+     * The view covers the tail kept before and n bytes read.
+     *
+     * @pre `size() >= n`
+     */
+    void commit( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        m_size   = m_prefix + n;
+        m_prefix = 0;
+    }
+
+    /**
+     * @brief Keep the last n bytes of the data for the next read.
+     *
+     * The data is copied to the carry buffer of the connection
+     * and is put in front of the data read next time.
+     * Makes sense for the incomplete package at the end of the data.
+     *
+     * @pre `size() >= n`
+     */
+    void keep_tail( size_type n )
+    {
+        assert( size() >= n );
+        assert( nullptr != m_carry || 0 == n );
+        if( nullptr != m_carry )
+        {
+            m_carry->assign( data() + size() - n, n );
+        }
+    }
+
+private:
+    value_type * m_base{};
+    size_type m_prefix{};
+    size_type m_size{};
+    details::scratch_carry_t * m_carry{};
+};
+
+//
+// scratch_input_buffer_driver_t
+//
+
+/**
+ * @brief A buffer driver that reads input into per-thread scratch memory.
+ *
+ * Output is handled by Output_Driver.
+ *
+ * Each instance (which is a member of a single connection)
+ * holds the carry buffer of a connection, copies start with
+ * an empty carry buffer. The carry buffer is allocated on the heap
+ * (on the first allocate_input()), so input buffers referring it
+ * stay valid when the driver is moved.
+ *
+ * @note Input buffers are transient (see `transient_input_buffers`):
+ *       connection doesn't hold them between reads and reads
+ *       only when the socket is readable, so the scratch is used
+ *       by one read (and one input handler call) at a time.
+ */
+template < typename Output_Driver = simple_buffer_driver_t >
+class scratch_input_buffer_driver_t : public Output_Driver
+{
+public:
+    using input_buffer_t  = scratch_input_buffer_t;
+    using output_buffer_t = typename Output_Driver::output_buffer_t;
+
+    /**
+     * @brief Input buffers are valid only until the next read
+     *        on the same thread.
+     */
+    static constexpr bool transient_input_buffers = true;
+
+    explicit scratch_input_buffer_driver_t( Output_Driver output_driver = {} )
+        : Output_Driver{ std::move( output_driver ) }
+    {
+    }
+
+    // Copies start with an empty carry.
+    scratch_input_buffer_driver_t( const scratch_input_buffer_driver_t & d )
+        : Output_Driver{ static_cast< const Output_Driver & >( d ) }
+    {
+    }
+    // Moves take the carry (its address doesn't change).
+    scratch_input_buffer_driver_t( scratch_input_buffer_driver_t && ) = default;
+    scratch_input_buffer_driver_t & operator=(
+        const scratch_input_buffer_driver_t & d )
+    {
+        static_cast< Output_Driver & >( *this ) =
+            static_cast< const Output_Driver & >( d );
+        m_carry.reset();
+        return *this;
+    }
+    scratch_input_buffer_driver_t & operator=(
+        scratch_input_buffer_driver_t && ) = default;
+
+    /**
+     * @brief The size of the tail kept since the previous read.
+     */
+    [[nodiscard]] std::size_t carry_size() const noexcept
+    {
+        return m_carry ? m_carry->size() : 0;
+    }
+
+    /**
+     * @brief Get the scratch space to read n bytes into.
+     *
+     * The tail kept since the previous read is copied in front of the space.
+     *
+     * @param size  The size of a requested buffer.
+     */
+    [[nodiscard]] input_buffer_t allocate_input( std::size_t n )
+    {
+        if( !m_carry ) [[unlikely]]
+        {
+            m_carry = std::make_unique< details::scratch_carry_t >();
+        }
+
+        auto * base       = details::thread_scratch_memory( m_carry->size() + n );
+        const auto prefix = m_carry->copy_to( base );
+        return scratch_input_buffer_t{ base, prefix, n, m_carry.get() };
+    }
+
+    /**
+     * @brief Get a new input buffer instead of a given one.
+     *
+     * @param old_buf  The old buffer (with ownership).
+     * @param size     The size of a requested buffer.
+     */
+    [[nodiscard]] input_buffer_t reallocate_input( input_buffer_t old_buf,
+                                                   std::size_t n )
+    {
+        old_buf = scratch_input_buffer_t{};
+        return allocate_input( n );
+    }
+
+    /**
+     * @brief Make a view of the data read into a given input buffer.
+     *
+     * The view includes the tail kept before, so the carry gets empty
+     * (unless the tail is kept again, see scratch_input_buffer_t::keep_tail()).
+     *
+     * @param old_buf  The buffer the data was read into.
+     * @param size     The size of the data.
+     *
+     * @pre `old_buf.size() >= n`
+     */
+    [[nodiscard]] input_buffer_t reduce_size_input( input_buffer_t old_buf,
+                                                    std::size_t n ) noexcept
+    {
+        old_buf.commit( n );
+        if( m_carry )
+        {
+            m_carry->clear();
+        }
+        return old_buf;
+    }
+
+    using Output_Driver::make_asio_const_buffer;
+    using Output_Driver::make_asio_mutable_buffer;
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] static asio_ns::const_buffer make_asio_const_buffer(
+        const input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_const_buffer();
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] static asio_ns::mutable_buffer make_asio_mutable_buffer(
+        input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_mutable_buffer();
+    }
+
+private:
+    //! Has a stable address, as input buffers refer it.
+    std::unique_ptr< details::scratch_carry_t > m_carry;
+};
+
+static_assert( Buffer_Driver_Concept< scratch_input_buffer_driver_t<> > );
+
+}  // namespace opio::net
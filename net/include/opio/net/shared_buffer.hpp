@@ -0,0 +1,501 @@
+/**
+ * @file
+ *
+ * This header file contains a buffer with shared ownership of its memory,
+ * a slice of such buffers and a buffer driver using shared input buffers.
+ *
+ * Slices make it possible to pass a part of received data further
+ * (e.g. as a binary attached to a message) without copying it:
+ * a slice keeps the whole memory block of the read buffer alive.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/buffer.hpp>
+#include <opio/net/heterogeneous_buffer.hpp>
+
+namespace opio::net
+{
+
+//
+// shared_buffer_slice_t
+//
+
+/**
+ * @brief A read-only view of a part of a buffer
+ *        that shares the ownership of the buffer memory.
+ *
+ * The origin of the memory is erased, so a slice can refer
+ * a shared_buffer_t, a pooled_buffer_t or can own a simple_buffer_t.
+ * Copies of a slice are cheap (they only add an owner).
+ *
+ * Slice is a datasizeable type, so it can be sent as is
+ * with heterogeneous_buffer_t.
+ */
+class shared_buffer_slice_t
+{
+public:
+    using size_type  = std::size_t;
+    using value_type = std::byte;
+
+    shared_buffer_slice_t() = default;
+
+    /**
+     * @brief Creates a slice from a pointer to data sharing ownership
+     *        of the memory block (see aliasing ctor of std::shared_ptr).
+     *
+     * @param data  Pointer to the beginning of the slice.
+     * @param n     Size of the slice.
+     */
+    shared_buffer_slice_t( std::shared_ptr< const value_type > data,
+                           size_type n ) noexcept
+        : m_data{ std::move( data ) }
+        , m_size{ n }
+    {
+    }
+
+    /**
+     * @brief Creates a slice owning a whole given buffer.
+     */
+    explicit shared_buffer_slice_t( simple_buffer_t buf )
+    {
+        if( 0 == buf.size() )
+        {
+            return;
+        }
+
+        auto owner = std::make_shared< simple_buffer_t >( std::move( buf ) );
+        m_size     = owner->size();
+        m_data     = std::shared_ptr< const value_type >{ owner, owner->data() };
+    }
+
+    shared_buffer_slice_t( const shared_buffer_slice_t & ) = default;
+    shared_buffer_slice_t & operator=( const shared_buffer_slice_t & ) = default;
+
+    shared_buffer_slice_t( shared_buffer_slice_t && s ) noexcept
+        : m_data{ std::move( s.m_data ) }
+        , m_size{ std::exchange( s.m_size, 0 ) }
+    {
+    }
+
+    shared_buffer_slice_t & operator=( shared_buffer_slice_t && s ) noexcept
+    {
+        if( this != &s )
+        {
+            m_data = std::move( s.m_data );
+            m_size = std::exchange( s.m_size, 0 );
+        }
+        return *this;
+    }
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] const value_type * data() const noexcept
+    {
+        return m_data.get();
+    }
+
+    [[nodiscard]] const value_type * offset_data( size_type n ) const noexcept
+    {
+        return data() + n;
+    }
+
+    /**
+     * @brief Get a slice of this slice.
+     *
+     * @pre `offset + n <= size()`.
+     */
+    [[nodiscard]] shared_buffer_slice_t make_slice( size_type offset,
+                                                    size_type n ) const noexcept
+    {
+        assert( offset + n <= size() );
+        return { std::shared_ptr< const value_type >{ m_data, data() + offset },
+                 n };
+    }
+
+    /**
+     * @brief The number of owners of the memory block.
+     */
+    [[nodiscard]] long use_count() const noexcept { return m_data.use_count(); }
+
+    [[nodiscard]] simple_buffer_t make_copy() const
+    {
+        return simple_buffer_t{ data(), size() };
+    }
+
+    [[nodiscard]] std::string_view make_string_view() const noexcept
+    {
+        return { reinterpret_cast< const char * >( data() ), size() };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< const Char_Type > make_const_span() const noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< const Char_Type >{
+            reinterpret_cast< const Char_Type * >( data() ), size()
+        };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::const_buffer make_asio_const_buffer() const noexcept
+    {
+        return { data(), size() };
+    }
+
+private:
+    std::shared_ptr< const value_type > m_data;
+    size_type m_size{};
+};
+
+[[nodiscard]] inline buffer_fmt_integrator_t buf_fmt_integrator(
+    const shared_buffer_slice_t & buf ) noexcept
+{
+    return buf_fmt_integrator( buf.data(), buf.size() );
+}
+
+//
+// shared_buffer_t
+//
+
+/**
+ * @brief A byte buffer which memory block has shared ownership.
+ *
+ * A buffer is unique by default, other owners appear
+ * when slices of the buffer are made (see make_slice()).
+ *
+ * @note Slices refer the same data,
+ *       so a shared buffer is assumed not to be modified.
+ */
+class shared_buffer_t
+{
+public:
+    using size_type  = std::size_t;
+    using value_type = std::byte;
+
+    shared_buffer_t() = default;
+
+    /**
+     * @brief Creates a buffer that has a given size
+     *
+     * @note the data is not initialized.
+     */
+    explicit shared_buffer_t( size_type n )
+        : m_buf{ n ? std::shared_ptr< value_type[] >{ new value_type[ n ] }
+                   : nullptr }
+        , m_size{ n }
+        , m_capacity{ n }
+    {
+    }
+
+    /**
+     * @brief Creates a buffer and initializes it to a given data.
+     */
+    explicit shared_buffer_t( const void * src, size_type n )
+        : shared_buffer_t( n )
+    {
+        if( 0 != n )
+        {
+            std::memcpy( data(), src, size() );
+        }
+    }
+
+    // No unintended copies allowed,
+    // use make_copy() or make_slice().
+    shared_buffer_t( const shared_buffer_t & ) = delete;
+    shared_buffer_t & operator=( const shared_buffer_t & ) = delete;
+
+    shared_buffer_t( shared_buffer_t && b ) noexcept
+        : m_buf{ std::move( b.m_buf ) }
+        , m_size{ std::exchange( b.m_size, 0 ) }
+        , m_capacity{ std::exchange( b.m_capacity, 0 ) }
+    {
+    }
+
+    shared_buffer_t & operator=( shared_buffer_t && b ) noexcept
+    {
+        if( this != &b )
+        {
+            m_buf      = std::move( b.m_buf );
+            m_size     = std::exchange( b.m_size, 0 );
+            m_capacity = std::exchange( b.m_capacity, 0 );
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Get a slice of the buffer.
+     *
+     * The slice shares the ownership of the memory block.
+     *
+     * @pre `offset + n <= size()`.
+     */
+    [[nodiscard]] shared_buffer_slice_t make_slice( size_type offset,
+                                                    size_type n ) const noexcept
+    {
+        assert( offset + n <= size() );
+        return { std::shared_ptr< const value_type >{ m_buf, data() + offset },
+                 n };
+    }
+
+    /**
+     * @brief The number of owners of the memory block.
+     */
+    [[nodiscard]] long use_count() const noexcept { return m_buf.use_count(); }
+
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] const value_type * data() const noexcept { return m_buf.get(); }
+    [[nodiscard]] value_type * data() noexcept { return m_buf.get(); }
+
+    [[nodiscard]] const value_type * offset_data( size_type n ) const noexcept
+    {
+        return data() + n;
+    }
+    [[nodiscard]] value_type * offset_data( size_type n ) noexcept
+    {
+        return data() + n;
+    }
+
+    [[nodiscard]] shared_buffer_t make_copy() const
+    {
+        return shared_buffer_t{ data(), size() };
+    }
+
+    [[nodiscard]] std::string_view make_string_view() const noexcept
+    {
+        return { reinterpret_cast< const char * >( data() ), size() };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< const Char_Type > make_const_span() const noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< const Char_Type >{
+            reinterpret_cast< const Char_Type * >( data() ), size()
+        };
+    }
+
+    /**
+     * @brief Get underlying buffer as span.
+     */
+    template < typename Char_Type = std::byte >
+    [[nodiscard]] std::span< Char_Type > make_mutable_span() noexcept
+    {
+        static_assert( sizeof( Char_Type ) == sizeof( std::byte ) );
+        static_assert( std::is_trivial_v< Char_Type > );
+
+        return std::span< Char_Type >{ reinterpret_cast< Char_Type * >( data() ),
+                                       size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::const_buffer make_asio_const_buffer() const noexcept
+    {
+        return { data(), size() };
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     */
+    [[nodiscard]] asio_ns::mutable_buffer make_asio_mutable_buffer() noexcept
+    {
+        return { static_cast< void * >( data() ), size() };
+    }
+
+    /**
+     * @brief Make a buffer represent less data.
+     *
+     * @note Capacity remains the same.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void shrink_size( size_type n ) noexcept
+    {
+        assert( size() >= n );
+        m_size = n;
+    }
+
+    /**
+     * @brief Resize the buffer preserving the data curently stored in.
+     *
+     * If capacity allows it the buffer will be extended without
+     * new allocation.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void resize( size_type n )
+    {
+        if( n <= capacity() )
+        {
+            m_size = n;
+            return;
+        }
+
+        shared_buffer_t new_buf{ n };
+        if( 0 != size() )
+        {
+            std::memcpy( new_buf.data(), data(), size() );
+        }
+        *this = std::move( new_buf );
+    }
+
+    /**
+     * @brief Resize the buffer not preserving the data curently stored in.
+     *
+     * @param n  New size of data carried by the buffer.
+     */
+    void resize_drop_data( size_type n )
+    {
+        if( n <= capacity() )
+        {
+            m_size = n;
+            return;
+        }
+
+        *this = shared_buffer_t{ n };
+    }
+
+private:
+    std::shared_ptr< value_type[] > m_buf;
+    size_type m_size{};
+    size_type m_capacity{};
+};
+
+[[nodiscard]] inline buffer_fmt_integrator_t buf_fmt_integrator(
+    const shared_buffer_t & buf ) noexcept
+{
+    return buf_fmt_integrator( buf.data(), buf.size() );
+}
+
+//
+// shared_buffer_driver_t
+//
+
+/**
+ * @brief A buffer driver that reads input into shared buffers
+ *        and accepts output buffers of different origin.
+ *
+ * Parts of input can be passed further as slices
+ * without copying them.
+ *
+ * @see heterogeneous_buffer_driver_t.
+ */
+struct shared_buffer_driver_t : public heterogeneous_buffer_driver_t
+{
+    using input_buffer_t  = shared_buffer_t;
+    using output_buffer_t = heterogeneous_buffer_t;
+
+    /**
+     * @brief Create an instance of a buffer of a given size.
+     *
+     * @param size  The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t allocate_input( std::size_t n ) const
+    {
+        return shared_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given input buffer.
+     *
+     * The old buffer is reused only if it is not shared
+     * (otherwise the data of slices would be overwritten).
+     *
+     * @param old_buf  The old buffer we might reuse (with ownership).
+     * @param size     The size of a requested buffer.
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t reallocate_input( input_buffer_t old_buf,
+                                                   std::size_t n ) const
+    {
+        if( 1 == old_buf.use_count() ) [[likely]]
+        {
+            // use_count() is a relaxed load, so synchronize with
+            // the release of the last slice (it might happen on other thread).
+            std::atomic_thread_fence( std::memory_order_acquire );
+            old_buf.resize_drop_data( n );
+            return old_buf;
+        }
+
+        return shared_buffer_t{ n };
+    }
+
+    /**
+     * @brief Resize a given input buffer.
+     *
+     * @param old_buf  The old buffer we might reuse (with ownership).
+     * @param size     The ruduced size for a buffer to represent.
+     *
+     * @pre `old_buf.size() >= n`
+     *
+     * @return An instance of a buffer of a given size.
+     */
+    [[nodiscard]] input_buffer_t reduce_size_input( input_buffer_t old_buf,
+                                                    std::size_t n ) const noexcept
+    {
+        old_buf.shrink_size( n );
+        return old_buf;
+    }
+
+    using heterogeneous_buffer_driver_t::make_asio_const_buffer;
+    using heterogeneous_buffer_driver_t::make_asio_mutable_buffer;
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::const_buffer make_asio_const_buffer(
+        const input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_const_buffer();
+    }
+
+    /**
+     * @brief Create a buffer reference that is understood by ASIO.
+     *
+     * @param buf  A reference to buffer for which to create asio's one.
+     *
+     * @return An instance of ASIO buffer.
+     */
+    [[nodiscard]] static asio_ns::mutable_buffer make_asio_mutable_buffer(
+        input_buffer_t & buf ) noexcept
+    {
+        return buf.make_asio_mutable_buffer();
+    }
+};
+
+static_assert( Buffer_Driver_Concept< shared_buffer_driver_t > );
+
+}  // namespace opio::net
@@ -0,0 +1,120 @@
+/**
+ * @file
+ *
+ * This header file contains a lock-free bounded
+ * single-producer-single-consumer queue of buffers.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <optional>
+
+namespace opio::net
+{
+
+//
+// spsc_buffers_queue_t
+//
+
+/**
+ * @brief Lock-free bounded single-producer-single-consumer queue of buffers.
+ *
+ * Is intended for passing buffers back and forth between two
+ * parties each of which runs its operations sequentially
+ * (for example, on its own strand).
+ * Both parties never block: producer fails to push if queue is full
+ * and consumer fails to pop if queue is empty.
+ *
+ * @tparam Buffer    Type of buffer. Must be default constructible and movable.
+ * @tparam Capacity  Capacity of the queue. Must be a power of 2.
+ */
+template < typename Buffer, std::size_t Capacity = 4 >
+class spsc_buffers_queue_t
+{
+    static_assert( 0 < Capacity && 0 == ( Capacity & ( Capacity - 1 ) ),
+                   "Capacity must be a power of 2" );
+
+public:
+    using buffer_t = Buffer;
+
+    spsc_buffers_queue_t() = default;
+
+    spsc_buffers_queue_t( const spsc_buffers_queue_t & ) = delete;
+    spsc_buffers_queue_t( spsc_buffers_queue_t && )      = delete;
+    spsc_buffers_queue_t & operator=( const spsc_buffers_queue_t & ) = delete;
+    spsc_buffers_queue_t & operator=( spsc_buffers_queue_t && ) = delete;
+
+    /**
+     * @brief Try to push a buffer to the queue.
+     *
+     * Must be called by a single producer at a time.
+     *
+     * @param buf  A buffer to push. It is moved from only in case of success.
+     *
+     * @return True if the buffer was pushed, false if queue is full.
+     */
+    bool try_push( buffer_t & buf ) noexcept
+    {
+        const auto tail = m_tail.load( std::memory_order_relaxed );
+        if( Capacity == tail - m_head.load( std::memory_order_acquire ) )
+        {
+            return false;
+        }
+
+        m_slots[ tail % Capacity ] = std::move( buf );
+        m_tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    /**
+     * @brief Try to pop a buffer from the queue.
+     *
+     * Must be called by a single consumer at a time.
+     *
+     * @return A buffer or nothing if queue is empty.
+     */
+    [[nodiscard]] std::optional< buffer_t > try_pop() noexcept
+    {
+        const auto head = m_head.load( std::memory_order_relaxed );
+        if( head == m_tail.load( std::memory_order_acquire ) )
+        {
+            return std::nullopt;
+        }
+
+        std::optional< buffer_t > res{ std::move( m_slots[ head % Capacity ] ) };
+        m_head.store( head + 1, std::memory_order_release );
+        return res;
+    }
+
+    /**
+     * @brief Get the number of buffers in the queue.
+     *
+     * @note The result is only a hint if the other party is running.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_tail.load( std::memory_order_acquire )
+               - m_head.load( std::memory_order_acquire );
+    }
+
+private:
+    /**
+     * @brief Position of the next buffer to pop.
+     *
+     * Written by consumer only.
+     */
+    alignas( 64 ) std::atomic< std::size_t > m_head{ 0 };
+
+    /**
+     * @brief Position of the next buffer to push.
+     *
+     * Written by producer only.
+     */
+    alignas( 64 ) std::atomic< std::size_t > m_tail{ 0 };
+
+    std::array< buffer_t, Capacity > m_slots{};
+};
+
+}  // namespace opio::net
@@ -26,7 +26,8 @@ struct noop_stats_driver_t
     /**
      * @brief Increment incoming traffic counters (sync read from socket).
      *
-     * @note This is not used yet as library doesn't do sync reads.
+     * @note Sync reads are done only if read budget is configured,
+     *       see `connection_cfg_t::read_budget_iterations()`.
      */
     template < typename... Args >
     constexpr void inc_bytes_rx_sync( Args &&... ) const noexcept
@@ -88,6 +89,40 @@ struct noop_stats_driver_t
     constexpr void async_write_finished( Args &&... ) const noexcept
     {
     }
+
+    /**
+     * @brief The number of buffers (iovecs) passed to a write operation
+     *        that is started (sync or async).
+     *
+     * Accumulated value divided by the number of calls gives
+     * the average width of gather write.
+     */
+    template < typename... Args >
+    constexpr void write_iovecs_count( Args &&... ) const noexcept
+    {
+    }
+
+    /**
+     * @brief Read size policy changed the size of read buffers.
+     *
+     * Receives old size and new size.
+     */
+    template < typename... Args >
+    constexpr void read_size_changed( Args &&... ) const noexcept
+    {
+    }
+
+    /**
+     * @brief Connection released its read buffer to wait for data
+     *        without a buffer.
+     *
+     * @note Happens only if zero-buffer idle reads are enabled,
+     *       see `connection_cfg_t::read_buffer_release_threshold()`.
+     */
+    template < typename... Args >
+    constexpr void read_buffer_released( Args &&... ) const noexcept
+    {
+    }
 };
 
 }  // namespace opio::net
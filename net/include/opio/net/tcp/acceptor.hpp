@@ -6,6 +6,14 @@
 
 #pragma once
 
+#include <array>
+#include <cerrno>
+
+#if defined( __linux__ )
+#    include <linux/filter.h>
+#    include <sys/socket.h>
+#endif  // defined( __linux__ )
+
 #include <opio/log.hpp>
 
 #include <opio/net/asio_include.hpp>
@@ -50,13 +58,14 @@ class acceptor_t : public std::enable_shared_from_this< acceptor_t< Logger > >
 public:
     acceptor_t( asio_ns::any_io_executor executor,
                 asio_ns::ip::tcp::endpoint endpoint,
+                const acceptor_options_cfg_t & acceptor_options_cfg,
                 const socket_options_cfg_t & socket_options_cfg,
                 Logger logger,
                 on_accept_cb_t on_accept_cb )
         : m_executor{ std::move( executor ) }
-        , m_socket{ m_executor }
         , m_acceptor{ m_executor }
         , m_endpoint{ std::move( endpoint ) }
+        , m_acceptor_options_cfg{ acceptor_options_cfg }
         , m_socket_options_cfg{ socket_options_cfg }
         , m_logger{ std::move( logger ) }
         , m_on_accept_cb{ std::move( on_accept_cb ) }
@@ -64,6 +73,20 @@ public:
         assert( m_on_accept_cb );
     }
 
+    acceptor_t( asio_ns::any_io_executor executor,
+                asio_ns::ip::tcp::endpoint endpoint,
+                const socket_options_cfg_t & socket_options_cfg,
+                Logger logger,
+                on_accept_cb_t on_accept_cb )
+        : acceptor_t{ std::move( executor ),
+                      std::move( endpoint ),
+                      acceptor_options_cfg_t{},
+                      socket_options_cfg,
+                      std::move( logger ),
+                      std::move( on_accept_cb ) }
+    {
+    }
+
     acceptor_t( asio_ns::any_io_executor executor,
                 asio_ns::ip::tcp::endpoint endpoint,
                 Logger logger,
@@ -120,6 +143,19 @@ public:
         return m_endpoint;
     }
 
+    /**
+     * @brief Get an endpoint the acceptor is bound to.
+     *
+     * Unlike `endpoint()` it has an actual port if the acceptor
+     * was given port 0.
+     *
+     * @pre Is called on acceptor's executor after it is opened.
+     */
+    [[nodiscard]] asio_ns::ip::tcp::endpoint local_endpoint() const
+    {
+        return m_acceptor.local_endpoint();
+    }
+
 private:
     /**
      * @brief A helper routine to call user provided open/close handler.
@@ -177,10 +213,25 @@ private:
                     true );
                 m_acceptor.set_option( reuse_address_option );
 
+                if( m_acceptor_options_cfg.reuse_port )
+                {
+                    set_reuse_port_option();
+                }
+
                 m_acceptor.bind( m_endpoint );
 
                 m_acceptor.listen( asio_ns::socket_base::max_listen_connections );
 
+                if( 0 != m_acceptor_options_cfg.reuse_port_cpu_steering )
+                {
+                    attach_reuse_port_cpu_steering();
+                }
+
+                if( batch_accept_mode() )
+                {
+                    m_acceptor.non_blocking( true );
+                }
+
                 accept_next();
 
                 m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
@@ -202,6 +253,69 @@ private:
         }
     }
 
+    /**
+     * @brief Set SO_REUSEPORT option on listening socket.
+     */
+    void set_reuse_port_option()
+    {
+#if defined( SO_REUSEPORT )
+        using reuse_port_t =
+            asio_ns::detail::socket_option::boolean< SOL_SOCKET, SO_REUSEPORT >;
+        m_acceptor.set_option( reuse_port_t{ true } );
+#else
+        m_logger.warn( OPIO_SRC_LOCATION,
+                       "SO_REUSEPORT is not supported on this platform" );
+#endif  // defined( SO_REUSEPORT )
+    }
+
+    /**
+     * @brief Attach a BPF program that steers connections of a reuseport
+     *        group to a listener by CPU handling the packet.
+     *
+     * Failure is not fatal: kernel would balance connections
+     * by hash in that case.
+     */
+    void attach_reuse_port_cpu_steering()
+    {
+#if defined( SO_ATTACH_REUSEPORT_CBPF )
+        // clang-format off
+        std::array< sock_filter, 3 > code{ {
+            // A = cpu
+            { BPF_LD | BPF_W | BPF_ABS, 0, 0,
+              static_cast< std::uint32_t >( SKF_AD_OFF + SKF_AD_CPU ) },
+            // A = A % group_size
+            { BPF_ALU | BPF_MOD | BPF_K, 0, 0,
+              m_acceptor_options_cfg.reuse_port_cpu_steering },
+            // return A
+            { BPF_RET | BPF_A, 0, 0, 0 } } };
+        // clang-format on
+
+        sock_fprog prog{};
+        prog.len    = static_cast< unsigned short >( code.size() );
+        prog.filter = code.data();
+
+        if( 0
+            != ::setsockopt( m_acceptor.native_handle(),
+                             SOL_SOCKET,
+                             SO_ATTACH_REUSEPORT_CBPF,
+                             &prog,
+                             sizeof( prog ) ) )
+        {
+            m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "Failed to attach reuseport cpu steering "
+                           "program on {}: errno={}",
+                           m_endpoint,
+                           errno );
+            } );
+        }
+#else
+        m_logger.warn(
+            OPIO_SRC_LOCATION,
+            "reuseport cpu steering is not supported on this platform" );
+#endif  // defined( SO_ATTACH_REUSEPORT_CBPF )
+    }
+
     /**
      * @brief An imlementaion of close operation executed on ASIO context.
      */
@@ -245,16 +359,64 @@ private:
         }
     }
 
+    /**
+     * @brief Whether the backlog is drained in batches.
+     */
+    [[nodiscard]] bool batch_accept_mode() const noexcept
+    {
+        return 1 < m_acceptor_options_cfg.accept_batch_budget;
+    }
+
+    /**
+     * @brief Get an executor for a socket to be accepted.
+     *
+     * Falls back to the executor of the acceptor if picker fails.
+     */
+    [[nodiscard]] asio_ns::any_io_executor pick_socket_executor()
+    {
+        if( m_acceptor_options_cfg.socket_executor_picker )
+        {
+            try
+            {
+                return m_acceptor_options_cfg.socket_executor_picker();
+            }
+            catch( const std::exception & ex )
+            {
+                m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                    format_to( out,
+                               "Failed to pick executor for a socket: {}",
+                               ex.what() );
+                } );
+            }
+        }
+        return m_executor;
+    }
+
     /**
      * @brief Start a next iteration of accepting ne connection.
      */
     void accept_next()
     {
+        if( batch_accept_mode() )
+        {
+            m_acceptor.async_wait(
+                asio_ns::ip::tcp::acceptor::wait_read,
+                [ wp = this->weak_from_this() ]( const auto & ec ) {
+                    if( auto self = wp.lock(); self )
+                    {
+                        self->on_readable( ec );
+                    }
+                } );
+            return;
+        }
+
         m_acceptor.async_accept(
-            m_socket, [ wp = this->weak_from_this() ]( const auto & ec ) {
+            pick_socket_executor(),
+            [ wp = this->weak_from_this() ]( const auto & ec,
+                                             asio_ns::ip::tcp::socket socket ) {
                 if( auto self = wp.lock(); self )
                 {
-                    self->on_connection( ec );
+                    self->on_connection( ec, std::move( socket ) );
                 }
             } );
     }
@@ -265,9 +427,85 @@ private:
      * @param ec      Result of accepting new socket.
      * @param socket  Socket instance containing new connection.
      */
-    void on_connection( const asio_ns::error_code & ec )
+    void on_connection( const asio_ns::error_code & ec,
+                        asio_ns::ip::tcp::socket socket )
+    {
+        if( handle_accepted( ec, std::move( socket ) ) )
+        {
+            accept_next();
+        }
+    }
+
+    /**
+     * @brief Drain the backlog when listening socket is readable.
+     *
+     * Accepts up to `accept_batch_budget` sockets with non-blocking accepts,
+     * each socket is accepted onto the executor picked
+     * right before accepting it.
+     *
+     * @param ec  Result of waiting.
+     */
+    void on_readable( const asio_ns::error_code & ec )
+    {
+        if( ec == asio_ns::error::operation_aborted )
+        {
+            m_logger.trace( OPIO_SRC_LOCATION, "Accepting connection aborted" );
+            return;
+        }
+
+        if( ec ) [[unlikely]]
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "Waiting for connections failed: ec={}",
+                           fmt_integrator( ec ) );
+            } );
+            accept_next();
+            return;
+        }
+
+        std::size_t accepted_count = 0;
+        for( ; accepted_count < m_acceptor_options_cfg.accept_batch_budget;
+             ++accepted_count )
+        {
+            asio_ns::error_code accept_ec;
+            auto socket = m_acceptor.accept( pick_socket_executor(), accept_ec );
+
+            if( accept_ec == asio_ns::error::would_block
+                || accept_ec == asio_ns::error::try_again )
+            {
+                break;
+            }
+
+            if( !handle_accepted( accept_ec, std::move( socket ) ) )
+            {
+                return;
+            }
+
+            if( accept_ec ) [[unlikely]]
+            {
+                break;
+            }
+        }
+
+        m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out, "Accepted {} connection(s) in batch", accepted_count );
+        } );
+
+        accept_next();
+    }
+
+    /**
+     * @brief Handle the result of accepting a socket.
+     *
+     * @param ec      Result of accepting new socket.
+     * @param socket  Socket instance containing new connection.
+     *
+     * @return False if accepting was aborted (acceptor is closed).
+     */
+    bool handle_accepted( const asio_ns::error_code & ec,
+                          asio_ns::ip::tcp::socket socket )
     {
-        asio_ns::ip::tcp::socket socket{ std::move( m_socket ) };
         try
         {
             if( !ec )
@@ -284,7 +522,7 @@ private:
             {
                 m_logger.trace( OPIO_SRC_LOCATION,
                                 "Accepting connection aborted" );
-                return;
+                return false;
             }
             else
             {
@@ -304,14 +542,14 @@ private:
                            ex.what() );
             } );
         }
-        accept_next();
+        return true;
     }
 
     asio_ns::any_io_executor m_executor;
-    asio_ns::ip::tcp::socket m_socket;
     asio_ns::ip::tcp::acceptor m_acceptor;
     const asio_ns::ip::tcp::endpoint m_endpoint;
 
+    const acceptor_options_cfg_t m_acceptor_options_cfg;
     const socket_options_cfg_t m_socket_options_cfg;
     Logger m_logger;
     on_accept_cb_t m_on_accept_cb;
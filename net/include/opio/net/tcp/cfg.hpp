@@ -6,6 +6,7 @@
 
 #include <string>
 #include <cstdint>
+#include <functional>
 #include <optional>
 
 #include <opio/net/asio_include.hpp>
@@ -41,6 +42,56 @@ struct socket_options_cfg_t
     }
 };
 
+//
+//  acceptor_options_cfg_t
+//
+
+/**
+ * @brief Options of a listening socket.
+ */
+struct acceptor_options_cfg_t
+{
+    /**
+     * @brief Allow several listening sockets on the same endpoint
+     *        (SO_REUSEPORT), kernel balances connections between them.
+     */
+    bool reuse_port{ false };
+
+    /**
+     * @brief Steer connections of a reuseport group by CPU.
+     *
+     * If not zero, a BPF program is attached to the reuseport group
+     * of the listener, so that a new connection goes to the listener
+     * with index `cpu % reuse_port_cpu_steering` (listeners are indexed
+     * in order they were opened) where `cpu` is the CPU that handles
+     * the incoming packet.
+     *
+     * @note Linux only, ignored (with a warning) on other platforms.
+     */
+    std::uint32_t reuse_port_cpu_steering{};
+
+    /**
+     * @brief The max number of sockets accepted per wakeup.
+     *
+     * If greater than 1, acceptor waits for the listening socket
+     * to become readable and then drains the backlog with non-blocking
+     * accepts (up to a given number of sockets) before waiting again.
+     * Helps to handle reconnect storms when a lot of clients
+     * pile up in the backlog.
+     */
+    std::size_t accept_batch_budget{ 1 };
+
+    /**
+     * @brief Picks an executor for a socket to be accepted.
+     *
+     * If set, each socket is accepted directly onto the returned executor
+     * (e.g. the least loaded context of asio_thread_pool_t,
+     * see asio_thread_pool_t::pick_executor()).
+     * Otherwise sockets run on the executor of the acceptor.
+     */
+    std::function< asio_ns::any_io_executor() > socket_executor_picker;
+};
+
 //
 // tcp_resolver_query_t
 //
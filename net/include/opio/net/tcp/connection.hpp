@@ -9,15 +9,17 @@
 
 #include <vector>
 #include <array>
-#include <queue>
+#include <atomic>
+#include <bit>
 #include <string>
 #include <type_traits>
 #include <optional>
 #include <span>
+#include <memory>
 
 #if defined( OPIO_USE_BOOST_ASIO )
 #    include <boost/function.hpp>
-#    include <boost/container/static_vector.hpp>
+#    include <boost/container/small_vector.hpp>
 #else  // defined( OPIO_USE_BOOST_ASIO )
 #    include <functional>
 #endif  // defined( OPIO_USE_BOOST_ASIO )
@@ -30,9 +32,13 @@
 #include <opio/net/stats.hpp>
 #include <opio/net/operation_watchdog.hpp>
 #include <opio/net/locking.hpp>
+#include <opio/net/intrusive_mpsc_queue.hpp>
 #include <opio/net/tcp/connection_id.hpp>
 #include <opio/net/tcp/utils.hpp>
 #include <opio/net/tcp/error_code.hpp>
+#include <opio/net/tcp/gather_write.hpp>
+#include <opio/net/tcp/read_size_policy.hpp>
+#include <opio/net/tcp/zerocopy.hpp>
 
 #if !defined( OPIO_NET_QUIK_SYNC_WRITE_HEURISTIC_SIZE )
 // This defines do we consider a given buffer for write-to-socket
@@ -152,8 +158,10 @@ constexpr std::size_t quik_sync_write_heuristic_size =
     OPIO_NET_QUIK_SYNC_WRITE_HEURISTIC_SIZE;
 
 /**
- * @brief The maximum number of buffers that can be written with
- *        gather write operation.
+ * @brief The default maximum number of buffers that are written with
+ *        a single gather write operation.
+ *
+ * @see connection_cfg_t::max_iov_per_write().
  */
 constexpr auto reasonable_max_iov_len() noexcept
 {
@@ -180,7 +188,8 @@ using buf_descriptors_span_t = std::span< asio_ns::const_buffer >;
  *
  * Incapsulates a sequence of buffers. Controls the number of buffers
  * to allow storage of number of buffers possible to be sent with
- * gather write.
+ * gather write. The limit is set on construction and the storage
+ * is allocated once for it.
  *
  * Inside the connection_t class there is a queue of such items.
  *
@@ -203,12 +212,27 @@ template < typename Buffer_Driver,
 class single_writable_sequence_t
 {
 public:
-    static auto constexpr max_seq_length = reasonable_max_iov_len();
-
     static constexpr std::size_t concatenated_buffer_max_size =
         Concatenated_Buffer_Max_Size;
 
     using buffer_t = typename Buffer_Driver::output_buffer_t;
+
+    /**
+     * @param max_length  The maximum number of buffers in sequence.
+     */
+    explicit single_writable_sequence_t(
+        std::size_t max_length = reasonable_max_iov_len() )
+        : m_max_length{ max_length }
+    {
+        assert( 0 < m_max_length );
+        allocate_storage();
+    }
+
+    /**
+     * @brief The maximum number of buffers in sequence.
+     */
+    [[nodiscard]] std::size_t max_length() const noexcept { return m_max_length; }
+
     /**
      * @brief Check if it is possible to append to this write operation.
      *
@@ -226,7 +250,7 @@ public:
         assert( n < std::numeric_limits< decltype( n ) >::max()
                         - m_bufs_storage.size() );
 
-        return m_bufs_storage.size() + n <= max_seq_length;
+        return m_bufs_storage.size() + n <= m_max_length;
     }
 
     /**
@@ -243,6 +267,32 @@ public:
         m_bufs_storage.emplace_back( std::move( buf ) );
     }
 
+    /**
+     * @brief Drop all buffers and callbacks.
+     *
+     * Makes the sequence ready to be used for the next write operation
+     * keeping the storage that was already allocated.
+     */
+    void reset()
+    {
+        m_bufs_storage.clear();
+        m_send_completion_cbs.clear();
+
+        if( m_asio_bufs.size() != m_max_length ) [[unlikely]]
+        {
+            // Storage was moved out.
+            allocate_storage();
+        }
+    }
+
+    /**
+     * @brief Check if one more completion callback can be appended.
+     */
+    [[nodiscard]] bool can_append_completion_cb() const noexcept
+    {
+        return m_send_completion_cbs.size() < m_max_length;
+    }
+
     /**
      * @brief Append notificator to a given sequence of buffers.
      *
@@ -254,7 +304,7 @@ public:
      */
     void append_completion_cb( send_complete_cb_t cb )
     {
-        assert( m_send_completion_cbs.size() < max_seq_length );
+        assert( can_append_completion_cb() );
         m_send_completion_cbs.emplace_back( std::move( cb ) );
     }
 
@@ -349,21 +399,19 @@ public:
     void concat_small_buffers( Buffer_Driver & buffer_driver );
 
 private:
-#if defined( OPIO_USE_BOOST_ASIO )
-    using buf_starage_options_t = boost::container::static_vector_options_t<
-        boost::container::throw_on_overflow< false > >;
+    void allocate_storage()
+    {
+        m_bufs_storage.reserve( m_max_length );
+        m_asio_bufs.resize( m_max_length );
+        m_send_completion_cbs.reserve( m_max_length );
+    }
 
-    using bufs_container_t = boost::container::
-        static_vector< buffer_t, max_seq_length, buf_starage_options_t >;
-    using send_completion_cbs_container_t = boost::container::
-        static_vector< send_complete_cb_t, max_seq_length, buf_starage_options_t >;
-#else   // defined( OPIO_USE_BOOST_ASIO )
     using bufs_container_t                = std::vector< buffer_t >;
     using send_completion_cbs_container_t = std::vector< send_complete_cb_t >;
-#endif  // defined( OPIO_USE_BOOST_ASIO )
 
+    std::size_t m_max_length;
     bufs_container_t m_bufs_storage;
-    std::array< asio_ns::const_buffer, max_seq_length > m_asio_bufs;
+    std::vector< asio_ns::const_buffer > m_asio_bufs;
     send_completion_cbs_container_t m_send_completion_cbs;
 };
 
@@ -490,240 +538,851 @@ inline buf_descriptors_span_t skip_transferred_part( buf_descriptors_span_t bufs
     return res;
 }
 
-}  // namespace details
-
 //
-// connection_cfg_t
+// recycling_ring_t
 //
 
 /**
- * @brief Connection settings.
+ * @brief A FIFO ring of recycled items.
  *
- * Incapsulates adjustments parameters for connection_t.
- * and comes with a handy fluent-interface:
- * @code
- * auto make_connection( socket_t socket, ... )
- * {
- *     return std::make_shared< connection_t >(
- *         std::move( socket ),
- *         opio::net::tcp::connection_cfg_t{}
- *          .input_buffer_size( 4096 )
- *          .write_timeout_per_1mb( std::chrono::milliseconds( 100 ) );
- * }
- * @code
+ * A replacement for `std::queue` that never destroys popped items:
+ * an item is reset (`T::reset()`) and its slot is reused by the following
+ * `push()`. So with a steady load items (and the storage they own)
+ * are allocated once and then recycled.
+ *
+ * Items are allocated individually and the ring stores only pointers,
+ * so when the ring grows items stay in place and references
+ * to them remain valid (the same guarantee `std::queue` gives for push/pop).
+ *
+ * @tparam T  Item type. Must be default constructible and have `reset()`.
  */
-class connection_cfg_t
+template < typename T >
+class recycling_ring_t
 {
 public:
-    using timeout_type_t = std::chrono::steady_clock::duration;
-
-    [[nodiscard]] auto input_buffer_size() const noexcept
+    /**
+     * @param initial_capacity  The number of slots to start with
+     *                          (rounded up to the power of 2).
+     */
+    explicit recycling_ring_t( std::size_t initial_capacity = 4 )
+        : m_slots(
+            std::bit_ceil( std::max< std::size_t >( initial_capacity, 1 ) ) )
     {
-        return m_input_buffer_size;
     }
-    connection_cfg_t & input_buffer_size( std::size_t value ) & noexcept
-    {
-        assert( value > 0 );
-        m_input_buffer_size = value;
-        return *this;
-    };
-    connection_cfg_t && input_buffer_size( std::size_t value ) && noexcept
+
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_slots.size(); }
+
+    [[nodiscard]] T & front() noexcept
     {
-        return std::move( this->input_buffer_size( value ) );
+        assert( !empty() );
+        return *m_slots[ m_head ];
     }
 
-    [[nodiscard]] auto write_timeout_per_1mb() const noexcept
+    [[nodiscard]] T & back() noexcept
     {
-        return m_write_timeout_per_1mb;
+        assert( !empty() );
+        return *m_slots[ slot_index( m_size - 1 ) ];
     }
-    connection_cfg_t & write_timeout_per_1mb( timeout_type_t value ) & noexcept
-    {
-        if( value > std::chrono::seconds::zero() )
-        {
-            // It should be a non zero value.
-            m_write_timeout_per_1mb = value;
-        }
-        return *this;
-    };
-    connection_cfg_t && write_timeout_per_1mb( timeout_type_t value ) && noexcept
+
+    /**
+     * @brief Access i-th item counting from the front.
+     */
+    [[nodiscard]] T & operator[]( std::size_t i ) noexcept
     {
-        return std::move( this->write_timeout_per_1mb( value ) );
+        assert( i < m_size );
+        return *m_slots[ slot_index( i ) ];
     }
 
     /**
-     * @brief Calculate timeout for a specific amount of data.
+     * @brief Add an item to the end of the ring.
      *
-     * @param  buffer_size_bytes  Size of data measured in bytes.
-     * @return                    Returns `(data in mb) * write_timeout_per_1mb`
-     *                            if data size is greater than 1 mb,
-     *                            otherwise return 0.
+     * @param args  Constructor arguments for the case a new item
+     *              has to be created (ignored if an item is recycled).
+     *
+     * @return A reference to added item (which is in a reset state).
      */
-    timeout_type_t make_write_timeout_per_buffer(
-        std::size_t buffer_size_bytes ) const noexcept
+    template < typename... Args >
+    T & push( Args &&... args )
     {
-        constexpr std::size_t size_1mb           = 1024 * 1024;
-        constexpr std::size_t adjust_for_ceiling = size_1mb - 1;
-
-        if( size_1mb >= buffer_size_bytes )
+        if( m_size == m_slots.size() ) [[unlikely]]
         {
-            // First quick option:
-            return m_write_timeout_per_1mb;
+            grow();
         }
-        else
+
+        auto & slot = m_slots[ slot_index( m_size ) ];
+        if( !slot ) [[unlikely]]
         {
-            // It is a conscious div 1mb (which is power of 2),
-            // as compilers would optimize it to bit shift,
-            // thus giving fast math.
-            return ( ( buffer_size_bytes + adjust_for_ceiling ) / size_1mb )
-                   * m_write_timeout_per_1mb;
+            slot = std::make_unique< T >( std::forward< Args >( args )... );
         }
+
+        ++m_size;
+        return *slot;
+    }
+
+    /**
+     * @brief Remove the first item (it is reset and kept for reuse).
+     */
+    void pop()
+    {
+        front().reset();
+        m_head = slot_index( 1 );
+        --m_size;
     }
 
 private:
-    static constexpr std::size_t default_input_buffer_size = 256 * 1024;
-    std::size_t m_input_buffer_size{ default_input_buffer_size };
+    [[nodiscard]] std::size_t slot_index( std::size_t i ) const noexcept
+    {
+        return ( m_head + i ) & ( m_slots.size() - 1 );
+    }
 
-    static constexpr timeout_type_t default_write_timeout_per_1mb =
-        std::chrono::seconds{ 1 };
-    timeout_type_t m_write_timeout_per_1mb{ default_write_timeout_per_1mb };
+    void grow()
+    {
+        std::vector< std::unique_ptr< T > > slots( m_slots.size() * 2 );
+        for( std::size_t i = 0; i < m_slots.size(); ++i )
+        {
+            slots[ i ] = std::move( m_slots[ slot_index( i ) ] );
+        }
+
+        m_slots = std::move( slots );
+        m_head  = 0;
+    }
+
+    std::vector< std::unique_ptr< T > > m_slots;
+    std::size_t m_head{};
+    std::size_t m_size{};
 };
 
-// A forward declaration of connection.
-template < typename Traits >
-class connection_t;
+//
+// send_submission_t
+//
+
+/**
+ * @brief An item of connection's submission queue.
+ *
+ * Carries a group of buffers submitted for sending from arbitrary thread
+ * (and an optional send-completion callback for them).
+ *
+ * @tparam Buffer  Output buffer type.
+ */
+template < typename Buffer >
+struct send_submission_t
+{
+#if defined( OPIO_USE_BOOST_ASIO )
+    using bufs_container_t = boost::container::small_vector< Buffer, 4 >;
+#else   // defined( OPIO_USE_BOOST_ASIO )
+    using bufs_container_t = std::vector< Buffer >;
+#endif  // defined( OPIO_USE_BOOST_ASIO )
+
+    /**
+     * @brief Intrusive link for intrusive_mpsc_queue_t.
+     */
+    send_submission_t * next{};
+
+    bufs_container_t bufs;
+    send_complete_cb_t cb;
+};
 
 //
-// input_ctx_t
+// send_submission_pool_t
 //
 
 /**
- * @brief Input context.
+ * @brief A lock-free freelist of connection's submission queue items.
  *
- * Acts as a parameter for input handler which is an entry
- * point for user defined input data handling routine.
+ * Items are taken by threads submitting buffers and are given back
+ * by the connection once it consumed them (on io thread), so a steady
+ * `submit_send()` load doesn't imply an allocation per call
+ * (the storage for buffers is reused too).
+ * A new item is allocated only if the freelist is empty.
  *
- * Gives input handler implementation access to a obtained buffer
- * and also provides access to logger and connection by references.
- * So handler can do some logging and is able to manipulate connection.
+ * Free items are kept in a fixed array of slots. An item is taken
+ * with a single exchange on a slot and put with a single CAS,
+ * so the ownership of an item moves atomically: there is no ABA problem
+ * and no item is accessed by a thread that doesn't own it.
  *
- * @tparam Traits  Traits class of associated connection.
+ * @tparam Buffer  Output buffer type.
  */
-template < typename Traits >
-class input_ctx_t
+template < typename Buffer >
+class send_submission_pool_t
 {
 public:
-    using source_connection_t = connection_t< Traits >;
-    using buffer_t            = typename source_connection_t::input_buffer_t;
-    using logger_t            = typename source_connection_t::logger_t;
+    using submission_t = send_submission_t< Buffer >;
 
-private:
-    // Gives access to connection class:
-    friend class connection_t< Traits >;
+    //! The max number of items kept for reuse.
+    static constexpr std::size_t max_free_count = 64;
 
-    input_ctx_t( buffer_t buf,
-                 logger_t & logger,
-                 source_connection_t & connection )
-        : m_buffer{ std::move( buf ) }
-        , m_logger{ logger }
-        , m_connection{ connection }
+    send_submission_pool_t() = default;
+
+    send_submission_pool_t( const send_submission_pool_t & ) = delete;
+    send_submission_pool_t & operator=( const send_submission_pool_t & ) = delete;
+
+    ~send_submission_pool_t()
     {
+        for( auto & slot : m_slots )
+        {
+            std::unique_ptr< submission_t > submission{
+                slot.load( std::memory_order_relaxed )
+            };
+        }
     }
 
-    // This would demand input handlers to receive input_ctx_t
-    // only by reference.
-    input_ctx_t( const input_ctx_t & ) = delete;
-    input_ctx_t( input_ctx_t && )      = delete;
-    input_ctx_t & operator=( const input_ctx_t & ) = delete;
-    input_ctx_t & operator=( input_ctx_t && ) = delete;
-
-public:
     /**
-     * @brief Access input buffer by reference.
-     *
-     * The buffer references raw data read from socket.
-     * By default the size of the buffer is at most what is
-     * the default `input_buffer_size` (see @c connection_cfg_t)
-     * passed into sonstructor of source_connection_t.
-     * But that can be customized with input_ctx_t::next_read_buffer.
-     *
-     * The exact size of data depends on how much data was received from
-     * peer and accumulated for the underlying socket at the moment
-     * IO event happened.
-     *
-     * @note Buffer migh be moved,
-     *       thus next time an empty buffer will be returned.
-     *
-     * @code
-     * auto make_input_handler() {
-     *     return [ & ]( source_connection_t<Traits>::input_ctx_t & ctx ) {
-     *         // Echo:
-     *         ctx.connection().schedule_send( std::move( ctx.buf() ) );
-     *     }
-     * }
-     * @endcode
+     * @brief Get an empty item.
      *
-     * @return reference to buffer object.
+     * Can be called from any thread.
      */
-    [[nodiscard]] buffer_t & buf() noexcept { return m_buffer; }
+    [[nodiscard]] std::unique_ptr< submission_t > acquire()
+    {
+        // Items are put starting from the first slot,
+        // so free items are usually found right away.
+        for( auto & slot : m_slots )
+        {
+            if( nullptr == slot.load( std::memory_order_relaxed ) )
+            {
+                continue;
+            }
 
-    /**
-     * @brief Get a reference to logger.
-     *
-     * This allows user provided handler to log to the same log that
-     * source_connection_t logs to.
-     */
-    [[nodiscard]] logger_t & log() noexcept { return m_logger; };
+            if( auto * s = slot.exchange( nullptr, std::memory_order_acquire );
+                nullptr != s ) [[likely]]
+            {
+                s->next = nullptr;
+                return std::unique_ptr< submission_t >{ s };
+            }
+        }
 
-    /**
-     * @brief Get a reference to connection.
-     *
-     * This allows user provided handler to log to the same log that
-     * source_connection_t logs to.
-     */
-    [[nodiscard]] source_connection_t & connection() noexcept
-    {
-        return m_connection;
-    };
+        return std::make_unique< submission_t >();
+    }
 
     /**
-     * @brief Explicitly set next buffer.
+     * @brief Give back a list of consumed items.
      *
-     * This function allows to override default behaviour regarding
-     * input read buffer size and also regarding what is the source of
-     * such buffer (by defaul a new buffer "vector<char>" is created).
-     * If, based on something (the data in a given buffer), user
-     * decides that the next buffer can be of some specific size
-     * or of some specific source it can handle it using this function
+     * Items that don't fit free slots are deleted.
      *
-     * @param buf  Next buffer that would be used for read operation.
+     * @param head  The first item of a list linked with `next`.
      */
-    void next_read_buffer( buffer_t buf ) noexcept
+    void recycle( submission_t * head ) noexcept
     {
-        m_next_read_buffer = std::move( buf );
+        std::size_t i = 0;
+        while( nullptr != head )
+        {
+            std::unique_ptr< submission_t > submission{ head };
+            head = head->next;
+
+            submission->bufs.clear();
+            submission->cb = send_complete_cb_t{};
+
+            for( ; i < m_slots.size(); ++i )
+            {
+                submission_t * expected = nullptr;
+                if( m_slots[ i ].compare_exchange_strong(
+                        expected,
+                        submission.get(),
+                        std::memory_order_release,
+                        std::memory_order_relaxed ) )
+                {
+                    submission.release();
+                    ++i;
+                    break;
+                }
+            }
+        }
     }
-    ///@}
 
 private:
-    buffer_t m_buffer;
-    logger_t & m_logger;
-    source_connection_t & m_connection;
-    std::optional< buffer_t > m_next_read_buffer;
+    std::array< std::atomic< submission_t * >, max_free_count > m_slots{};
 };
 
 //
-// connection_shutdown_reason
+// traits_read_size_policy_t
 //
 
 /**
- * @brief Flags for connection shutdown reason.
+ * @brief Get read size policy of connection traits.
  *
- * Acts as an argument for shutdown handler assigned to connection.
+ * `Traits::read_size_policy_t` is optional, so traits defined before
+ * it was introduced remain valid.
  */
-enum class connection_shutdown_reason
+template < typename Traits >
+struct traits_read_size_policy
 {
-    user_initiated,
-    io_error,
-    eof,
+    using type = fixed_read_size_policy_t;
+};
+
+template < typename Traits >
+requires requires { typename Traits::read_size_policy_t; }
+struct traits_read_size_policy< Traits >
+{
+    using type = typename Traits::read_size_policy_t;
+};
+
+template < typename Traits >
+using traits_read_size_policy_t = typename traits_read_size_policy< Traits >::type;
+
+//
+// has_transient_input_buffers_v
+//
+
+/**
+ * @brief Does buffer driver provide input buffers that are valid only
+ *        until the next read on the same thread.
+ *
+ * Such a driver declares `static constexpr bool transient_input_buffers`
+ * (see scratch_input_buffer_driver_t).
+ */
+template < typename Buffer_Driver >
+inline constexpr bool has_transient_input_buffers_v = false;
+
+template < typename Buffer_Driver >
+requires requires { Buffer_Driver::transient_input_buffers; }
+inline constexpr bool has_transient_input_buffers_v< Buffer_Driver > =
+    Buffer_Driver::transient_input_buffers;
+
+}  // namespace details
+
+//
+// connection_cfg_t
+//
+
+/**
+ * @brief Connection settings.
+ *
+ * Incapsulates adjustments parameters for connection_t.
+ * and comes with a handy fluent-interface:
+ * @code
+ * auto make_connection( socket_t socket, ... )
+ * {
+ *     return std::make_shared< connection_t >(
+ *         std::move( socket ),
+ *         opio::net::tcp::connection_cfg_t{}
+ *          .input_buffer_size( 4096 )
+ *          .write_timeout_per_1mb( std::chrono::milliseconds( 100 ) );
+ * }
+ * @code
+ */
+class connection_cfg_t
+{
+public:
+    using timeout_type_t = std::chrono::steady_clock::duration;
+
+    [[nodiscard]] auto input_buffer_size() const noexcept
+    {
+        return m_input_buffer_size;
+    }
+    connection_cfg_t & input_buffer_size( std::size_t value ) & noexcept
+    {
+        assert( value > 0 );
+        m_input_buffer_size = value;
+        return *this;
+    };
+    connection_cfg_t && input_buffer_size( std::size_t value ) && noexcept
+    {
+        return std::move( this->input_buffer_size( value ) );
+    }
+
+    /**
+     * @brief The largest buffer size read size policy can go with.
+     *
+     * Matters only for policies that adapt the size of read buffers
+     * (see adaptive_read_size_policy_t), the default policy always
+     * reads with `input_buffer_size()`.
+     */
+    [[nodiscard]] auto max_input_buffer_size() const noexcept
+    {
+        return m_max_input_buffer_size;
+    }
+    connection_cfg_t & max_input_buffer_size( std::size_t value ) & noexcept
+    {
+        m_max_input_buffer_size = value;
+        return *this;
+    }
+    connection_cfg_t && max_input_buffer_size( std::size_t value ) && noexcept
+    {
+        return std::move( this->max_input_buffer_size( value ) );
+    }
+
+    [[nodiscard]] auto write_timeout_per_1mb() const noexcept
+    {
+        return m_write_timeout_per_1mb;
+    }
+    connection_cfg_t & write_timeout_per_1mb( timeout_type_t value ) & noexcept
+    {
+        if( value > std::chrono::seconds::zero() )
+        {
+            // It should be a non zero value.
+            m_write_timeout_per_1mb = value;
+        }
+        return *this;
+    };
+    connection_cfg_t && write_timeout_per_1mb( timeout_type_t value ) && noexcept
+    {
+        return std::move( this->write_timeout_per_1mb( value ) );
+    }
+
+    /**
+     * @brief The size of outgoing buf-sequence starting from which
+     *        it is sent with zero-copy send (`MSG_ZEROCOPY`).
+     *
+     * Zero means zero-copy send is disabled (the default).
+     * With zero-copy the kernel doesn't copy data but pins user buffers
+     * which are kept alive (and send completion callbacks are deferred)
+     * until the kernel notifies it is done with them.
+     * It pays off for large buffers only (tens of KB and more),
+     * as a notification handling is not free.
+     *
+     * @note Supported on Linux only and only for plain tcp socket,
+     *       otherwise the value is ignored.
+     */
+    [[nodiscard]] auto zerocopy_send_threshold() const noexcept
+    {
+        return m_zerocopy_send_threshold;
+    }
+    connection_cfg_t & zerocopy_send_threshold( std::size_t value ) & noexcept
+    {
+        m_zerocopy_send_threshold = value;
+        return *this;
+    };
+    connection_cfg_t && zerocopy_send_threshold( std::size_t value ) && noexcept
+    {
+        return std::move( this->zerocopy_send_threshold( value ) );
+    }
+
+    /**
+     * @brief The maximum number of buffers passed to a single write
+     *        operation (the width of gather write).
+     *
+     * A wider gather write means fewer write syscalls
+     * and fewer concatenations of small buffers when sending
+     * a flow of small messages. For bulk transfers the default
+     * is good enough.
+     *
+     * The value is clamped to `[1, IOV_MAX]`.
+     *
+     * @note A wider than 16 buffers gather write is done
+     *       with a single syscall for sync writes (on Linux),
+     *       async write operation still passes at most 16 buffers
+     *       to a single syscall.
+     */
+    [[nodiscard]] auto max_iov_per_write() const noexcept
+    {
+        return m_max_iov_per_write;
+    }
+    connection_cfg_t & max_iov_per_write( std::size_t value ) & noexcept
+    {
+        m_max_iov_per_write = std::clamp< std::size_t >(
+            value, 1, details::max_gather_write_iov_len() );
+        return *this;
+    };
+    connection_cfg_t && max_iov_per_write( std::size_t value ) && noexcept
+    {
+        return std::move( this->max_iov_per_write( value ) );
+    }
+
+    /**
+     * @brief The longest time outgoing data can be held by connection
+     *        to coalesce small writes (application level corking).
+     *
+     * Zero means coalescing is disabled (the default):
+     * a write is initiated as soon as there is something to write.
+     * Otherwise the data scheduled for sending while no write operation
+     * is running is kept in write queue until one of the limits
+     * is reached: the delay expires, `write_coalescing_bytes()` bytes
+     * or `write_coalescing_buffers()` buffers are pending,
+     * or `connection_t::flush()` is called.
+     * The data accumulated while a write operation is running goes
+     * right after it completes.
+     *
+     * It gives fewer, fuller segments when a burst of small replies
+     * is produced, while `TCP_NODELAY` semantics is kept:
+     * no data waits longer than the delay.
+     *
+     * @note With coalescing turned on no aggressive (sync) writes
+     *       are done on schedule_send() call.
+     */
+    [[nodiscard]] auto write_coalescing_delay() const noexcept
+    {
+        return m_write_coalescing_delay;
+    }
+    connection_cfg_t & write_coalescing_delay(
+        std::chrono::microseconds value ) & noexcept
+    {
+        m_write_coalescing_delay =
+            std::max( value, std::chrono::microseconds::zero() );
+        return *this;
+    };
+    connection_cfg_t && write_coalescing_delay(
+        std::chrono::microseconds value ) && noexcept
+    {
+        return std::move( this->write_coalescing_delay( value ) );
+    }
+
+    /**
+     * @brief The amount of pending bytes starting from which
+     *        coalesced data is written without waiting for delay.
+     *
+     * Zero means no limit.
+     *
+     * @see write_coalescing_delay().
+     */
+    [[nodiscard]] auto write_coalescing_bytes() const noexcept
+    {
+        return m_write_coalescing_bytes;
+    }
+    connection_cfg_t & write_coalescing_bytes( std::size_t value ) & noexcept
+    {
+        m_write_coalescing_bytes = value;
+        return *this;
+    };
+    connection_cfg_t && write_coalescing_bytes( std::size_t value ) && noexcept
+    {
+        return std::move( this->write_coalescing_bytes( value ) );
+    }
+
+    /**
+     * @brief The number of pending buffers starting from which
+     *        coalesced data is written without waiting for delay.
+     *
+     * Zero means the number is limited only by `max_iov_per_write()`.
+     *
+     * @see write_coalescing_delay().
+     */
+    [[nodiscard]] auto write_coalescing_buffers() const noexcept
+    {
+        return m_write_coalescing_buffers;
+    }
+    connection_cfg_t & write_coalescing_buffers( std::size_t value ) & noexcept
+    {
+        m_write_coalescing_buffers = value;
+        return *this;
+    };
+    connection_cfg_t && write_coalescing_buffers( std::size_t value ) && noexcept
+    {
+        return std::move( this->write_coalescing_buffers( value ) );
+    }
+
+    /**
+     * @brief Whether to cork socket (`TCP_CORK`) while coalesced data
+     *        is being written.
+     *
+     * A write of coalesced data might take several syscalls
+     * (e.g. async write passes at most 16 buffers to a single syscall),
+     * with cork set kernel doesn't emit a partial segment after each of them.
+     * Socket is uncorked once there is nothing more to write,
+     * so the tail goes without delay.
+     * It costs two additional syscalls per coalesced write.
+     *
+     * @note Supported on Linux only and only for plain tcp socket,
+     *       otherwise the value is ignored.
+     */
+    [[nodiscard]] auto write_coalescing_use_tcp_cork() const noexcept
+    {
+        return m_write_coalescing_use_tcp_cork;
+    }
+    connection_cfg_t & write_coalescing_use_tcp_cork( bool value ) & noexcept
+    {
+        m_write_coalescing_use_tcp_cork = value;
+        return *this;
+    };
+    connection_cfg_t && write_coalescing_use_tcp_cork( bool value ) && noexcept
+    {
+        return std::move( this->write_coalescing_use_tcp_cork( value ) );
+    }
+
+    /**
+     * @brief The max number of extra non-blocking reads done
+     *        right after an async read completes.
+     *
+     * Zero means no extra reads (the default):
+     * each async read completion handles a single chunk of data
+     * and then a next async read is initiated.
+     * Otherwise connection keeps reading from socket with
+     * non-blocking `read_some()` until it would block or until
+     * the budget (`read_budget_iterations()` reads or
+     * `read_budget_bytes()` bytes) is spent.
+     * That saves a round trip through the reactor for each chunk
+     * when the socket has more data queued.
+     *
+     * The budget is what keeps a single connection that is flooded
+     * with data from starving others running on the same io_context.
+     */
+    [[nodiscard]] auto read_budget_iterations() const noexcept
+    {
+        return m_read_budget_iterations;
+    }
+    connection_cfg_t & read_budget_iterations( std::size_t value ) & noexcept
+    {
+        m_read_budget_iterations = value;
+        return *this;
+    };
+    connection_cfg_t && read_budget_iterations( std::size_t value ) && noexcept
+    {
+        return std::move( this->read_budget_iterations( value ) );
+    }
+
+    /**
+     * @brief The amount of bytes read in a single async read completion
+     *        (including extra non-blocking reads) after which no more extra
+     *        reads are done.
+     *
+     * Zero means no limit by bytes.
+     *
+     * @see read_budget_iterations().
+     */
+    [[nodiscard]] auto read_budget_bytes() const noexcept
+    {
+        return m_read_budget_bytes;
+    }
+    connection_cfg_t & read_budget_bytes( std::size_t value ) & noexcept
+    {
+        m_read_budget_bytes = value;
+        return *this;
+    };
+    connection_cfg_t && read_budget_bytes( std::size_t value ) && noexcept
+    {
+        return std::move( this->read_budget_bytes( value ) );
+    }
+
+    /**
+     * @brief Enables zero-buffer idle reads.
+     *
+     * Zero means the mode is off (the default): connection always holds
+     * a read buffer which is used for an async read operation.
+     *
+     * Otherwise if a read yields less than the threshold bytes,
+     * connection releases its read buffer and waits for socket
+     * to become readable without any buffer (`async_wait(wait_read)`).
+     * The buffer is taken from buffer driver only when data is there.
+     * That saves lots of memory for a large number of mostly idle
+     * connections at the cost of an extra syscall per such wait.
+     */
+    [[nodiscard]] auto read_buffer_release_threshold() const noexcept
+    {
+        return m_read_buffer_release_threshold;
+    }
+    connection_cfg_t & read_buffer_release_threshold(
+        std::size_t value ) & noexcept
+    {
+        m_read_buffer_release_threshold = value;
+        return *this;
+    };
+    connection_cfg_t && read_buffer_release_threshold(
+        std::size_t value ) && noexcept
+    {
+        return std::move( this->read_buffer_release_threshold( value ) );
+    }
+
+    /**
+     * @brief Calculate timeout for a specific amount of data.
+     *
+     * @param  buffer_size_bytes  Size of data measured in bytes.
+     * @return                    Returns `(data in mb) * write_timeout_per_1mb`
+     *                            if data size is greater than 1 mb,
+     *                            otherwise return 0.
+     */
+    timeout_type_t make_write_timeout_per_buffer(
+        std::size_t buffer_size_bytes ) const noexcept
+    {
+        constexpr std::size_t size_1mb           = 1024 * 1024;
+        constexpr std::size_t adjust_for_ceiling = size_1mb - 1;
+
+        if( size_1mb >= buffer_size_bytes )
+        {
+            // First quick option:
+            return m_write_timeout_per_1mb;
+        }
+        else
+        {
+            // It is a conscious div 1mb (which is power of 2),
+            // as compilers would optimize it to bit shift,
+            // thus giving fast math.
+            return ( ( buffer_size_bytes + adjust_for_ceiling ) / size_1mb )
+                   * m_write_timeout_per_1mb;
+        }
+    }
+
+private:
+    static constexpr std::size_t default_input_buffer_size = 256 * 1024;
+    std::size_t m_input_buffer_size{ default_input_buffer_size };
+
+    static constexpr std::size_t default_max_input_buffer_size = 32 * 1024 * 1024;
+    std::size_t m_max_input_buffer_size{ default_max_input_buffer_size };
+
+    static constexpr timeout_type_t default_write_timeout_per_1mb =
+        std::chrono::seconds{ 1 };
+    timeout_type_t m_write_timeout_per_1mb{ default_write_timeout_per_1mb };
+
+    std::size_t m_zerocopy_send_threshold{};
+
+    std::size_t m_max_iov_per_write{ details::reasonable_max_iov_len() };
+
+    std::chrono::microseconds m_write_coalescing_delay{};
+
+    static constexpr std::size_t default_write_coalescing_bytes = 16 * 1024;
+    std::size_t m_write_coalescing_bytes{ default_write_coalescing_bytes };
+
+    std::size_t m_write_coalescing_buffers{};
+
+    bool m_write_coalescing_use_tcp_cork{ false };
+
+    std::size_t m_read_budget_iterations{};
+
+    static constexpr std::size_t default_read_budget_bytes = 1024 * 1024;
+    std::size_t m_read_budget_bytes{ default_read_budget_bytes };
+
+    std::size_t m_read_buffer_release_threshold{};
+};
+
+// A forward declaration of connection.
+template < typename Traits >
+class connection_t;
+
+//
+// input_ctx_t
+//
+
+/**
+ * @brief Input context.
+ *
+ * Acts as a parameter for input handler which is an entry
+ * point for user defined input data handling routine.
+ *
+ * Gives input handler implementation access to a obtained buffer
+ * and also provides access to logger and connection by references.
+ * So handler can do some logging and is able to manipulate connection.
+ *
+ * @tparam Traits  Traits class of associated connection.
+ */
+template < typename Traits >
+class input_ctx_t
+{
+public:
+    using source_connection_t = connection_t< Traits >;
+    using buffer_t            = typename source_connection_t::input_buffer_t;
+    using logger_t            = typename source_connection_t::logger_t;
+
+private:
+    // Gives access to connection class:
+    friend class connection_t< Traits >;
+
+    input_ctx_t( buffer_t buf,
+                 logger_t & logger,
+                 source_connection_t & connection )
+        : m_buffer{ std::move( buf ) }
+        , m_logger{ logger }
+        , m_connection{ connection }
+    {
+    }
+
+    // This would demand input handlers to receive input_ctx_t
+    // only by reference.
+    input_ctx_t( const input_ctx_t & ) = delete;
+    input_ctx_t( input_ctx_t && )      = delete;
+    input_ctx_t & operator=( const input_ctx_t & ) = delete;
+    input_ctx_t & operator=( input_ctx_t && ) = delete;
+
+public:
+    /**
+     * @brief Access input buffer by reference.
+     *
+     * The buffer references raw data read from socket.
+     * By default the size of the buffer is at most what is
+     * the default `input_buffer_size` (see @c connection_cfg_t)
+     * passed into sonstructor of source_connection_t.
+     * But that can be customized with input_ctx_t::next_read_buffer.
+     *
+     * The exact size of data depends on how much data was received from
+     * peer and accumulated for the underlying socket at the moment
+     * IO event happened.
+     *
+     * @note Buffer migh be moved,
+     *       thus next time an empty buffer will be returned.
+     *
+     * @code
+     * auto make_input_handler() {
+     *     return [ & ]( source_connection_t<Traits>::input_ctx_t & ctx ) {
+     *         // Echo:
+     *         ctx.connection().schedule_send( std::move( ctx.buf() ) );
+     *     }
+     * }
+     * @endcode
+     *
+     * @return reference to buffer object.
+     */
+    [[nodiscard]] buffer_t & buf() noexcept { return m_buffer; }
+
+    /**
+     * @brief Get a reference to logger.
+     *
+     * This allows user provided handler to log to the same log that
+     * source_connection_t logs to.
+     */
+    [[nodiscard]] logger_t & log() noexcept { return m_logger; };
+
+    /**
+     * @brief Get a reference to connection.
+     *
+     * This allows user provided handler to log to the same log that
+     * source_connection_t logs to.
+     */
+    [[nodiscard]] source_connection_t & connection() noexcept
+    {
+        return m_connection;
+    };
+
+    /**
+     * @brief Explicitly set next buffer.
+     *
+     * This function allows to override default behaviour regarding
+     * input read buffer size and also regarding what is the source of
+     * such buffer (by defaul a new buffer "vector<char>" is created).
+     * If, based on something (the data in a given buffer), user
+     * decides that the next buffer can be of some specific size
+     * or of some specific source it can handle it using this function
+     *
+     * @param buf  Next buffer that would be used for read operation.
+     */
+    void next_read_buffer( buffer_t buf ) noexcept
+    {
+        m_next_read_buffer = std::move( buf );
+    }
+
+    /**
+     * @brief The size of a buffer for next read operation
+     *        as it is decided by connection's read size policy.
+     *
+     * It is the size connection would go with unless next buffer
+     * is set explicitly with `next_read_buffer()`. So handler providing
+     * its own buffer (e.g. a reused one) might want to respect it.
+     */
+    [[nodiscard]] std::size_t next_read_size() const noexcept
+    {
+        return m_next_read_size;
+    }
+    ///@}
+
+private:
+    buffer_t m_buffer;
+    logger_t & m_logger;
+    source_connection_t & m_connection;
+    std::optional< buffer_t > m_next_read_buffer;
+    std::size_t m_next_read_size{};
+};
+
+//
+// connection_shutdown_reason
+//
+
+/**
+ * @brief Flags for connection shutdown reason.
+ *
+ * Acts as an argument for shutdown handler assigned to connection.
+ */
+enum class connection_shutdown_reason
+{
+    user_initiated,
+    io_error,
+    eof,
     write_timeout,
     read_ts_not_supported_on_this_platform
 };
@@ -848,6 +1507,13 @@ public:
      */
     using input_handler_t = typename Traits::input_handler_t;
 
+    /**
+     * @brief A policy that decides on the size of read buffers.
+     *
+     * Optional, defaults to fixed_read_size_policy_t.
+     */
+    using read_size_policy_t = details::traits_read_size_policy_t< Traits >;
+
     /**
      * @name Complementary lock routines.
      *
@@ -1177,10 +1843,15 @@ protected:
         } );
         // We should alway have a single element in the queue ()that is an
         // invariant.
-        m_write_queue.push( {} );
+        m_write_queue.push( m_cfg.max_iov_per_write() );
+
+        m_read_size = m_cfg.input_buffer_size();
+        if( !releases_read_buffer( 0 ) )
+        {
+            m_read_buffer = m_buffer_driver.allocate_input( m_read_size );
+        }
 
-        m_read_buffer =
-            m_buffer_driver.allocate_input( m_cfg.input_buffer_size() );
+        init_zerocopy_send();
     }
 
 public:
@@ -1291,7 +1962,12 @@ public:
     }
     ///@}
 
-    ~connection_t() { handle_remainig_write_queue(); }
+    ~connection_t()
+    {
+        handle_remainig_zerocopy_sequences();
+        handle_remainig_write_queue();
+        handle_remainig_send_submissions();
+    }
 
     /**
      * @brief Start reading data from connection.
@@ -1600,7 +2276,114 @@ public:
                                     Buffers... >(
             std::move( cb ), std::forward< Buffers >( bufs )... );
     }
-    /// @}
+
+    /**
+     * @brief Submit a given sequence of buffers for sending.
+     *
+     * Intended for sending from threads other than the one running asio.
+     * Buffers are pushed to a lock-free submission queue with a single CAS
+     * (no locking and no dedicated asio handler per call), and
+     * connection moves all the submitted buffers to its write queue
+     * as a single batch on its strand: when a running write operation
+     * completes or in a handler posted by the producer
+     * which found the submission queue empty.
+     *
+     * The order of buffers submitted by a given thread is preserved.
+     *
+     * @note Submission path is independent of `schedule_send` family,
+     *       so the relative order of buffers sent from the same thread
+     *       through both paths is not defined.
+     *
+     * @tparam Buffers  Types of objects passed as buf-parameters.
+     */
+    template < typename... Buffers >
+    void submit_send( Buffers &&... bufs )
+    {
+        submit_send_with_cb( send_complete_cb_t{},
+                             std::forward< Buffers >( bufs )... );
+    }
+
+    /**
+     * @brief Submit a given sequence of buffers for sending.
+     *
+     * @see submit_send().
+     *
+     * @tparam Buffer_Vec  Types of container with buffers.
+     */
+    template < typename Buffer_Vec >
+    void submit_send_vec( Buffer_Vec bufs )
+    {
+        submit_send_vec_with_cb( send_complete_cb_t{}, std::move( bufs ) );
+    }
+
+    /**
+     * @brief Submit a given sequence of buffers for sending.
+     *
+     * @see submit_send().
+     *
+     * @tparam Buffers  Types of objects passed as buf-parameters.
+     *
+     * @param cb    Send completion callback.
+     */
+    template < typename... Buffers >
+    void submit_send_with_cb( send_complete_cb_t cb, Buffers &&... bufs )
+    {
+        auto submission = m_send_submission_pool.acquire();
+        submission->bufs.reserve( sizeof...( bufs ) );
+        ( submission->bufs.emplace_back(
+              output_buffer_t{ std::forward< Buffers >( bufs ) } ),
+          ... );
+        submission->cb = std::move( cb );
+
+        push_send_submission( std::move( submission ) );
+    }
+
+    /**
+     * @brief Submit a given sequence of buffers for sending.
+     *
+     * @see submit_send().
+     *
+     * @tparam Buffer_Vec  Types of container with buffers.
+     *
+     * @param cb    Send completion callback.
+     */
+    template < typename Buffer_Vec >
+    void submit_send_vec_with_cb( send_complete_cb_t cb, Buffer_Vec bufs )
+    {
+        auto submission = m_send_submission_pool.acquire();
+        submission->bufs.reserve( bufs.size() );
+        for( auto & b : bufs )
+        {
+            submission->bufs.emplace_back( output_buffer_t{ std::move( b ) } );
+        }
+        submission->cb = std::move( cb );
+
+        push_send_submission( std::move( submission ) );
+    }
+    /// @}
+
+    /**
+     * @brief Write the data held by write coalescing without waiting
+     *        for coalescing limits.
+     *
+     * It is meant for latency critical paths and also to
+     * get the held data to peer before calling `shutdown()`.
+     * Does nothing if coalescing is off or there is nothing to write.
+     *
+     * @see connection_cfg_t::write_coalescing_delay().
+     */
+    void flush()
+    {
+        asio_ns::dispatch( m_strand, [ self = this->shared_from_this() ] {
+            OPIO_NET_CONNECTION_LOCK_GUARD( self );
+            if( !self->m_schedule_for_write_is_enabled ) [[unlikely]]
+            {
+                return;
+            }
+
+            self->initiate_write_if_necessary( write_coalescing_mode::bypass );
+        } );
+    }
 
     /**
      * @brief Shutdown connection.
@@ -1638,6 +2421,14 @@ public:
      */
     buffer_driver_t & buffer_driver() noexcept { return m_buffer_driver; }
 
+    /**
+     * @brief Access read size policy.
+     */
+    const read_size_policy_t & read_size_policy() const noexcept
+    {
+        return m_read_size_policy;
+    }
+
     /**
      * @brief Get a remote endpoint string (like `ip:port`).
      */
@@ -1785,21 +2576,11 @@ private:
                 return;
             }
 
-            // https://godbolt.org/z/3adhe8qa4
-            // MSVC c++17 emmits C2039 error saying:
-            // > 'weak_from_this': is not a member of "lambda"...
-            // which is a quite confusing behaviour, so we do a more verbose way.
-            // instead of just using this.
-            auto * msvc_this_workaround = this;
-
-            const auto all_aggressive = [ & ] {
-                auto be_aggressive = true;
-                ( msvc_this_workaround
-                      ->append_outgoing_buffer_try_aggressive_write(
-                          bufs, be_aggressive ),
-                  ... );
-                return be_aggressive;
-            }();
+            std::array< output_buffer_t, sizeof...( Buffers ) > bufs_array{
+                std::move( bufs )...
+            };
+            const auto all_aggressive =
+                append_outgoing_buffers_try_aggressive_write( bufs_array );
 
             if( !all_aggressive )
             {
@@ -1814,8 +2595,9 @@ private:
             // Seems like in C++20 implementation here can be cleaner.
             // https://newbedev.com/c-lambdas-how-to-capture-variadic-parameter-pack-from-the-upper-scope
             auto send_work = [ self       = this->shared_from_this(),
-                               tuple_bufs = std::make_tuple(
-                                   std::move( bufs )... ) ]() mutable {
+                               bufs_array = std::array< output_buffer_t,
+                                                        sizeof...( Buffers ) >{
+                                   std::move( bufs )... } ]() mutable {
                 OPIO_NET_CONNECTION_LOCK_GUARD( self );
                 if( !self->m_schedule_for_write_is_enabled ) [[unlikely]]
                 {
@@ -1824,16 +2606,9 @@ private:
                     return;
                 }
 
-                const auto all_aggressive = std::apply(
-                    [ self_ptr = self.get() ]( auto &&... bufs ) {
-                        auto be_aggressive = true;
-
-                        ( self_ptr->append_outgoing_buffer_try_aggressive_write(
-                              bufs, be_aggressive ),
-                          ... );
-                        return be_aggressive;
-                    },
-                    std::move( tuple_bufs ) );
+                const auto all_aggressive =
+                    self->append_outgoing_buffers_try_aggressive_write(
+                        bufs_array );
 
                 if( !all_aggressive )
                 {
@@ -1870,24 +2645,8 @@ private:
                 return;
             }
 
-            // https://godbolt.org/z/3adhe8qa4
-            // MSVC c++17 emmits C2039 error saying:
-            // > 'weak_from_this': is not a member of "lambda"...
-            // which is a quite confusing behaviour, so we do a more verbose way.
-            // instead of just using this.
-            auto * msvc_this_workaround = this;
-
-            const auto all_aggressive = [ & ] {
-                auto be_aggressive = true;
-                for( auto & b : bufs )
-                {
-                    msvc_this_workaround
-                        ->append_outgoing_buffer_try_aggressive_write(
-                            b, be_aggressive );
-                }
-
-                return be_aggressive;
-            }();
+            const auto all_aggressive =
+                append_outgoing_buffers_try_aggressive_write( bufs );
 
             if( !all_aggressive )
             {
@@ -1911,18 +2670,8 @@ private:
                     return;
                 }
 
-                auto * msvc_this_workaround = self.get();
-                const auto all_aggressive   = [ & ] {
-                    auto be_aggressive = true;
-                    for( auto & b : bufs )
-                    {
-                        msvc_this_workaround
-                            ->append_outgoing_buffer_try_aggressive_write(
-                                b, be_aggressive );
-                    }
-
-                    return be_aggressive;
-                }();
+                const auto all_aggressive =
+                    self->append_outgoing_buffers_try_aggressive_write( bufs );
 
                 if( !all_aggressive )
                 {
@@ -1960,21 +2709,11 @@ private:
                 return;
             }
 
-            // https://godbolt.org/z/3adhe8qa4
-            // MSVC c++17 emmits C2039 error saying:
-            // > 'weak_from_this': is not a member of "lambda"...
-            // which is a quite confusing behaviour, so we do a more verbose way.
-            // instead of just using this.
-            auto * msvc_this_workaround = this;
-
-            const auto all_aggressive = [ & ] {
-                auto be_aggressive = true;
-                ( msvc_this_workaround
-                      ->append_outgoing_buffer_try_aggressive_write(
-                          bufs, be_aggressive ),
-                  ... );
-                return be_aggressive;
-            }();
+            std::array< output_buffer_t, sizeof...( Buffers ) > bufs_array{
+                std::move( bufs )...
+            };
+            const auto all_aggressive =
+                append_outgoing_buffers_try_aggressive_write( bufs_array );
 
             if( !all_aggressive )
             {
@@ -2005,8 +2744,9 @@ private:
             // https://newbedev.com/c-lambdas-how-to-capture-variadic-parameter-pack-from-the-upper-scope
             auto send_work = [ self       = this->shared_from_this(),
                                cb         = std::move( cb ),
-                               tuple_bufs = std::make_tuple( output_buffer_t{
-                                   std::move( bufs ) }... ) ]() mutable {
+                               bufs_array = std::array< output_buffer_t,
+                                                        sizeof...( Buffers ) >{
+                                   std::move( bufs )... } ]() mutable {
                 OPIO_NET_CONNECTION_LOCK_GUARD( self );
                 if( !self->m_schedule_for_write_is_enabled ) [[unlikely]]
                 {
@@ -2018,16 +2758,9 @@ private:
                     return;
                 }
 
-                const auto all_aggressive = std::apply(
-                    [ self_ptr = self.get() ]( auto &&... bufs ) {
-                        auto be_aggressive = true;
-
-                        ( self_ptr->append_outgoing_buffer_try_aggressive_write(
-                              bufs, be_aggressive ),
-                          ... );
-                        return be_aggressive;
-                    },
-                    std::move( tuple_bufs ) );
+                const auto all_aggressive =
+                    self->append_outgoing_buffers_try_aggressive_write(
+                        bufs_array );
 
                 if( !all_aggressive )
                 {
@@ -2079,24 +2812,8 @@ private:
                 return;
             }
 
-            // https://godbolt.org/z/3adhe8qa4
-            // MSVC c++17 emmits C2039 error saying:
-            // > 'weak_from_this': is not a member of "lambda"...
-            // which is a quite confusing behaviour, so we do a more verbose way.
-            // instead of just using this.
-            auto * msvc_this_workaround = this;
-
-            const auto all_aggressive = [ & ] {
-                auto be_aggressive = true;
-                for( auto & b : bufs )
-                {
-                    msvc_this_workaround
-                        ->append_outgoing_buffer_try_aggressive_write(
-                            b, be_aggressive );
-                }
-
-                return be_aggressive;
-            }();
+            const auto all_aggressive =
+                append_outgoing_buffers_try_aggressive_write( bufs );
 
             if( !all_aggressive )
             {
@@ -2139,18 +2856,8 @@ private:
                     return;
                 }
 
-                auto * msvc_this_workaround = self.get();
-                const auto all_aggressive   = [ & ] {
-                    auto be_aggressive = true;
-                    for( auto & b : bufs )
-                    {
-                        msvc_this_workaround
-                            ->append_outgoing_buffer_try_aggressive_write(
-                                b, be_aggressive );
-                    }
-
-                    return be_aggressive;
-                }();
+                const auto all_aggressive =
+                    self->append_outgoing_buffers_try_aggressive_write( bufs );
 
                 if( !all_aggressive )
                 {
@@ -2185,6 +2892,135 @@ private:
     }
     ///@}
 
+    /**
+     * @name Submission queue routines.
+     */
+    ///@{
+    using send_submission_t = details::send_submission_t< output_buffer_t >;
+
+    void push_send_submission( std::unique_ptr< send_submission_t > submission )
+    {
+        if( m_send_submissions.push( submission.release() ) )
+        {
+            // The queue was empty, so no one asked the connection
+            // to consume it yet. Note that it is `post()` even
+            // if we are on the strand, because this might be called
+            // from a context that holds the lock.
+            asio_ns::post( m_strand, [ self = this->shared_from_this() ] {
+                OPIO_NET_CONNECTION_LOCK_GUARD( self );
+                self->consume_send_submissions();
+                self->initiate_write_if_necessary();
+            } );
+        }
+    }
+
+    /**
+     * @brief Move all the submitted buffers to write queue.
+     *
+     * Unlike `schedule_send()` family no aggressive write is tried
+     * for individual buffers: the whole batch is written with
+     * as few writes as possible by the following
+     * `initiate_write_if_necessary()`.
+     *
+     * @note It doesn't initiate write operation.
+     */
+    void consume_send_submissions()
+    {
+        auto * head = m_send_submissions.pop_all();
+
+        if( nullptr == head ) [[likely]]
+        {
+            return;
+        }
+
+        std::size_t count = 0;
+
+        // Consumed submissions go back to the pool with a single lock.
+        send_submission_t * consumed = nullptr;
+
+        while( nullptr != head )
+        {
+            std::unique_ptr< send_submission_t > submission{ head };
+            head = head->next;
+            ++count;
+
+            if( !m_schedule_for_write_is_enabled ) [[unlikely]]
+            {
+                run_send_completion_callback(
+                    send_buffers_result::rejected_schedule_send, submission->cb );
+            }
+            else
+            {
+                if( submission->cb && !submission->bufs.empty()
+                    && !m_write_queue.back().can_append_completion_cb() )
+                    [[unlikely]]
+                {
+                    // A batch of small buffers might be concatenated
+                    // into a single sequence, but not the callbacks, so
+                    // start a new sequence not to overflow callbacks storage.
+                    m_write_queue.push( m_cfg.max_iov_per_write() );
+                }
+
+                for( auto & b : submission->bufs )
+                {
+                    append_outgoing_buffer( std::move( b ) );
+                }
+
+                if( submission->cb )
+                {
+                    m_write_queue.back().append_completion_cb(
+                        std::move( submission->cb ) );
+                }
+            }
+
+            submission->next = consumed;
+            consumed         = submission.release();
+        }
+
+        m_send_submission_pool.recycle( consumed );
+
+        m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Consumed {} send submissions",
+                       remote_endpoint_str(),
+                       connection_id(),
+                       count );
+        } );
+    }
+
+    /**
+     * @brief Release submissions that connection never consumed.
+     *
+     * Called from destructor.
+     */
+    void handle_remainig_send_submissions() noexcept
+    {
+        auto * head = m_send_submissions.pop_all();
+        while( nullptr != head )
+        {
+            std::unique_ptr< send_submission_t > submission{ head };
+            head = head->next;
+            run_send_completion_callback( send_buffers_result::didnt_send,
+                                          submission->cb );
+        }
+    }
+    ///@}
+
+    /**
+     * @brief Make an output buffer holding a copy of given data.
+     *
+     * The buffer is allocated by buffer driver
+     * (so it is not necessarily a simple buffer).
+     */
+    [[nodiscard]] output_buffer_t make_output_buffer_copy( const void * data,
+                                                           std::size_t size )
+    {
+        auto buf = m_buffer_driver.allocate_output( size );
+        std::memcpy(
+            buffer_driver_t::make_asio_mutable_buffer( buf ).data(), data, size );
+        return output_buffer_t{ std::move( buf ) };
+    }
+
     /**
      * @brief Append a new buffer to next to be send sequence of buffers.
      */
@@ -2217,7 +3053,7 @@ private:
 
             auto simple_strategy_write_queue_extension = [ & ] {
                 // Simple case we just add new buf-sequence to write queue.
-                m_write_queue.push( {} );
+                m_write_queue.push( m_cfg.max_iov_per_write() );
                 return &m_write_queue.back();
             };
 
@@ -2277,7 +3113,8 @@ public:
     void append_outgoing_buffer_try_aggressive_write( output_buffer_t & buf,
                                                       bool & be_aggressive )
     {
-        be_aggressive = be_aggressive && !m_is_write_operation_running;
+        be_aggressive = be_aggressive && !m_is_write_operation_running
+                        && !write_coalescing_is_on();
 
         if( be_aggressive ) [[likely]]
         {
@@ -2301,6 +3138,7 @@ public:
 
             asio_ns::error_code ec;
             m_stats.sync_write_started( asio_buf.size(), *this );
+            m_stats.write_iovecs_count( 1, *this );
 
             const auto transferred = asio_ns::write( m_socket, asio_buf, ec );
 
@@ -2336,12 +3174,10 @@ public:
                 // we can't do writes anymore an current buffer is half sent...
                 // so we need to create a new buffer that contains a tail
                 // data (that is yet to be sent) from the current one:
-                simple_buffer_t tail_buf{ static_cast< const std::byte * >(
-                                              asio_buf.data() )
-                                              + transferred,
-                                          asio_buf.size() - transferred };
-
-                append_outgoing_buffer( std::move( tail_buf ) );
+                append_outgoing_buffer( make_output_buffer_copy(
+                    static_cast< const std::byte * >( asio_buf.data() )
+                        + transferred,
+                    asio_buf.size() - transferred ) );
 
                 // Job is done. Nothing more to do for this buffer.
                 return;
@@ -2351,6 +3187,131 @@ public:
         append_outgoing_buffer( std::move( buf ) );
     }
 
+    /**
+     * @brief Try to write a group of buffers with a single sync gather write.
+     *
+     * Unlike calling append_outgoing_buffer_try_aggressive_write()
+     * for each buffer it costs a single syscall for the whole group
+     * (if it fits `max_iov_per_write` and sync write heuristic).
+     * If the data is not written completely, the tail is appended
+     * to write queue: buffers written completely are dropped and
+     * the partially written one is replaced with a copy of its tail.
+     *
+     * @param bufs  Buffers to write (those to be queued are moved from).
+     *
+     * @return True if all the data was written.
+     */
+    template < typename Buffers_Range >
+    bool append_outgoing_buffers_try_aggressive_write( Buffers_Range & bufs )
+    {
+        const std::size_t count = std::size( bufs );
+
+        if( 0 == count ) [[unlikely]]
+        {
+            return true;
+        }
+
+        if( m_is_write_operation_running || count > m_aggressive_bufs.size()
+            || write_coalescing_is_on() ) [[unlikely]]
+        {
+            // Go buffer by buffer.
+            auto be_aggressive = true;
+            for( auto & b : bufs )
+            {
+                append_outgoing_buffer_try_aggressive_write( b, be_aggressive );
+            }
+            return be_aggressive;
+        }
+
+        std::size_t total_size = 0;
+        {
+            std::size_t i = 0;
+            for( auto & b : bufs )
+            {
+                m_aggressive_bufs[ i ] =
+                    buffer_driver_t::make_asio_const_buffer( b );
+                total_size += m_aggressive_bufs[ i ].size();
+                ++i;
+            }
+        }
+
+        if( details::quik_sync_write_heuristic_size <= total_size ) [[unlikely]]
+        {
+            for( auto & b : bufs )
+            {
+                append_outgoing_buffer( std::move( b ) );
+            }
+            return false;
+        }
+
+        const details::buf_descriptors_span_t descriptors{
+            m_aggressive_bufs.data(), count
+        };
+
+        m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Aggressive gather write, "
+                       "number of buffers: {}; size in bytes: {}",
+                       remote_endpoint_str(),
+                       connection_id(),
+                       count,
+                       total_size );
+        } );
+
+        asio_ns::error_code ec;
+        m_stats.sync_write_started( total_size, *this );
+        m_stats.write_iovecs_count( count, *this );
+
+        const auto transferred = sync_gather_write( descriptors, ec );
+
+        m_stats.sync_write_finished( transferred, *this );
+        m_stats.inc_bytes_tx_sync( transferred, *this );
+
+        m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] sync-write operation, "
+                       "transferred: {}; ec: {}",
+                       remote_endpoint_str(),
+                       connection_id(),
+                       transferred,
+                       fmt_integrator( ec ) );
+        } );
+
+        if( transferred == total_size ) [[likely]]
+        {
+            // Job is done, sync write succeed.
+            return true;
+        }
+
+        // Notify to stats that we faced would_block_error.
+        m_stats.hit_would_block_event( total_size, *this );
+
+        // The data is not written completely, queue the tail.
+        const auto tail =
+            details::skip_transferred_part( descriptors, transferred );
+        const std::size_t first_to_queue = count - tail.size();
+
+        std::size_t i = 0;
+        for( auto & b : bufs )
+        {
+            if( i == first_to_queue
+                && tail[ 0 ].size()
+                       != buffer_driver_t::make_asio_const_buffer( b ).size() )
+            {
+                // Buffer is half sent.
+                append_outgoing_buffer(
+                    make_output_buffer_copy( tail[ 0 ].data(), tail[ 0 ].size() ) );
+            }
+            else if( i >= first_to_queue )
+            {
+                append_outgoing_buffer( std::move( b ) );
+            }
+            ++i;
+        }
+
+        return false;
+    }
+
 private:
     /**
      * @brief Real implementation of shutdown.
@@ -2405,29 +3366,240 @@ private:
                 m_socket.close( ec );
 #endif  // !defined( OPIO_NET_ASIO_WINDOWS )
 
-                report_err_if_needed( OPIO_SRC_LOCATION, ec, "socket.shutdown" );
+                report_err_if_needed( OPIO_SRC_LOCATION, ec, "socket.shutdown" );
+
+                m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                    format_to( out,
+                               "[{};cid:{}] socket is shutdowned",
+                               remote_endpoint_str(),
+                               connection_id() );
+                } );
+
+                // We don't want watchdog to happen after we shutdown connection:
+                m_write_operation_watchdog.cancel_watch_operation();
+
+                if( m_write_coalescing_timer_is_armed )
+                {
+                    m_write_coalescing_timer.cancel();
+                }
+            }
+
+            if( m_shutdown_handler )
+            {
+                // Call only if function object is not empty.
+                m_shutdown_handler( reason );
+            }
+            // Regardless of whether any actual call happened
+            // consider it happened.
+            m_shutdown_was_called = true;
+        }
+    }
+
+    /**
+     * @brief Write buffers with a sync write operation.
+     *
+     * Goes with a native gather write if possible so
+     * the whole sequence can be written with a single syscall.
+     */
+    std::size_t sync_gather_write( details::buf_descriptors_span_t bufs,
+                                   asio_ns::error_code & ec )
+    {
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+        if constexpr( std::is_same_v< socket_t, asio_ns::ip::tcp::socket > )
+        {
+            return details::gather_write(
+                m_socket.native_handle(), bufs, m_iov_storage, ec );
+        }
+#endif  // defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+        return asio_ns::write( m_socket, bufs, ec );
+    }
+
+    /**
+     * @brief Start watching the write operation for timeout.
+     *
+     * @param total_size  The size of data the write operation handles.
+     */
+    void start_write_operation_watchdog( std::size_t total_size )
+    {
+        // Please note, we will use WEAK POINTER to raw connection.
+        // And the reason is that `this` owns m_write_operation_watchdog
+        // and passing a true shared pointer to it might cause
+        // circular references.
+        m_write_operation_watchdog.start_watch_operation(
+            m_cfg.make_write_timeout_per_buffer( total_size ),
+            [ wp = this->weak_from_this() ]( auto timeout_key ) {
+                // This callback runs on watchdog context.
+                // So, please, note this code is not under strand,
+                // thus not safe to manipulate with connection internals.
+                if( auto conn = wp.lock(); conn )
+                {
+                    // Ok, Phoenix worked, so connection object
+                    // still exists.
+                    //
+                    // So what we do here is calling
+                    // a function that would dispath
+                    // handling properly.
+                    conn->hadle_write_operation_timeout( timeout_key );
+                }
+            } );
+    }
+
+    /**
+     * @name Write coalescing routines.
+     *
+     * @see connection_cfg_t::write_coalescing_delay().
+     */
+    ///@{
+
+    /**
+     * @brief How initiate_write_if_necessary() treats write coalescing.
+     */
+    enum class write_coalescing_mode
+    {
+        // Hold pending data unless coalescing limits are reached.
+        respect,
+        // Write pending data right away.
+        bypass,
+    };
+
+    [[nodiscard]] bool write_coalescing_is_on() const noexcept
+    {
+        return m_cfg.write_coalescing_delay()
+               != std::chrono::microseconds::zero();
+    }
+
+    /**
+     * @brief Check if pending data should be held for coalescing.
+     *
+     * If so, makes sure the data doesn't wait longer than the delay.
+     *
+     * @return True if write must not be started.
+     */
+    bool hold_for_write_coalescing( std::size_t bufs_count,
+                                    std::size_t total_size )
+    {
+        if( !write_coalescing_is_on() ) [[likely]]
+        {
+            return false;
+        }
+
+        const auto bytes_limit = m_cfg.write_coalescing_bytes();
+        const auto bufs_limit  = m_cfg.write_coalescing_buffers();
+
+        // Having more than one item in queue means the first one is full.
+        const bool limit_reached =
+            1 < m_write_queue.size()
+            || ( 0 != bytes_limit && bytes_limit <= total_size )
+            || ( 0 != bufs_limit && bufs_limit <= bufs_count );
+
+        if( limit_reached )
+        {
+            return false;
+        }
+
+        // Everything written before is already passed to kernel.
+        uncork_socket_if_necessary();
+        arm_write_coalescing_timer();
+
+        m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Hold outgoing data for coalescing, "
+                       "number of buffers: {}; size in bytes: {}",
+                       remote_endpoint_str(),
+                       connection_id(),
+                       bufs_count,
+                       total_size );
+        } );
+
+        return true;
+    }
+
+    void arm_write_coalescing_timer()
+    {
+        if( m_write_coalescing_timer_is_armed )
+        {
+            // The timer is not canceled when held data is written
+            // because of a limit reached or flush, so the data pending
+            // when it fires might wait less than the delay which is fine.
+            return;
+        }
+
+        m_write_coalescing_timer_is_armed = true;
+        m_write_coalescing_timer.expires_after( m_cfg.write_coalescing_delay() );
+        m_write_coalescing_timer.async_wait( asio_ns::bind_executor(
+            m_strand, [ self = this->shared_from_this() ]( const auto & ec ) {
+                OPIO_NET_CONNECTION_LOCK_GUARD( self );
+                self->m_write_coalescing_timer_is_armed = false;
 
-                m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                if( ec || self->m_shutdown_was_called ) [[unlikely]]
+                {
+                    return;
+                }
+
+                self->initiate_write_if_necessary(
+                    write_coalescing_mode::bypass );
+            } ) );
+    }
+
+    void cork_socket_if_necessary()
+    {
+#if defined( OPIO_NET_HAS_TCP_CORK )
+        if constexpr( std::is_same_v< socket_t, asio_ns::ip::tcp::socket > )
+        {
+            if( m_tcp_cork_is_set || !m_cfg.write_coalescing_use_tcp_cork()
+                || !write_coalescing_is_on() )
+            {
+                return;
+            }
+
+            const auto ec =
+                details::set_tcp_cork( m_socket.native_handle(), true );
+            if( ec ) [[unlikely]]
+            {
+                m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
                     format_to( out,
-                               "[{};cid:{}] socket is shutdowned",
+                               "[{};cid:{}] Failed to set TCP_CORK: {}",
                                remote_endpoint_str(),
-                               connection_id() );
+                               connection_id(),
+                               fmt_integrator( ec ) );
                 } );
+                return;
+            }
 
-                // We don't want watchdog to happen after we shutdown connection:
-                m_write_operation_watchdog.cancel_watch_operation();
+            m_tcp_cork_is_set = true;
+        }
+#endif  // defined( OPIO_NET_HAS_TCP_CORK )
+    }
+
+    void uncork_socket_if_necessary()
+    {
+#if defined( OPIO_NET_HAS_TCP_CORK )
+        if constexpr( std::is_same_v< socket_t, asio_ns::ip::tcp::socket > )
+        {
+            if( !m_tcp_cork_is_set ) [[likely]]
+            {
+                return;
             }
 
-            if( m_shutdown_handler )
+            m_tcp_cork_is_set = false;
+
+            const auto ec =
+                details::set_tcp_cork( m_socket.native_handle(), false );
+            if( ec ) [[unlikely]]
             {
-                // Call only if function object is not empty.
-                m_shutdown_handler( reason );
+                m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                    format_to( out,
+                               "[{};cid:{}] Failed to clear TCP_CORK: {}",
+                               remote_endpoint_str(),
+                               connection_id(),
+                               fmt_integrator( ec ) );
+                } );
             }
-            // Regardless of whether any actual call happened
-            // consider it happened.
-            m_shutdown_was_called = true;
         }
+#endif  // defined( OPIO_NET_HAS_TCP_CORK )
     }
+    ///@}
 
     /**
      * @brief Check if we can start write operation and runs it
@@ -2437,8 +3609,11 @@ private:
      *
      *   - No write operation runs at the moment.
      *   - There is actually something in the output queue to send to peer.
+     *   - Write coalescing (if it is on) doesn't hold the data
+     *     or @p coalescing_mode tells to bypass it.
      */
-    void initiate_write_if_necessary()
+    void initiate_write_if_necessary(
+        write_coalescing_mode coalescing_mode = write_coalescing_mode::respect )
     {
         assert( !m_write_queue.empty() );
 
@@ -2465,9 +3640,19 @@ private:
                            remote_endpoint_str(),
                            connection_id() );
             } );
+            uncork_socket_if_necessary();
+            return;
+        }
+
+        if( write_coalescing_mode::respect == coalescing_mode
+            && hold_for_write_coalescing( bufs_seq.bufs.size(),
+                                          bufs_seq.total_size ) )
+        {
             return;
         }
 
+        cork_socket_if_necessary();
+
         // When starting async write or successfully completing sync write
         // we "freeze" a first item in the queue.
         // In async-write case:
@@ -2492,7 +3677,7 @@ private:
         auto freeze_first_buf_sequece_in_queue = [ this ] {
             if( 1 == m_write_queue.size() )
             {
-                m_write_queue.push( {} );
+                m_write_queue.push( m_cfg.max_iov_per_write() );
 
                 m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
                     format_to( out,
@@ -2527,11 +3712,6 @@ private:
                 }
             } );
 
-            // Please note, we will use WEAK POINTER to raw connection.
-            // And the reason is that `this` owns m_write_operation_watchdog
-            // and passing a true shared pointer to it might cause
-            // circular references.
-
             // https://godbolt.org/z/3adhe8qa4
             // MSVC c++17 emmits C2039 error saying:
             // > 'weak_from_this': is not a member of "lambda"...
@@ -2539,26 +3719,10 @@ private:
             // instead of just using this.
             auto * msvc_this_workaround = this;
 
-            m_write_operation_watchdog.start_watch_operation(
-                m_cfg.make_write_timeout_per_buffer( bufs_seq.total_size ),
-                [ wp = msvc_this_workaround->weak_from_this() ](
-                    auto timeout_key ) {
-                    // This callback runs on watchdog context.
-                    // So, please, note this code is not under strand,
-                    // thus not safe to manipulate with connection internals.
-                    if( auto conn = wp.lock(); conn )
-                    {
-                        // Ok, Phoenix worked, so connection object
-                        // still exists.
-                        //
-                        // So what we do here is calling
-                        // a function that would dispath
-                        // handling properly.
-                        conn->hadle_write_operation_timeout( timeout_key );
-                    }
-                } );
+            start_write_operation_watchdog( bufs_seq.total_size );
 
             m_stats.async_write_started( bufs_seq.total_size, *this );
+            m_stats.write_iovecs_count( bufs_seq.bufs.size(), *this );
             asio_ns::async_write(
                 m_socket,
                 bufs_seq.bufs,
@@ -2575,6 +3739,17 @@ private:
             freeze_first_buf_sequece_in_queue();
         };
 
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+        if( 0 != m_zerocopy_send_threshold
+            && m_zerocopy_send_threshold <= bufs_seq.total_size )
+        {
+            m_is_write_operation_running = true;
+            freeze_first_buf_sequece_in_queue();
+            start_zerocopy_write( bufs_seq.bufs, bufs_seq.total_size );
+            return;
+        }
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+
         if( details::quik_sync_write_heuristic_size >= bufs_seq.total_size )
         {
             m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
@@ -2600,8 +3775,9 @@ private:
 
             asio_ns::error_code ec;
             m_stats.sync_write_started( bufs_seq.total_size, *this );
+            m_stats.write_iovecs_count( bufs_seq.bufs.size(), *this );
 
-            const auto transferred = asio_ns::write( m_socket, bufs_seq.bufs, ec );
+            const auto transferred = sync_gather_write( bufs_seq.bufs, ec );
 
             m_stats.sync_write_finished( transferred, *this );
 
@@ -2762,80 +3938,475 @@ private:
         // to be NOT empty.
         assert( !m_write_queue.empty() );
 
-        m_is_write_operation_running = false;
-        initiate_write_if_necessary();
+        m_is_write_operation_running = false;
+
+        // Take all that was submitted while write operation was running,
+        // so it goes with the next write.
+        consume_send_submissions();
+
+        // The data accumulated while write operation was running
+        // has already waited for it, so no coalescing delay.
+        initiate_write_if_necessary( write_coalescing_mode::bypass );
+    }
+
+    /**
+     * @brief Handle possible write-operation timeout event implementation.
+     *
+     * @param timeout_key The key associated with the event.
+     */
+    void handle_write_operation_timeout_impl(
+        typename operation_watchdog_t::timeout_event_key_t timeout_key )
+    {
+        // To make sure that it is really a timeout for operation we should
+        // be sure that write operation is running,
+        // and current timeout key of the watchdog (it is a key assigned to current
+        // write operation) is equal to one that watchdog timeout check was
+        // scheduled before and the check was triggered. This multiple level check
+        // is required for cases when write operation completes in roughly the same
+        // time that timeout is triggered. For example:
+        // 1. start write operation at timepoint 0.
+        // 2. Schedule watchdot of write operation at timepoint T.
+        // ...
+        // ... almost T
+        // 3. Write operation completes and asio schedules completion
+        //    token of the operation to events queue.
+        // ... T
+        // 4. Watchdog posts check callback to asio queue.
+        //    That is because write completion token was not executed yet
+        //    and the check was not cancelled.
+        // ... ASIO EVENTS QUEUE now have: (write CT)(watchdog check)
+        // 5. Completion token for write executes and then a new write operation
+        //    is started (new watchdog would be started and a new key
+        //    whould be assighed: `m_write_operation_watchdog.timeout_key()`)
+        //    or there is nothing to send and so
+        //    `m_is_write_operation_running == false`.
+        // 6. watchdog check callback would be started and would do
+        //    no harm as it would have an obsolete key or
+        //    write operation is no longer running.
+        if( m_is_write_operation_running
+            && timeout_key == m_write_operation_watchdog.timeout_key() )
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "[{};cid:{}] Write operation timed out",
+                           remote_endpoint_str(),
+                           connection_id() );
+            } );
+            // Make sure to shutdown and close.
+            shutdown_impl( connection_shutdown_reason::write_timeout );
+        }
+    }
+
+    /**
+     * @brief Handle possible write-operation timeout event.
+     *
+     * @param timeout_key The key associated with the event.
+     */
+    void hadle_write_operation_timeout(
+        typename operation_watchdog_t::timeout_event_key_t timeout_key )
+    {
+        // Timer might calls us not from our strand.
+        // So we must ensure running handling on the strand of the connection.
+        asio_ns::dispatch(
+            m_strand, [ self = this->shared_from_this(), timeout_key ] {
+                OPIO_NET_CONNECTION_LOCK_GUARD( self );
+                self->handle_write_operation_timeout_impl( timeout_key );
+            } );
+    }
+
+    /**
+     * @name Zero-copy send routines.
+     *
+     * A buf-sequence which is at least `cfg.zerocopy_send_threshold()` bytes
+     * is written with `sendmsg(MSG_ZEROCOPY)` calls. Each successful call
+     * gets a sequential id (kernel counts them per socket) and once
+     * the kernel no longer refers user buffers it puts a notification
+     * with a range of completed ids to socket's error queue.
+     * So when write completes the buf-sequence is moved
+     * to `m_zerocopy_pending` where it stays (keeping buffers alive)
+     * until all its ids are reported as completed,
+     * and only then its send-completion callbacks are called.
+     *
+     * @note As callbacks of zerocopy-sent sequences are deferred,
+     *       callbacks of buffers sent later with regular write
+     *       might be called before them.
+     */
+    ///@{
+    void init_zerocopy_send()
+    {
+        if( 0 == m_cfg.zerocopy_send_threshold() )
+        {
+            return;
+        }
+
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+        if constexpr( std::is_same_v< socket_t, asio_ns::ip::tcp::socket > )
+        {
+            if( const auto ec =
+                    details::enable_zerocopy_send( m_socket.native_handle() );
+                ec )
+            {
+                m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                    format_to( out,
+                               "[{};cid:{}] Unable to set SO_ZEROCOPY, "
+                               "zerocopy send is disabled: {}",
+                               remote_endpoint_str(),
+                               connection_id(),
+                               fmt_integrator( ec ) );
+                } );
+                return;
+            }
+
+            m_zerocopy_send_threshold = m_cfg.zerocopy_send_threshold();
+
+            m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "[{};cid:{}] Zerocopy send is enabled for "
+                           "buf-sequences of {} bytes and more",
+                           remote_endpoint_str(),
+                           connection_id(),
+                           m_zerocopy_send_threshold );
+            } );
+            return;
+        }
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+
+        m_logger.warn( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Zerocopy send is not supported "
+                       "for this platform or socket type, "
+                       "zerocopy_send_threshold is ignored",
+                       remote_endpoint_str(),
+                       connection_id() );
+        } );
+    }
+
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+    /**
+     * @brief Start zerocopy write operation.
+     *
+     * @pre First item in write queue is freezed for write operation.
+     */
+    void start_zerocopy_write( details::buf_descriptors_span_t bufs,
+                               std::size_t total_size )
+    {
+        m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Starting zerocopy write operation, "
+                       "number of buffers: {}; "
+                       "size in bytes: {}",
+                       remote_endpoint_str(),
+                       connection_id(),
+                       bufs.size(),
+                       total_size );
+        } );
+
+        start_write_operation_watchdog( total_size );
+        m_stats.async_write_started( total_size, *this );
+        m_stats.write_iovecs_count( bufs.size(), *this );
+
+        m_zerocopy_write = zerocopy_write_t{
+            bufs, total_size, 0, m_zerocopy_next_id, 0
+        };
+
+        continue_zerocopy_write();
+    }
+
+    /**
+     * @brief Write as much data as socket accepts.
+     *
+     * If socket is not ready to accept more data
+     * waits for it to become writable.
+     */
+    void continue_zerocopy_write()
+    {
+        auto & zc = m_zerocopy_write;
+
+        while( zc.transferred < zc.total_size )
+        {
+            const auto res = details::zerocopy_sendmsg(
+                m_socket.native_handle(), zc.bufs, m_iov_storage );
+
+            if( res.ec ) [[unlikely]]
+            {
+                if( !error_is_would_block( res.ec ) )
+                {
+                    after_zerocopy_write( res.ec );
+                    return;
+                }
+
+                m_stats.hit_would_block_event( zc.total_size - zc.transferred,
+                                               *this );
+
+                m_socket.async_wait(
+                    asio_ns::socket_base::wait_write,
+                    asio_ns::bind_executor(
+                        m_strand,
+                        [ self = this->shared_from_this() ]( const auto & ec ) {
+                            if( ec ) [[unlikely]]
+                            {
+                                self->after_zerocopy_write( ec );
+                                return;
+                            }
+
+                            self->continue_zerocopy_write();
+                        } ) );
+                return;
+            }
+
+            if( res.zerocopy )
+            {
+                ++m_zerocopy_next_id;
+                ++zc.ids_count;
+            }
+
+            zc.transferred += res.transferred;
+
+            if( zc.transferred < zc.total_size )
+            {
+                zc.bufs =
+                    details::skip_transferred_part( zc.bufs, res.transferred );
+            }
+        }
+
+        after_zerocopy_write( {} );
+    }
+
+    /**
+     * @brief Handle zerocopy write operation result.
+     *
+     * If any zerocopy send succeeded the first item in write queue
+     * is moved to a list of sequences awaiting kernel notification.
+     */
+    void after_zerocopy_write( const asio_ns::error_code & ec )
+    {
+        const auto & zc = m_zerocopy_write;
+
+        m_stats.async_write_finished( zc.transferred, *this );
+        m_stats.inc_bytes_tx_async( zc.transferred, *this );
+
+        if( 0 == zc.ids_count )
+        {
+            // Kernel doesn't refer our buffers,
+            // so it is no different from a regular write.
+            after_write( ec, zc.transferred );
+            return;
+        }
+
+        // Exchange the written sequence for a recycled one,
+        // so neither of them releases its storage.
+        auto & seq = m_zerocopy_pending.push( m_cfg.max_iov_per_write() );
+        std::swap( seq.seq, m_write_queue.front() );
+        seq.first_id  = zc.first_id;
+        seq.ids_count = zc.ids_count;
+        seq.ids_left  = zc.ids_count;
+
+        if( ec ) [[unlikely]]
+        {
+            // Buffers are still kept until notification arrives
+            // (or connection is destroyed), but the result is known already.
+            seq.completion_cbs_pending = false;
+            run_send_completion_callbacks( send_buffers_result::io_error,
+                                           seq.seq.send_complete_cb_list() );
+        }
+        else
+        {
+            m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "[{};cid:{}] Zerocopy write completed, written: {} "
+                           "bytes, awaiting notification for ids [{}, {})",
+                           remote_endpoint_str(),
+                           connection_id(),
+                           zc.transferred,
+                           zc.first_id,
+                           zc.first_id + zc.ids_count );
+            } );
+        }
+
+        arm_zerocopy_notifications_wait();
+        after_write( ec, zc.transferred );
+
+        // Notifications might have already arrived.
+        handle_zerocopy_notifications();
+    }
+
+    /**
+     * @brief Wait for socket's error queue to get notifications.
+     */
+    void arm_zerocopy_notifications_wait()
+    {
+        if( m_zerocopy_wait_is_armed || m_zerocopy_pending.empty()
+            || m_shutdown_was_called )
+        {
+            return;
+        }
+
+        m_zerocopy_wait_is_armed = true;
+        m_socket.async_wait(
+            asio_ns::socket_base::wait_error,
+            asio_ns::bind_executor(
+                m_strand,
+                [ self = this->shared_from_this() ]( const auto & ec ) {
+                    self->m_zerocopy_wait_is_armed = false;
+
+                    if( ec ) [[unlikely]]
+                    {
+                        self->m_logger.debug(
+                            OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                                format_to( out,
+                                           "[{};cid:{}] Zerocopy notifications "
+                                           "wait finished with error: {}",
+                                           self->remote_endpoint_str(),
+                                           self->connection_id(),
+                                           fmt_integrator( ec ) );
+                            } );
+                        return;
+                    }
+
+                    self->handle_zerocopy_notifications();
+                    self->arm_zerocopy_notifications_wait();
+                } ) );
+    }
+
+    /**
+     * @brief Read completion notifications from socket's error queue
+     *        and complete sequences which are no longer used by kernel.
+     */
+    void handle_zerocopy_notifications()
+    {
+        if( m_zerocopy_pending.empty() )
+        {
+            return;
+        }
+
+        details::drain_zerocopy_notifications(
+            m_socket.native_handle(),
+            [ this ]( std::uint32_t lo, std::uint32_t hi, bool copied ) {
+                acknowledge_zerocopy_ids( lo, hi, copied );
+            } );
+
+        while( !m_zerocopy_pending.empty()
+               && 0 == m_zerocopy_pending.front().ids_left )
+        {
+            auto & seq = m_zerocopy_pending.front();
+            if( seq.completion_cbs_pending )
+            {
+                run_send_completion_callbacks( send_buffers_result::success,
+                                               seq.seq.send_complete_cb_list() );
+            }
+            m_zerocopy_pending.pop();
+        }
     }
 
     /**
-     * @brief Handle possible write-operation timeout event implementation.
+     * @brief Account a range of completed zerocopy send ids.
      *
-     * @param timeout_key The key associated with the event.
+     * @param lo      The first id in range (inclusive).
+     * @param hi      The last id in range (inclusive).
+     * @param copied  Whether the kernel had to copy the data anyway.
      */
-    void handle_write_operation_timeout_impl(
-        typename operation_watchdog_t::timeout_event_key_t timeout_key )
+    void acknowledge_zerocopy_ids( std::uint32_t lo,
+                                   std::uint32_t hi,
+                                   bool copied )
     {
-        // To make sure that it is really a timeout for operation we should
-        // be sure that write operation is running,
-        // and current timeout key of the watchdog (it is a key assigned to current
-        // write operation) is equal to one that watchdog timeout check was
-        // scheduled before and the check was triggered. This multiple level check
-        // is required for cases when write operation completes in roughly the same
-        // time that timeout is triggered. For example:
-        // 1. start write operation at timepoint 0.
-        // 2. Schedule watchdot of write operation at timepoint T.
-        // ...
-        // ... almost T
-        // 3. Write operation completes and asio schedules completion
-        //    token of the operation to events queue.
-        // ... T
-        // 4. Watchdog posts check callback to asio queue.
-        //    That is because write completion token was not executed yet
-        //    and the check was not cancelled.
-        // ... ASIO EVENTS QUEUE now have: (write CT)(watchdog check)
-        // 5. Completion token for write executes and then a new write operation
-        //    is started (new watchdog would be started and a new key
-        //    whould be assighed: `m_write_operation_watchdog.timeout_key()`)
-        //    or there is nothing to send and so
-        //    `m_is_write_operation_running == false`.
-        // 6. watchdog check callback would be started and would do
-        //    no harm as it would have an obsolete key or
-        //    write operation is no longer running.
-        if( m_is_write_operation_running
-            && timeout_key == m_write_operation_watchdog.timeout_key() )
+        if( m_zerocopy_pending.empty() ) [[unlikely]]
         {
-            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            return;
+        }
+
+        // Kernel uses 32-bit ids which wrap around,
+        // so restore a full id relative to the oldest pending one.
+        const std::uint64_t base = m_zerocopy_pending.front().first_id;
+        const auto base_lo       = static_cast< std::uint32_t >( base );
+
+        const std::uint64_t first = base + std::uint32_t{ lo - base_lo };
+        const std::uint64_t last  = first + std::uint32_t{ hi - lo };
+
+        for( std::size_t i = 0; i < m_zerocopy_pending.size(); ++i )
+        {
+            auto & seq = m_zerocopy_pending[ i ];
+            if( seq.first_id > last )
+            {
+                break;
+            }
+
+            const auto seq_last = seq.first_id + seq.ids_count - 1;
+            const auto from     = std::max( first, seq.first_id );
+            const auto to       = std::min( last, seq_last );
+            if( from <= to )
+            {
+                seq.ids_left -= to - from + 1;
+            }
+        }
+
+        if( copied )
+        {
+            m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
                 format_to( out,
-                           "[{};cid:{}] Write operation timed out",
+                           "[{};cid:{}] Zerocopy send ids [{}, {}] "
+                           "were completed with a copy",
                            remote_endpoint_str(),
-                           connection_id() );
+                           connection_id(),
+                           first,
+                           last );
             } );
-            // Make sure to shutdown and close.
-            shutdown_impl( connection_shutdown_reason::write_timeout );
         }
     }
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
 
     /**
-     * @brief Handle possible write-operation timeout event.
+     * @brief Handle buf-sequences still awaiting zerocopy notifications.
      *
-     * @param timeout_key The key associated with the event.
+     * Called from destructor. Sequences already reported by the kernel
+     * are completed as succeeded. For the rest there is no way
+     * to wait for notifications anymore, so the socket is reset first
+     * (abortive close drops not yet transmitted data, so the kernel
+     * doesn't send from user buffers once they are released)
+     * and the sequences are reported as `send_buffers_result::io_error`.
      */
-    void hadle_write_operation_timeout(
-        typename operation_watchdog_t::timeout_event_key_t timeout_key )
+    void handle_remainig_zerocopy_sequences() noexcept
     {
-        // Timer might calls us not from our strand.
-        // So we must ensure running handling on the strand of the connection.
-        asio_ns::dispatch(
-            m_strand, [ self = this->shared_from_this(), timeout_key ] {
-                OPIO_NET_CONNECTION_LOCK_GUARD( self );
-                self->handle_write_operation_timeout_impl( timeout_key );
-            } );
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+        if( m_zerocopy_pending.empty() )
+        {
+            return;
+        }
+
+        if( m_socket.is_open() )
+        {
+            handle_zerocopy_notifications();
+
+            asio_ns::error_code ec;
+            m_socket.set_option( asio_ns::socket_base::linger{ true, 0 }, ec );
+            m_socket.close( ec );
+        }
+
+        while( !m_zerocopy_pending.empty() )
+        {
+            auto & seq = m_zerocopy_pending.front();
+            if( seq.completion_cbs_pending )
+            {
+                run_send_completion_callbacks( send_buffers_result::io_error,
+                                               seq.seq.send_complete_cb_list() );
+            }
+            m_zerocopy_pending.pop();
+        }
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
     }
+    ///@}
 
     /**
      * @brief Initiate next read operation.
      */
     void initiate_read()
     {
+        if( 0 == m_read_buffer.size() ) [[unlikely]]
+        {
+            // Zero-buffer idle read.
+            initiate_wait_readable();
+            return;
+        }
+
         m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
             format_to( out,
                        "[{};cid:{}] Starting read operation, buffer "
@@ -2859,11 +4430,94 @@ private:
                 } ) );
     }
 
+    /**
+     * @brief Initiate waiting for socket to become readable.
+     *
+     * Used when connection has no read buffer
+     * (see connection_cfg_t::read_buffer_release_threshold()).
+     */
+    void initiate_wait_readable()
+    {
+        m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "[{};cid:{}] Starting wait for socket to become readable",
+                       remote_endpoint_str(),
+                       connection_id() );
+        } );
+
+        m_socket.async_wait(
+            asio_ns::ip::tcp::socket::wait_read,
+            asio_ns::bind_executor(
+                m_strand, [ self = this->shared_from_this() ]( auto ec ) {
+                    self->after_wait_readable( ec );
+                } ) );
+    }
+
+    /**
+     * @brief Handle the result of waiting for socket to become readable.
+     *
+     * Takes a buffer from buffer driver and reads the data
+     * with non-blocking `read_some()`, the result goes to after_read()
+     * the same way the result of async read does.
+     */
+    void after_wait_readable( const asio_ns::error_code & ec )
+    {
+        asio_ns::error_code read_ec = ec;
+        std::size_t length{};
+
+        if( !read_ec ) [[likely]]
+        {
+            // Read buffer and socket reads are not shared with
+            // write operations, so no lock is needed.
+            m_read_buffer = m_buffer_driver.allocate_input( m_read_size );
+            length        = m_socket.read_some(
+                m_buffer_driver.make_asio_mutable_buffer( m_read_buffer ),
+                read_ec );
+
+            if( error_is_would_block( read_ec ) ) [[unlikely]]
+            {
+                // Spurious wakeup: the data is not there yet.
+                // The buffer is kept for the next read, so another
+                // wakeup doesn't take one more buffer from the driver.
+                OPIO_NET_CONNECTION_LOCK_GUARD( this );
+                if( m_read_is_enabled ) [[likely]]
+                {
+                    initiate_read_after_spurious_wakeup();
+                }
+                return;
+            }
+        }
+
+        after_read( read_ec, length );
+    }
+
+    /**
+     * @brief Continue reading after a wakeup that found no data.
+     */
+    void initiate_read_after_spurious_wakeup()
+    {
+        if constexpr( details::has_transient_input_buffers_v< buffer_driver_t > )
+        {
+            // Transient buffers can't be held while waiting
+            // (driver's scratch memory is reused by other connections),
+            // they cost nothing to get again though.
+            m_read_buffer = input_buffer_t{};
+        }
+
+        // With a buffer kept it is a regular async read.
+        initiate_read();
+    }
+
     /**
      * @brief Handle read operation result.
      *
      * In essence feeds input data to user defined callback,
      * prepares for next read operation and initiates it.
+     *
+     * If read budget is configured
+     * (see connection_cfg_t::read_budget_iterations()) then before
+     * initiating next async read the socket is drained with non-blocking
+     * reads while there is data and the budget allows it.
      */
     void after_read( const asio_ns::error_code & ec, std::size_t length )
     {
@@ -2892,6 +4546,102 @@ private:
             return;
         }
 
+        // Not shared with write operations:
+        m_stats.inc_bytes_rx_async( length, *this );
+
+        std::size_t budget_iterations = m_cfg.read_budget_iterations();
+        std::size_t total_length      = length;
+
+        while( true )
+        {
+            handle_read_data( length );
+
+            {
+                OPIO_NET_CONNECTION_LOCK_GUARD( this );
+                // ^~~~~ Here we must take a lock.
+                //       Because `m_read_is_enabled` is shared with read operation
+                //   +------------/
+                //   |   throuth error handling.
+                //   |   Think of a competing write faced an error and
+                //   |   starts shutdown operation.
+                //   V   that would mean stop of the service.
+                if( !read_is_still_enabled() ) [[unlikely]]
+                {
+                    return;
+                }
+
+                if( 0 == budget_iterations || 0 == m_read_buffer.size()
+                    || ( 0 != m_cfg.read_budget_bytes()
+                         && m_cfg.read_budget_bytes() <= total_length ) )
+                {
+                    initiate_read();
+                    return;
+                }
+            }
+            --budget_iterations;
+
+            // Try to read more data while we are here,
+            // socket is in non-blocking mode so it wouldn't block.
+            // Read buffer and socket reads are not shared with
+            // write operations, so the read goes without the lock
+            // (and doesn't hold up writes for the time of the syscall).
+            asio_ns::error_code read_ec;
+            length = m_socket.read_some(
+                m_buffer_driver.make_asio_mutable_buffer( m_read_buffer ),
+                read_ec );
+
+            if( read_ec )
+            {
+                OPIO_NET_CONNECTION_LOCK_GUARD( this );
+                if( error_is_would_block( read_ec ) ) [[likely]]
+                {
+                    // Socket is drained.
+                    if( read_is_still_enabled() ) [[likely]]
+                    {
+                        initiate_read();
+                    }
+                }
+                else
+                {
+                    handle_io_error( read_ec, "read", OPIO_SRC_LOCATION );
+                }
+                return;
+            }
+
+            m_stats.inc_bytes_rx_sync( length, *this );
+            total_length += length;
+        }
+    }
+
+    /**
+     * @brief Check if reading is still enabled before starting next read.
+     *
+     * @pre Must be called under the lock.
+     */
+    [[nodiscard]] bool read_is_still_enabled()
+    {
+        if( !m_read_is_enabled ) [[unlikely]]
+        {
+            m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "[{};cid:{}] read is disabled, skip next read",
+                           remote_endpoint_str(),
+                           connection_id() );
+            } );
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Feed a chunk of data that was read to user defined callback
+     *        and prepare read buffer for next read.
+     *
+     * @param length  The number of bytes read to `m_read_buffer`.
+     */
+    void handle_read_data( std::size_t length )
+    {
         // To Lock or Not To Lock?
         // Call a logging routine:
         // data subjected to logging here is either not shared with write operation
@@ -2913,16 +4663,16 @@ private:
             }
         } );
 
-        // Not shared with write operations:
-        m_stats.inc_bytes_rx_async( length, *this );
-
         assert( m_read_buffer.size() >= length );
 
+        update_read_size( length, m_read_buffer.size() );
+
         // Not shared with write operations:
         input_ctx_t input_ctx{ m_buffer_driver.reduce_size_input(
                                    std::move( m_read_buffer ), length ),
                                m_logger,
                                *this };
+        input_ctx.m_next_read_size = m_read_size;
 
         // Well, looks good enaugh.
         // We are here and didn't lock yet.
@@ -2930,7 +4680,15 @@ private:
 
         // Preaparing m_read_buffer for next read does not require
         // any locking.
-        if( input_ctx.m_next_read_buffer
+        if( releases_read_buffer( length ) ) [[unlikely]]
+        {
+            // Connection seems to be idle (or buffers are transient),
+            // so we release read buffer (whatever the input handler suggests)
+            // and wait for the next data without holding a buffer.
+            m_read_buffer = input_buffer_t{};
+            m_stats.read_buffer_released( *this );
+        }
+        else if( input_ctx.m_next_read_buffer
             && input_ctx.m_next_read_buffer->size() > 0 )
         {
             // If input handler callback return a buffer
@@ -2956,29 +4714,56 @@ private:
             // should guarantee that eventualy we will get the correct
             // buffer, and luckely we won't mess with memory allocations.
             m_read_buffer = m_buffer_driver.reallocate_input(
-                std::move( input_ctx.m_buffer ), m_cfg.input_buffer_size() );
+                std::move( input_ctx.m_buffer ), m_read_size );
         }
+    }
 
-        OPIO_NET_CONNECTION_LOCK_GUARD( this );
-        // ^~~~~ Here we must take a lock.
-        //       Because `m_read_is_enabled` is shared with read operation
-        //   +------------/
-        //   |   throuth error handling.
-        //   |   Think of a competing write faced an error and
-        //   |   starts shutdown operation.
-        //   V   that would mean stop of the service.
-        if( m_read_is_enabled )
+    /**
+     * @brief Should read buffer be released after a given read.
+     *
+     * @param length  The number of bytes read.
+     */
+    [[nodiscard]] bool releases_read_buffer( std::size_t length ) const noexcept
+    {
+        if constexpr( details::has_transient_input_buffers_v< buffer_driver_t > )
         {
-            initiate_read();
+            // Buffers are only valid during a read
+            // followed by input handler call.
+            return true;
         }
         else
         {
-            m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            return length < m_cfg.read_buffer_release_threshold();
+        }
+    }
+
+    /**
+     * @brief Ask read size policy for the size of the next read buffer.
+     *
+     * @param length       The number of bytes read.
+     * @param buffer_size  The size of a buffer the data was read into.
+     */
+    void update_read_size( std::size_t length, std::size_t buffer_size )
+    {
+        const auto read_size = m_read_size_policy.next_read_size(
+            length,
+            buffer_size,
+            m_cfg.input_buffer_size(),
+            m_cfg.max_input_buffer_size() );
+
+        if( read_size != m_read_size ) [[unlikely]]
+        {
+            m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
                 format_to( out,
-                           "[{};cid:{}] read is disabled, skip next read",
+                           "[{};cid:{}] Read size changed: {} -> {}",
                            remote_endpoint_str(),
-                           connection_id() );
+                           connection_id(),
+                           m_read_size,
+                           read_size );
             } );
+
+            m_stats.read_size_changed( m_read_size, read_size, *this );
+            m_read_size = read_size;
         }
     }
 
@@ -3205,11 +4990,15 @@ private:
 
     using single_writable_sequence_t =
         details::single_writable_sequence_t< buffer_driver_t >;
-    using write_queue_t = std::queue< single_writable_sequence_t >;
+    using write_queue_t = details::recycling_ring_t< single_writable_sequence_t >;
 
     /**
      * @brief A queue of write operations.
      *
+     * Items are recycled: the storage of a written sequence is reused
+     * for the following ones, so a steady send load
+     * doesn't imply allocations for write queue.
+     *
      * @note We should always have at least one element in the queue.
      *       Also the last item in queue (`m_write_queue.back()`)
      *       should always be possible to use. It means it shouldn't be
@@ -3219,6 +5008,107 @@ private:
      */
     write_queue_t m_write_queue;
 
+    /**
+     * @brief Storage for buffer descriptors of aggressive gather write.
+     */
+    std::vector< asio_ns::const_buffer > m_aggressive_bufs =
+        std::vector< asio_ns::const_buffer >( m_cfg.max_iov_per_write() );
+
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+    /**
+     * @brief Storage for iovecs passed to native gather write.
+     */
+    std::vector< ::iovec > m_iov_storage =
+        std::vector< ::iovec >( m_cfg.max_iov_per_write() );
+#endif  // defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+    /**
+     * @brief The state of running zerocopy write operation.
+     */
+    struct zerocopy_write_t
+    {
+        details::buf_descriptors_span_t bufs;
+        std::size_t total_size{};
+        std::size_t transferred{};
+        std::uint64_t first_id{};
+        std::uint64_t ids_count{};
+    };
+
+    /**
+     * @brief Written buf-sequence which buffers are still used by kernel.
+     */
+    struct zerocopy_pending_seq_t
+    {
+        explicit zerocopy_pending_seq_t( std::size_t max_iov_per_write )
+            : seq{ max_iov_per_write }
+        {
+        }
+
+        void reset()
+        {
+            seq.reset();
+            first_id               = 0;
+            ids_count              = 0;
+            ids_left               = 0;
+            completion_cbs_pending = true;
+        }
+
+        single_writable_sequence_t seq;
+        std::uint64_t first_id{};
+        std::uint64_t ids_count{};
+        std::uint64_t ids_left{};
+        bool completion_cbs_pending{ true };
+    };
+
+    /**
+     * @brief Effective zerocopy threshold (0 if zerocopy is disabled).
+     */
+    std::size_t m_zerocopy_send_threshold{};
+
+    zerocopy_write_t m_zerocopy_write{};
+
+    /**
+     * @brief The id the kernel assigns to the next zerocopy send.
+     */
+    std::uint64_t m_zerocopy_next_id{};
+
+    /**
+     * @brief Sequences awaiting kernel notification.
+     *
+     * Items are recycled the same way write queue items are.
+     */
+    details::recycling_ring_t< zerocopy_pending_seq_t > m_zerocopy_pending;
+
+    bool m_zerocopy_wait_is_armed{ false };
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+
+    /**
+     * @brief Buffers submitted for sending with `submit_send()` family.
+     */
+    intrusive_mpsc_queue_t< send_submission_t > m_send_submissions;
+
+    /**
+     * @brief Items for the submission queue.
+     */
+    details::send_submission_pool_t< output_buffer_t > m_send_submission_pool;
+
+    /**
+     * @brief Timer limiting the time coalesced data is held.
+     *
+     * @see connection_cfg_t::write_coalescing_delay().
+     */
+    asio_ns::steady_timer m_write_coalescing_timer{ m_strand };
+
+    bool m_write_coalescing_timer_is_armed{ false };
+
+#if defined( OPIO_NET_HAS_TCP_CORK )
+    /**
+     * @brief Whether socket is corked by coalesced write.
+     */
+    bool m_tcp_cork_is_set{ false };
+#endif  // defined( OPIO_NET_HAS_TCP_CORK )
+
     /**
      * @brief Buffer driver.
      */
@@ -3229,6 +5119,16 @@ private:
      */
     input_buffer_t m_read_buffer;
 
+    /**
+     * @brief Read size policy.
+     */
+    [[no_unique_address]] read_size_policy_t m_read_size_policy;
+
+    /**
+     * @brief The latest decision of read size policy.
+     */
+    std::size_t m_read_size{};
+
     /**
      * @brief A callback to handle incoming data.
      */
@@ -3313,6 +5213,7 @@ using real_strand_t = asio_ns::strand< noop_strand_t >;
  * - `buffer_driver_t`. The customization driver for buffers concept.
  * - `input_handler_t`. The type of input data handler.
  * - `locking_t`. Locking mechanics details.
+ * - `read_size_policy_t`. Decides on the size of read buffers (optional).
  */
 struct default_traits_st_t
 {
@@ -3332,6 +5233,8 @@ struct default_traits_st_t
 #else   // defined( OPIO_NET_FORCE_DEFAULT_LOCKING_WITH_MUTEX )
     using locking_t = noop_locking_t;
 #endif  // defined( OPIO_NET_FORCE_DEFAULT_LOCKING_WITH_MUTEX )
+
+    using read_size_policy_t = fixed_read_size_policy_t;
 };
 
 //
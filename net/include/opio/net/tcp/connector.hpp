@@ -19,6 +19,39 @@ namespace opio::net::tcp
 using on_connection_cb_t =
     std::function< void( const asio_ns::error_code &, asio_ns::ip::tcp::socket ) >;
 
+//
+// start_connect()
+//
+
+/**
+ * @brief Open a socket, set its options and start connecting to an endpoint.
+ *
+ * @param socket              Socket to connect (must be closed).
+ * @param ep                  Endpoint to connect to.
+ * @param socket_options_cfg  Options to set on the socket.
+ * @param handler             Handler of async_connect().
+ *
+ * @throws asio_ns::system_error if socket can't be opened or configured.
+ */
+template < typename Handler >
+void start_connect( asio_ns::ip::tcp::socket & socket,
+                    const asio_ns::ip::tcp::endpoint & ep,
+                    const socket_options_cfg_t & socket_options_cfg,
+                    Handler && handler )
+{
+    // To set the options we must first open the socket,
+    // so that there would be  a real handle behind asio socket object:
+    socket.open( ep.protocol() );
+    set_socket_options( socket_options_cfg, socket );
+
+    // We use socket.async_connect(CB) rather then
+    // asio_ns::async_connect( sock, CB )
+    // because we want our options to be considered.
+    // asio_ns::async_connect( sock, CB ) - creates a new socket
+    // and doesn't account for options we set before.
+    socket.async_connect( ep, std::forward< Handler >( handler ) );
+}
+
 //
 // connector_t
 //
@@ -108,18 +141,10 @@ private:
                            ep );
             } );
 
-            // To set the options we must first open the socket,
-            // so that there would be  a real handle behind asio socket object:
-            m_socket.open( ep.protocol() );
-            set_socket_options( m_socket_options_cfg, m_socket );
-
-            // We use socket.async_connect(CB) rather then
-            // asio_ns::async_connect( sock, CB )
-            // because we want our options to be considered.
-            // asio_ns::async_connect( sock, CB ) - creates a new socket
-            // and doesn't account for options we set before.
-            m_socket.async_connect(
-                *std::begin( results ),
+            start_connect(
+                m_socket,
+                ep,
+                m_socket_options_cfg,
                 [ self = this->shared_from_this(), ep ]( const auto & ec ) {
                     self->handle_connect( ec, ep );
                 } );
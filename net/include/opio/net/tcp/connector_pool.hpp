@@ -0,0 +1,634 @@
+/**
+ * @file
+ *
+ * This header file contains connector_pool_t class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/log.hpp>
+#include <opio/net/tcp/connector.hpp>
+#include <opio/net/tcp/utils.hpp>
+
+namespace opio::net::tcp
+{
+
+//
+// connector_pool_cfg_t
+//
+
+/**
+ * @brief Parameters of connector_pool_t.
+ */
+struct connector_pool_cfg_t
+{
+    //! The number of connected sockets to keep ready.
+    std::size_t warm_connections{ 1 };
+
+    //! How long resolved endpoints are reused.
+    //! Zero means resolving on each connect.
+    std::chrono::milliseconds resolve_ttl{ std::chrono::seconds{ 30 } };
+
+    //! A delay before reconnecting after the first failure.
+    std::chrono::milliseconds backoff_initial{ 100 };
+
+    //! The max delay before reconnecting.
+    std::chrono::milliseconds backoff_max{ std::chrono::seconds{ 10 } };
+
+    //! A factor the delay grows by after each consecutive failure.
+    double backoff_multiplier{ 2.0 };
+
+    //! Random spread of the delay: the delay is multiplied
+    //! by a random value in `[1 - jitter, 1 + jitter]`,
+    //! so clients don't reconnect in lockstep.
+    double backoff_jitter{ 0.2 };
+};
+
+namespace details
+{
+
+//
+// backoff_t
+//
+
+/**
+ * @brief Exponential backoff with jitter.
+ */
+class backoff_t
+{
+public:
+    explicit backoff_t( const connector_pool_cfg_t & cfg )
+        : m_initial{ cfg.backoff_initial }
+        , m_max{ std::max( cfg.backoff_max, cfg.backoff_initial ) }
+        , m_multiplier{ std::max( cfg.backoff_multiplier, 1.0 ) }
+        , m_jitter{ std::clamp( cfg.backoff_jitter, 0.0, 1.0 ) }
+        , m_rng{ std::random_device{}() }
+    {
+    }
+
+    /**
+     * @brief Get a delay before the next attempt and advance the backoff.
+     */
+    [[nodiscard]] std::chrono::milliseconds next_delay()
+    {
+        const double base =
+            static_cast< double >( m_initial.count() )
+            * std::pow( m_multiplier, static_cast< double >( m_failures ) );
+        const auto max      = static_cast< double >( m_max.count() );
+        const double capped = std::min( base, max );
+
+        // Don't grow the exponent once the cap is reached.
+        if( capped < max )
+        {
+            ++m_failures;
+        }
+
+        std::uniform_real_distribution< double > dist{ 1.0 - m_jitter,
+                                                       1.0 + m_jitter };
+        return std::chrono::milliseconds{
+            static_cast< std::chrono::milliseconds::rep >(
+                capped * dist( m_rng ) )
+        };
+    }
+
+    /**
+     * @brief Start over (after a successful attempt).
+     */
+    void reset() noexcept { m_failures = 0; }
+
+    /**
+     * @brief The number of failures the current delay accounts for.
+     */
+    [[nodiscard]] std::size_t failures() const noexcept { return m_failures; }
+
+private:
+    std::chrono::milliseconds m_initial;
+    std::chrono::milliseconds m_max;
+    double m_multiplier;
+    double m_jitter;
+
+    std::size_t m_failures{};
+    std::minstd_rand m_rng;
+};
+
+}  // namespace details
+
+//
+// connector_pool_t
+//
+
+/**
+ * @brief A client side pool of pre-connected sockets.
+ *
+ * Keeps `warm_connections` sockets connected (with socket options applied)
+ * to a target specified by a query, so taking a connection (e.g. on failover)
+ * doesn't pay for resolving and handshake.
+ * Once a socket is taken the pool connects a new one to replace it.
+ *
+ * Resolved endpoints are cached for `resolve_ttl` and are dropped
+ * on connect failure. Failed connects are retried with exponential
+ * backoff and jitter.
+ *
+ * All the work (including callbacks) runs on the executor of the pool.
+ *
+ * The pool doesn't run connector_t per socket: connector_t resolves
+ * the query on every connect, while the pool resolves once per
+ * `resolve_ttl` and shares the result between concurrent connects.
+ * Opening a socket, setting its options and connecting is
+ * the same routine though (see start_connect()).
+ *
+ * @note Ready sockets are idle, so the peer might close them
+ *       while they are in the pool. Users must handle a failure
+ *       on the first read/write anyway.
+ */
+template < class Logger >
+class connector_pool_t
+    : public std::enable_shared_from_this< connector_pool_t< Logger > >
+{
+public:
+    using clock_t = std::chrono::steady_clock;
+
+    connector_pool_t( asio_ns::any_io_executor executor,
+                      tcp_resolver_query_t query,
+                      const socket_options_cfg_t & socket_options_cfg,
+                      connector_pool_cfg_t cfg,
+                      Logger logger )
+        : m_executor{ std::move( executor ) }
+        , m_query{ std::move( query ) }
+        , m_resolver{ m_executor }
+        , m_backoff_timer{ m_executor }
+        , m_socket_options_cfg{ socket_options_cfg }
+        , m_cfg{ std::move( cfg ) }
+        , m_backoff{ m_cfg }
+        , m_logger{ std::move( logger ) }
+    {
+    }
+
+    /**
+     * @brief Start connecting sockets.
+     */
+    void start()
+    {
+        asio_ns::post( m_executor, [ self = this->shared_from_this() ] {
+            self->m_running = true;
+            self->replenish();
+        } );
+    }
+
+    /**
+     * @brief Stop the pool.
+     *
+     * Ready sockets are closed, pending requests get `operation_aborted`.
+     */
+    void stop()
+    {
+        asio_ns::post( m_executor, [ self = this->shared_from_this() ] {
+            self->stop_impl();
+        } );
+    }
+
+    /**
+     * @brief Take a connected socket.
+     *
+     * If a ready socket exists it is handed to CB right away,
+     * otherwise CB waits for the next connected socket.
+     *
+     * @param cb  CB to receive the socket (called on the pool's executor).
+     */
+    void async_take( on_connection_cb_t cb )
+    {
+        assert( cb );
+        asio_ns::post(
+            m_executor,
+            [ self = this->shared_from_this(), cb = std::move( cb ) ]() mutable {
+                self->take_impl( std::move( cb ) );
+            } );
+    }
+
+    /**
+     * @name Pool state.
+     *
+     * @pre Must be called on the pool's executor.
+     */
+    ///@{
+    [[nodiscard]] std::size_t ready_count() const noexcept
+    {
+        return m_ready.size();
+    }
+
+    [[nodiscard]] std::size_t pending_connects_count() const noexcept
+    {
+        return m_pending_connects;
+    }
+
+    [[nodiscard]] std::size_t waiters_count() const noexcept
+    {
+        return m_waiters.size();
+    }
+
+    [[nodiscard]] std::size_t resolves_count() const noexcept
+    {
+        return m_resolves_count;
+    }
+    ///@}
+
+    /**
+     * @brief Get this pool resolution query used by resolver
+     *        to find an endpoint.
+     */
+    [[nodiscard]] const tcp_resolver_query_t & query() const noexcept
+    {
+        return m_query;
+    }
+
+private:
+    //! Sockets being connected (iterators stay valid on insert and erase).
+    using connecting_sockets_t = std::list< asio_ns::ip::tcp::socket >;
+
+    /**
+     * @brief Start as many connects as needed to have enough sockets.
+     */
+    void replenish()
+    {
+        if( !m_running || m_backoff_pending )
+        {
+            return;
+        }
+
+        // With cached endpoints a connect might fail synchronously
+        // (e.g. no free descriptors), so stop once backoff is scheduled.
+        const auto target = m_cfg.warm_connections + m_waiters.size();
+        while( m_ready.size() + m_pending_connects < target && !m_backoff_pending
+               && m_running )
+        {
+            ++m_pending_connects;
+            with_endpoints( [ this ]( const auto & ec ) {
+                if( ec )
+                {
+                    handle_failure( ec );
+                    return;
+                }
+                connect_one();
+            } );
+        }
+    }
+
+    /**
+     * @brief Run a given function once endpoints are resolved.
+     *
+     * Cached endpoints are used if they are not expired.
+     * Concurrent requests share a single resolve.
+     */
+    template < typename Fn >
+    void with_endpoints( Fn fn )
+    {
+        if( m_endpoints && clock_t::now() < m_endpoints_expire_at )
+        {
+            fn( asio_ns::error_code{} );
+            return;
+        }
+
+        m_resolve_waiters.emplace_back( std::move( fn ) );
+        if( m_resolving )
+        {
+            return;
+        }
+
+        m_resolving = true;
+        ++m_resolves_count;
+        m_resolver.async_resolve(
+#if OPIO_ASIO_VERSION >= 103300  // Asio >= 1.33.0
+            m_query.protocol,
+#endif
+            m_query.host_name(),
+            m_query.service_name(),
+            [ self = this->shared_from_this() ]( const auto & ec,
+                                                 auto resolve_res ) {
+                self->handle_resolve( ec, std::move( resolve_res ) );
+            } );
+    }
+
+    /**
+     * @brief Handle result of resolving server endpoint.
+     */
+    void handle_resolve( asio_ns::error_code ec,
+                         asio_ns::ip::tcp::resolver::results_type results )
+    {
+        m_resolving = false;
+
+        if( !ec && results.empty() ) [[unlikely]]
+        {
+            ec = asio_ns::error::host_not_found;
+        }
+
+        if( !ec )
+        {
+            m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "Resolve '{}:{}': {}",
+                           m_query.host_name(),
+                           m_query.service_name(),
+                           std::cbegin( results )->endpoint() );
+            } );
+            m_endpoints           = std::move( results );
+            m_endpoints_expire_at = clock_t::now() + m_cfg.resolve_ttl;
+        }
+        else
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "Unable to resolve '{}:{}': ec={}",
+                           m_query.host_name(),
+                           m_query.service_name(),
+                           fmt_integrator( ec ) );
+            } );
+            m_endpoints.reset();
+        }
+
+        auto waiters = std::move( m_resolve_waiters );
+        m_resolve_waiters.clear();
+        for( auto & w : waiters )
+        {
+            w( ec );
+        }
+    }
+
+    /**
+     * @brief Connect a socket to the first cached endpoint.
+     */
+    void connect_one()
+    {
+        if( !m_running ) [[unlikely]]
+        {
+            --m_pending_connects;
+            return;
+        }
+
+        const auto ep = std::cbegin( *m_endpoints )->endpoint();
+
+        // Connecting socket is owned by the pool, so stop() can close it.
+        const auto socket_it =
+            m_connecting.emplace( m_connecting.end(), m_executor );
+
+        try
+        {
+            start_connect(
+                *socket_it,
+                ep,
+                m_socket_options_cfg,
+                [ self = this->shared_from_this(), socket_it, ep ](
+                    const auto & ec ) {
+                    self->handle_connect( ec, socket_it, ep );
+                } );
+        }
+        catch( const asio_ns::system_error & ex )
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out, "Unable to start connecting: {}", ex.what() );
+            } );
+            m_connecting.erase( socket_it );
+            handle_failure( ex.code() );
+        }
+        catch( const std::exception & ex )
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out, "Unable to start connecting: {}", ex.what() );
+            } );
+            m_connecting.erase( socket_it );
+            handle_failure( asio_ns::error::invalid_argument );
+        }
+    }
+
+    /**
+     * @brief Handle result of "connect to server endpoint" operation.
+     */
+    void handle_connect( const asio_ns::error_code & ec,
+                         connecting_sockets_t::iterator socket_it,
+                         const asio_ns::ip::tcp::endpoint & ep )
+    {
+        auto socket = std::move( *socket_it );
+        m_connecting.erase( socket_it );
+
+        if( error_is_operation_aborted( ec ) )
+        {
+            // Pool is stopped.
+            handle_failure( ec );
+            return;
+        }
+
+        if( ec )
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out,
+                           "Unable to connect '{}:{}' ({}): ec={}",
+                           m_query.host_name(),
+                           m_query.service_name(),
+                           ep,
+                           fmt_integrator( ec ) );
+            } );
+
+            // Endpoint might have moved, so resolve it again.
+            m_endpoints.reset();
+            handle_failure( ec );
+            return;
+        }
+
+        --m_pending_connects;
+        m_backoff.reset();
+
+        m_logger.trace( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "Connect '{}:{}': {}",
+                       m_query.host_name(),
+                       m_query.service_name(),
+                       ep );
+        } );
+
+        if( !m_running ) [[unlikely]]
+        {
+            return;
+        }
+
+        if( !m_waiters.empty() )
+        {
+            auto cb = std::move( m_waiters.front() );
+            m_waiters.pop_front();
+            call_cb( cb, {}, std::move( socket ) );
+        }
+        else
+        {
+            m_ready.push_back( std::move( socket ) );
+        }
+    }
+
+    /**
+     * @brief Account failed attempt and schedule reconnecting.
+     */
+    void handle_failure( const asio_ns::error_code & ec )
+    {
+        --m_pending_connects;
+
+        if( !m_running || error_is_operation_aborted( ec ) )
+        {
+            return;
+        }
+
+        if( m_backoff_pending )
+        {
+            return;
+        }
+
+        m_backoff_pending = true;
+        const auto delay  = m_backoff.next_delay();
+
+        m_logger.debug( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+            format_to( out,
+                       "Reconnect '{}:{}' in {}ms (failures: {})",
+                       m_query.host_name(),
+                       m_query.service_name(),
+                       delay.count(),
+                       m_backoff.failures() );
+        } );
+
+        m_backoff_timer.expires_after( delay );
+        m_backoff_timer.async_wait(
+            [ self = this->shared_from_this() ]( const auto & timer_ec ) {
+                self->m_backoff_pending = false;
+                if( !timer_ec )
+                {
+                    self->replenish();
+                }
+            } );
+    }
+
+    void take_impl( on_connection_cb_t cb )
+    {
+        if( !m_running )
+        {
+            call_cb( cb,
+                     asio_ns::error::operation_aborted,
+                     asio_ns::ip::tcp::socket{ m_executor } );
+            return;
+        }
+
+        if( !m_ready.empty() )
+        {
+            auto socket = std::move( m_ready.front() );
+            m_ready.pop_front();
+            call_cb( cb, {}, std::move( socket ) );
+        }
+        else
+        {
+            m_waiters.push_back( std::move( cb ) );
+        }
+
+        replenish();
+    }
+
+    void stop_impl()
+    {
+        m_running = false;
+
+        m_resolver.cancel();
+        m_backoff_timer.cancel();
+
+        // Connects in progress complete with `operation_aborted`.
+        for( auto & s : m_connecting )
+        {
+            asio_ns::error_code ignored_ec;
+            s.close( ignored_ec );
+        }
+
+        for( auto & s : m_ready )
+        {
+            asio_ns::error_code ignored_ec;
+            s.close( ignored_ec );
+        }
+        m_ready.clear();
+
+        auto waiters = std::move( m_waiters );
+        m_waiters.clear();
+        for( auto & cb : waiters )
+        {
+            call_cb( cb,
+                     asio_ns::error::operation_aborted,
+                     asio_ns::ip::tcp::socket{ m_executor } );
+        }
+    }
+
+    void call_cb( on_connection_cb_t & cb,
+                  const asio_ns::error_code & ec,
+                  asio_ns::ip::tcp::socket socket )
+    {
+        try
+        {
+            cb( ec, std::move( socket ) );
+        }
+        catch( const std::exception & ex )
+        {
+            m_logger.error( OPIO_SRC_LOCATION, [ & ]( auto out ) {
+                format_to( out, "Callback failed: {}", ex.what() );
+            } );
+        }
+    }
+
+    asio_ns::any_io_executor m_executor;
+    tcp_resolver_query_t m_query;
+    asio_ns::ip::tcp::resolver m_resolver;
+    asio_ns::steady_timer m_backoff_timer;
+
+    const socket_options_cfg_t m_socket_options_cfg;
+    const connector_pool_cfg_t m_cfg;
+    details::backoff_t m_backoff;
+    [[no_unique_address]] Logger m_logger;
+
+    bool m_running{ false };
+    bool m_backoff_pending{ false };
+
+    //! Cached endpoints.
+    std::optional< asio_ns::ip::tcp::resolver::results_type > m_endpoints;
+    clock_t::time_point m_endpoints_expire_at{};
+    bool m_resolving{ false };
+    std::vector< std::function< void( const asio_ns::error_code & ) > >
+        m_resolve_waiters;
+    std::size_t m_resolves_count{};
+
+    //! The number of sockets being resolved or connected.
+    std::size_t m_pending_connects{};
+    connecting_sockets_t m_connecting;
+
+    std::deque< asio_ns::ip::tcp::socket > m_ready;
+    std::deque< on_connection_cb_t > m_waiters;
+};
+
+/**
+ * @brief A factory for creating an instance of connector pool.
+ */
+template < typename Logger >
+auto make_connector_pool( asio_ns::any_io_executor executor,
+                          tcp_resolver_query_t query,
+                          const socket_options_cfg_t & socket_options_cfg,
+                          connector_pool_cfg_t cfg,
+                          Logger logger )
+{
+    return std::make_shared< connector_pool_t< Logger > >(
+        std::move( executor ),
+        std::move( query ),
+        socket_options_cfg,
+        std::move( cfg ),
+        std::move( logger ) );
+}
+
+}  // namespace opio::net::tcp
@@ -0,0 +1,180 @@
+/**
+ * @file
+ *
+ * This header file contains low level routines for gather write
+ * used by connection_t.
+ *
+ * Asio composed write operations pass at most 16 buffers
+ * to a single syscall, so to make use of a wider gather write
+ * (up to `IOV_MAX` buffers) connection goes with `sendmsg()` directly
+ * where it is possible.
+ *
+ * Also it contains a `TCP_CORK` switch used to hold partial segments
+ * while a coalesced write goes with several syscalls.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <span>
+
+#include <opio/net/asio_include.hpp>
+
+#if defined( __linux__ )
+#    include <cerrno>
+#    include <sys/socket.h>
+#    include <sys/uio.h>
+#    include <netinet/in.h>
+#    include <netinet/tcp.h>
+
+#    define OPIO_NET_HAS_NATIVE_GATHER_WRITE
+
+#    if defined( TCP_CORK )
+#        define OPIO_NET_HAS_TCP_CORK
+#    endif
+#endif  // defined( __linux__ )
+
+namespace opio::net::tcp::details
+{
+
+/**
+ * @brief The maximum number of buffers that can be passed
+ *        to a single gather write (`IOV_MAX` on posix).
+ */
+constexpr std::size_t max_gather_write_iov_len() noexcept
+{
+    return static_cast< std::size_t >( asio_ns::detail::max_iov_len );
+}
+
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+//
+// fill_iovecs()
+//
+
+/**
+ * @brief Fill iovec array referring given buffers.
+ *
+ * @return The number of filled iovecs
+ *         (at most `min(bufs.size(), iov.size())`).
+ */
+template < typename Buf_Descriptors_Span >
+std::size_t fill_iovecs( Buf_Descriptors_Span bufs,
+                         std::span< ::iovec > iov ) noexcept
+{
+    const std::size_t iov_len = std::min( bufs.size(), iov.size() );
+    for( std::size_t i = 0; i < iov_len; ++i )
+    {
+        iov[ i ].iov_base = const_cast< void * >( bufs[ i ].data() );
+        iov[ i ].iov_len  = bufs[ i ].size();
+    }
+
+    return iov_len;
+}
+
+//
+// gather_write()
+//
+
+/**
+ * @brief Write given buffers to a socket without blocking.
+ *
+ * Writes until all the data is transferred or an error happens
+ * (including would-block), a single `sendmsg()` call
+ * takes up to `iov.size()` buffers.
+ * Calls are made with `MSG_DONTWAIT`, so they don't block
+ * even if the socket is in blocking mode.
+ *
+ * Buffer descriptors are not modified.
+ *
+ * @param fd   Socket descriptor.
+ * @param bufs Buffers to write.
+ * @param iov  Storage for iovecs.
+ * @param ec   Error code of the last call.
+ *
+ * @return The number of bytes transferred.
+ */
+template < typename Buf_Descriptors_Span >
+std::size_t gather_write( int fd,
+                          Buf_Descriptors_Span bufs,
+                          std::span< ::iovec > iov,
+                          asio_ns::error_code & ec ) noexcept
+{
+    assert( !iov.empty() );
+
+    std::size_t transferred = 0;
+
+    // The first buffer that is not completely written
+    // and an offset in it.
+    std::size_t first  = 0;
+    std::size_t offset = 0;
+
+    while( first < bufs.size() )
+    {
+        ::msghdr msg{};
+        msg.msg_iov    = iov.data();
+        msg.msg_iovlen = fill_iovecs( bufs.subspan( first ), iov );
+
+        iov[ 0 ].iov_base =
+            static_cast< std::byte * >( iov[ 0 ].iov_base ) + offset;
+        iov[ 0 ].iov_len -= offset;
+
+        const auto n = ::sendmsg( fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT );
+        if( n < 0 ) [[unlikely]]
+        {
+            if( EINTR == errno )
+            {
+                continue;
+            }
+
+            const int err = EWOULDBLOCK == errno ? EAGAIN : errno;
+            ec = asio_ns::error_code{ err, asio_ec::system_category() };
+            return transferred;
+        }
+
+        transferred += static_cast< std::size_t >( n );
+
+        // Move to the first not completely written buffer.
+        auto left = static_cast< std::size_t >( n ) + offset;
+        while( first < bufs.size() && left >= bufs[ first ].size() )
+        {
+            left -= bufs[ first ].size();
+            ++first;
+        }
+        offset = left;
+    }
+
+    ec = {};
+    return transferred;
+}
+
+#endif  // defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+#if defined( OPIO_NET_HAS_TCP_CORK )
+
+//
+// set_tcp_cork()
+//
+
+/**
+ * @brief Set or clear `TCP_CORK` on a given socket.
+ *
+ * While socket is corked kernel doesn't send partial segments,
+ * clearing it flushes the pending partial segment immediately.
+ */
+[[nodiscard]] inline asio_ns::error_code set_tcp_cork( int fd, bool on ) noexcept
+{
+    const int value = on ? 1 : 0;
+    if( 0 != ::setsockopt( fd, IPPROTO_TCP, TCP_CORK, &value, sizeof( value ) ) )
+    {
+        return asio_ns::error_code{ errno, asio_ec::system_category() };
+    }
+
+    return {};
+}
+
+#endif  // defined( OPIO_NET_HAS_TCP_CORK )
+
+}  // namespace opio::net::tcp::details
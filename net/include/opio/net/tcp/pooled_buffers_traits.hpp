@@ -0,0 +1,52 @@
+/**
+ * @file
+ *
+ * This header file contains traits presets for tcp connection
+ * (connection_t) that use pooled buffers.
+ */
+
+#pragma once
+
+#include <opio/net/pooled_buffer.hpp>
+#include <opio/net/tcp/connection.hpp>
+
+namespace opio::net::tcp
+{
+
+//
+// pooled_buffers_traits_st_t
+//
+
+/**
+ * @brief Tratis class for tcp connection class (connection_t)
+ *        for a single thread asio event loop which uses pooled buffers.
+ *
+ * Derives from default single-thread traits and overrides buffer driver and
+ * input handler.
+ *
+ * @see pooled_buffer_driver_t.
+ */
+struct pooled_buffers_traits_st_t : public default_traits_st_t
+{
+    using buffer_driver_t = pooled_buffer_driver_t;
+    static_assert( ::opio::net::Buffer_Driver_Concept< buffer_driver_t > );
+    using input_handler_t =
+        std::function< void( input_ctx_t< pooled_buffers_traits_st_t > & ) >;
+};
+
+//
+// pooled_buffers_traits_mt_t
+//
+
+/**
+ * @brief Tratis class for tcp connection class (connection_t)
+ *        for a multiple threads asio event loop which uses pooled buffers.
+ */
+struct pooled_buffers_traits_mt_t : public pooled_buffers_traits_st_t
+{
+    using strand_t = real_strand_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< pooled_buffers_traits_mt_t > & ) >;
+};
+
+}  // namespace opio::net::tcp
@@ -0,0 +1,175 @@
+/**
+ * @file
+ *
+ * This header file contains policies deciding on the size of
+ * a buffer for the next read operation of connection_t.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace opio::net::tcp
+{
+
+//
+// fixed_read_size_policy_t
+//
+
+/**
+ * @brief Read size policy that always reads with a configured size.
+ *
+ * Acts as a default customization point of `connection_t<Traits>`
+ * (`Traits::read_size_policy_t`).
+ *
+ * A read size policy must provide the following function:
+ * @code
+ * // Called after each read operation.
+ * // Returns the size of a buffer to use for the next read.
+ * std::size_t next_read_size( std::size_t bytes_read,
+ *                             std::size_t buffer_size,
+ *                             std::size_t min_size,
+ *                             std::size_t max_size );
+ * @endcode
+ * Where `buffer_size` is the size of a buffer the data was read into,
+ * `min_size` and `max_size` come from connection settings
+ * (`input_buffer_size()` and `max_input_buffer_size()`).
+ */
+struct fixed_read_size_policy_t
+{
+    [[nodiscard]] constexpr std::size_t next_read_size(
+        [[maybe_unused]] std::size_t bytes_read,
+        [[maybe_unused]] std::size_t buffer_size,
+        std::size_t min_size,
+        [[maybe_unused]] std::size_t max_size ) const noexcept
+    {
+        return min_size;
+    }
+};
+
+//
+// adaptive_read_size_policy_t
+//
+
+/**
+ * @brief Read size policy that adapts to the observed amount of input.
+ *
+ * The size grows (doubles) right away each time a read fills
+ * the whole buffer: socket likely has more data queued.
+ * It shrinks (halves) only after `shrink_after_reads` reads in a row
+ * for which the moving average (EWMA) of read sizes stays below
+ * a quarter of the current size. The gap between the thresholds
+ * keeps the size from flapping and a single burst doesn't pin
+ * the connection to large buffers for long.
+ *
+ * Size never goes below `min_size` and above `max_size`.
+ */
+class adaptive_read_size_policy_t
+{
+public:
+    static constexpr std::size_t default_shrink_after_reads = 8;
+
+    explicit adaptive_read_size_policy_t(
+        std::size_t shrink_after_reads = default_shrink_after_reads ) noexcept
+        : m_shrink_after_reads{ std::max< std::size_t >( 1, shrink_after_reads ) }
+    {
+    }
+
+    [[nodiscard]] std::size_t next_read_size( std::size_t bytes_read,
+                                              std::size_t buffer_size,
+                                              std::size_t min_size,
+                                              std::size_t max_size ) noexcept
+    {
+        max_size = std::max( min_size, max_size );
+
+        update_ewma( bytes_read );
+
+        const auto size = std::clamp( m_size, min_size, max_size );
+        const auto ewma = average_read_size();
+
+        if( 0 != buffer_size && buffer_size <= bytes_read && size < max_size )
+        {
+            // Fully utilized buffer.
+            m_size = std::min( std::max( size, buffer_size ) * 2, max_size );
+            m_low_usage_streak = 0;
+            ++m_grows_count;
+        }
+        else if( min_size < size && ewma * 4 < size )
+        {
+            if( m_shrink_after_reads <= ++m_low_usage_streak )
+            {
+                m_size             = std::max( size / 2, min_size );
+                m_low_usage_streak = 0;
+                ++m_shrinks_count;
+            }
+            else
+            {
+                m_size = size;
+            }
+        }
+        else
+        {
+            m_size             = size;
+            m_low_usage_streak = 0;
+        }
+
+        return m_size;
+    }
+
+    /**
+     * @name Stats on decisions.
+     */
+    ///@{
+    //! The latest decided size (0 if no decisions were made).
+    [[nodiscard]] std::size_t current_size() const noexcept { return m_size; }
+
+    //! The moving average of read sizes.
+    [[nodiscard]] std::size_t average_read_size() const noexcept
+    {
+        return m_ewma_x8 / 8;
+    }
+
+    [[nodiscard]] std::uint64_t grows_count() const noexcept
+    {
+        return m_grows_count;
+    }
+
+    [[nodiscard]] std::uint64_t shrinks_count() const noexcept
+    {
+        return m_shrinks_count;
+    }
+    ///@}
+
+private:
+    /**
+     * @brief Update EWMA with weight 1/8 for a new value.
+     *
+     * The average is kept scaled by 8 so that integer arithmetic
+     * doesn't get it stuck above small values.
+     * The first value is taken as is.
+     */
+    void update_ewma( std::size_t bytes_read ) noexcept
+    {
+        if( 0 == m_size ) [[unlikely]]
+        {
+            m_ewma_x8 = bytes_read * 8;
+        }
+        else
+        {
+            m_ewma_x8 = m_ewma_x8 - m_ewma_x8 / 8 + bytes_read;
+        }
+    }
+
+    std::size_t m_shrink_after_reads;
+
+    std::size_t m_size{};
+    std::size_t m_ewma_x8{};
+    std::size_t m_low_usage_streak{};
+
+    std::uint64_t m_grows_count{};
+    std::uint64_t m_shrinks_count{};
+};
+
+}  // namespace opio::net::tcp
@@ -0,0 +1,301 @@
+/**
+ * @file
+ *
+ * This header file contains sharded_acceptor_t class.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <opio/net/tcp/acceptor.hpp>
+
+namespace opio::net::tcp
+{
+
+//
+// sharded_acceptor_t
+//
+
+/**
+ * @brief Class providing socket acceptor service sharded
+ *        across several executors.
+ *
+ * Opens a listener (acceptor_t) per executor on the same endpoint
+ * with SO_REUSEPORT option, so the kernel balances new connections
+ * between listeners and each accepted socket stays on the executor
+ * of its listener (e.g. a thread of asio_thread_pool_t).
+ * So accepting and socket setup don't funnel through a single thread.
+ *
+ * Listeners are opened one after another (in order of executors),
+ * which defines their indexes in a reuseport group
+ * (see acceptor_options_cfg_t::reuse_port_cpu_steering).
+ *
+ * If the endpoint has port 0, the port is picked by the system
+ * when the acceptor is created: a socket (that doesn't listen)
+ * is bound to it and holds the port until listeners are opened,
+ * so all listeners are bound to the same port
+ * (they form a reuseport group).
+ *
+ * If some listener fails to open, already opened ones are closed.
+ *
+ * @note `on_accept_cb` is called on the executors of the listeners,
+ *       so it must be thread safe if the executors run on different threads.
+ */
+template < class Logger >
+class sharded_acceptor_t
+    : public std::enable_shared_from_this< sharded_acceptor_t< Logger > >
+{
+public:
+    using acceptor_sptr_t = std::shared_ptr< acceptor_t< Logger > >;
+
+    /**
+     * @param executors              Executors to run listeners on
+     *                               (a listener per executor).
+     * @param endpoint               TCP endpoint where to start the server.
+     * @param cpu_steering           Steer connections to listeners by CPU
+     *                               (see acceptor_options_cfg_t).
+     * @param socket_options_cfg     Options for accepted sockets.
+     * @param logger                 Loger assigned to the listeners.
+     * @param on_accept_cb           CB to handle new connections.
+     */
+    sharded_acceptor_t( const std::vector< asio_ns::any_io_executor > & executors,
+                        asio_ns::ip::tcp::endpoint endpoint,
+                        bool cpu_steering,
+                        const socket_options_cfg_t & socket_options_cfg,
+                        Logger logger,
+                        on_accept_cb_t on_accept_cb )
+        : m_endpoint{ std::move( endpoint ) }
+        , m_port_holder{ executors.front() }
+        , m_executors{ executors }
+        , m_cpu_steering{ cpu_steering }
+        , m_socket_options_cfg{ socket_options_cfg }
+        , m_logger{ std::move( logger ) }
+        , m_on_accept_cb{ std::move( on_accept_cb ) }
+    {
+        assert( !m_executors.empty() );
+        assert( m_on_accept_cb );
+
+        if( 0 == m_endpoint.port() )
+        {
+            hold_picked_port();
+        }
+
+        m_shards.reserve( m_executors.size() );
+        for( std::size_t i = 0; i < m_executors.size(); ++i )
+        {
+            m_shards.push_back( make_shard( i ) );
+        }
+    }
+
+    /**
+     * @brief Open all listeners.
+     *
+     * Listeners are opened one after another, opening stops
+     * on the first failure and already opened listeners are closed.
+     *
+     * @param cb  CB to be called with the result of operation
+     *            (the error of the failed listener if any).
+     */
+    void open( on_openclose_cb_t cb = {} )
+    {
+        open_shard( 0, std::move( cb ) );
+    }
+
+    /**
+     * @brief Close all listeners.
+     *
+     * @param cb  CB to be called once all listeners are closed
+     *            (with the first error if any).
+     */
+    void close( on_openclose_cb_t cb = {} )
+    {
+        struct close_ctx_t
+        {
+            explicit close_ctx_t( std::size_t n, on_openclose_cb_t cb )
+                : pending{ n }
+                , cb{ std::move( cb ) }
+            {
+            }
+
+            std::atomic< std::size_t > pending;
+            std::mutex lock;
+            asio_ns::error_code first_ec;
+            on_openclose_cb_t cb;
+        };
+
+        auto ctx =
+            std::make_shared< close_ctx_t >( m_shards.size(), std::move( cb ) );
+        for( auto & shard : m_shards )
+        {
+            shard->close( [ ctx ]( const auto & ec ) {
+                if( ec )
+                {
+                    std::lock_guard< std::mutex > lock{ ctx->lock };
+                    if( !ctx->first_ec )
+                    {
+                        ctx->first_ec = ec;
+                    }
+                }
+
+                if( 1 == ctx->pending.fetch_sub( 1, std::memory_order_acq_rel )
+                    && ctx->cb )
+                {
+                    std::lock_guard< std::mutex > lock{ ctx->lock };
+                    ctx->cb( ctx->first_ec );
+                }
+            } );
+        }
+    }
+
+    /**
+     * @brief Get an endpoint associated with this acceptor.
+     *
+     * If the acceptor was given port 0, it has the port picked
+     * by the system.
+     */
+    [[nodiscard]] const asio_ns::ip::tcp::endpoint & endpoint() const noexcept
+    {
+        return m_endpoint;
+    }
+
+    /**
+     * @brief The number of listeners.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_shards.size(); }
+
+private:
+    [[nodiscard]] acceptor_sptr_t make_shard( std::size_t i ) const
+    {
+        acceptor_options_cfg_t acceptor_options_cfg{};
+        acceptor_options_cfg.reuse_port = true;
+        if( m_cpu_steering && 0 == i )
+        {
+            // The program is attached to the whole group.
+            acceptor_options_cfg.reuse_port_cpu_steering =
+                static_cast< std::uint32_t >( m_executors.size() );
+        }
+
+        return std::make_shared< acceptor_t< Logger > >( m_executors[ i ],
+                                                          m_endpoint,
+                                                          acceptor_options_cfg,
+                                                          m_socket_options_cfg,
+                                                          m_logger,
+                                                          m_on_accept_cb );
+    }
+
+    /**
+     * @brief Bind a socket to a port picked by the system
+     *        and use the port for listeners.
+     *
+     * The socket is bound with SO_REUSEPORT and doesn't listen,
+     * so listeners can be bound to the same port and the socket
+     * doesn't take connections.
+     *
+     * Is called from constructor, so the port is known
+     * before listeners are created.
+     */
+    void hold_picked_port()
+    {
+        m_port_holder.open( m_endpoint.protocol() );
+#if defined( SO_REUSEPORT )
+        using reuse_port_t =
+            asio_ns::detail::socket_option::boolean< SOL_SOCKET, SO_REUSEPORT >;
+        m_port_holder.set_option( reuse_port_t{ true } );
+#endif  // defined( SO_REUSEPORT )
+        m_port_holder.bind( m_endpoint );
+        m_endpoint.port( m_port_holder.local_endpoint().port() );
+    }
+
+    /**
+     * @brief Release the port held for listeners (if any).
+     */
+    void release_picked_port() noexcept
+    {
+        asio_ns::error_code ignored_ec;
+        m_port_holder.close( ignored_ec );
+    }
+
+    void open_shard( std::size_t i, on_openclose_cb_t cb )
+    {
+        if( m_shards.size() == i )
+        {
+            release_picked_port();
+            if( cb )
+            {
+                cb( {} );
+            }
+            return;
+        }
+
+        m_shards[ i ]->open(
+            [ self = this->shared_from_this(), i, cb = std::move( cb ) ](
+                const auto & ec ) mutable {
+                if( ec )
+                {
+                    self->release_picked_port();
+
+                    // Close listeners that are already opened.
+                    self->close( [ ec, cb = std::move( cb ) ](
+                                     [[maybe_unused]] const auto & close_ec ) {
+                        if( cb )
+                        {
+                            cb( ec );
+                        }
+                    } );
+                    return;
+                }
+
+                self->open_shard( i + 1, std::move( cb ) );
+            } );
+    }
+
+    //! The endpoint of listeners (is set only in constructor).
+    asio_ns::ip::tcp::endpoint m_endpoint;
+
+    //! A socket holding the port picked by the system until listeners open.
+    asio_ns::ip::tcp::acceptor m_port_holder;
+
+    const std::vector< asio_ns::any_io_executor > m_executors;
+    const bool m_cpu_steering;
+    const socket_options_cfg_t m_socket_options_cfg;
+    const Logger m_logger;
+    const on_accept_cb_t m_on_accept_cb;
+
+    std::vector< acceptor_sptr_t > m_shards;
+};
+
+/**
+ * @brief A factory for creating an instance of sharded acceptor.
+ *
+ * @param  executors           Executors to run listeners on.
+ * @param  endpoint            TCP endpoint where to start the server
+ *                             (accept new connections).
+ * @param  socket_options_cfg  Socket options configuration.
+ * @param  logger              Loger assigned to the instance of acceptor.
+ * @param  on_accept_cb        CB to handle new connections.
+ * @param  cpu_steering        Steer connections to listeners by CPU.
+ *
+ * @return A shared pointer to acceptor.
+ */
+template < typename Logger >
+auto make_sharded_acceptor(
+    const std::vector< asio_ns::any_io_executor > & executors,
+    asio_ns::ip::tcp::endpoint endpoint,
+    const socket_options_cfg_t & socket_options_cfg,
+    Logger logger,
+    on_accept_cb_t on_accept_cb,
+    bool cpu_steering = false )
+{
+    return std::make_shared< sharded_acceptor_t< Logger > >(
+        executors,
+        std::move( endpoint ),
+        cpu_steering,
+        socket_options_cfg,
+        std::move( logger ),
+        std::move( on_accept_cb ) );
+}
+
+}  // namespace opio::net::tcp
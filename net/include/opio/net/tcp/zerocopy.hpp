@@ -0,0 +1,210 @@
+/**
+ * @file
+ *
+ * This header file contains low level routines for zero-copy send
+ * (`SO_ZEROCOPY`/`MSG_ZEROCOPY`) used by connection_t.
+ *
+ * Zero-copy send is a linux specific feature: the kernel pins
+ * the pages of user buffers instead of copying them into socket buffer.
+ * Which means the buffers must stay intact until the kernel
+ * reports (via socket error queue) that it no longer refers them.
+ *
+ * @see https://docs.kernel.org/networking/msg_zerocopy.html
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <span>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/tcp/gather_write.hpp>
+
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+#    include <cerrno>
+#    include <sys/socket.h>
+#    include <netinet/in.h>
+#    include <linux/errqueue.h>
+
+#    if defined( SO_ZEROCOPY ) && defined( MSG_ZEROCOPY ) \
+        && defined( SO_EE_ORIGIN_ZEROCOPY )
+#        define OPIO_NET_HAS_ZEROCOPY_SEND
+#    endif
+#endif  // defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+#if defined( OPIO_NET_HAS_ZEROCOPY_SEND )
+
+namespace opio::net::tcp::details
+{
+
+//
+// enable_zerocopy_send()
+//
+
+/**
+ * @brief Enable `SO_ZEROCOPY` on a given socket.
+ *
+ * Without it `MSG_ZEROCOPY` flag is silently ignored by kernel.
+ */
+[[nodiscard]] inline asio_ns::error_code enable_zerocopy_send( int fd ) noexcept
+{
+    const int one = 1;
+    if( 0 != ::setsockopt( fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof( one ) ) )
+    {
+        return asio_ns::error_code{ errno, asio_ec::system_category() };
+    }
+
+    return {};
+}
+
+//
+// zerocopy_send_result_t
+//
+
+/**
+ * @brief The result of a single zerocopy sendmsg call.
+ */
+struct zerocopy_send_result_t
+{
+    /**
+     * @brief Number of bytes accepted by the kernel.
+     */
+    std::size_t transferred{};
+
+    /**
+     * @brief Whether the call was a zerocopy one.
+     *
+     * Only such calls consume a notification id, calls that
+     * were retried without `MSG_ZEROCOPY` (`ENOBUFS` case) don't.
+     */
+    bool zerocopy{ false };
+
+    asio_ns::error_code ec;
+};
+
+//
+// zerocopy_sendmsg()
+//
+
+/**
+ * @brief Send a sequence of buffers with `MSG_ZEROCOPY` flag.
+ *
+ * @param fd    Socket descriptor (must be non-blocking).
+ * @param bufs  Buffers to send.
+ * @param iov   Storage for iovecs (limits the number of buffers
+ *              passed in a single call).
+ *
+ * @return The result of a single `sendmsg()` call.
+ */
+template < typename Buf_Descriptors_Span >
+[[nodiscard]] zerocopy_send_result_t zerocopy_sendmsg(
+    int fd,
+    Buf_Descriptors_Span bufs,
+    std::span< ::iovec > iov ) noexcept
+{
+    ::msghdr msg{};
+    msg.msg_iov    = iov.data();
+    msg.msg_iovlen = fill_iovecs( bufs, iov );
+
+    constexpr int common_flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+
+    zerocopy_send_result_t res{};
+
+    auto n = ::sendmsg( fd, &msg, common_flags | MSG_ZEROCOPY );
+    if( n >= 0 ) [[likely]]
+    {
+        res.transferred = static_cast< std::size_t >( n );
+        res.zerocopy    = n > 0;
+        return res;
+    }
+
+    if( ENOBUFS == errno )
+    {
+        // Socket exceeded the limit of pinned pages (optmem_max),
+        // fallback to a regular send for this call.
+        n = ::sendmsg( fd, &msg, common_flags );
+        if( n >= 0 )
+        {
+            res.transferred = static_cast< std::size_t >( n );
+            return res;
+        }
+    }
+
+    const int err = EWOULDBLOCK == errno ? EAGAIN : errno;
+    res.ec = asio_ns::error_code{ err, asio_ec::system_category() };
+    return res;
+}
+
+//
+// drain_zerocopy_notifications()
+//
+
+/**
+ * @brief Read all zerocopy completion notifications
+ *        available in socket's error queue.
+ *
+ * Each notification reports an inclusive range of ids of zerocopy send calls
+ * `[lo, hi]`, which are no longer refer user buffers.
+ *
+ * @param fd        Socket descriptor.
+ * @param on_range  A callback to handle a range: `void(lo, hi, copied)`,
+ *                  where `copied` tells that kernel was unable to avoid copy
+ *                  (it happens for loopback or devices without
+ *                  scatter-gather support).
+ *
+ * @return Number of notifications handled.
+ */
+template < typename On_Range >
+std::size_t drain_zerocopy_notifications( int fd, On_Range && on_range )
+{
+    std::size_t count = 0;
+
+    for( ;; )
+    {
+        alignas( ::cmsghdr ) std::array< char, 128 > control;
+
+        ::msghdr msg{};
+        msg.msg_control    = control.data();
+        msg.msg_controllen = control.size();
+
+        if( ::recvmsg( fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT ) < 0 )
+        {
+            // EAGAIN means error queue is empty.
+            break;
+        }
+
+        for( auto * cm = CMSG_FIRSTHDR( &msg ); nullptr != cm;
+             cm        = CMSG_NXTHDR( &msg, cm ) )
+        {
+            const bool is_recverr =
+                ( SOL_IP == cm->cmsg_level && IP_RECVERR == cm->cmsg_type )
+                || ( SOL_IPV6 == cm->cmsg_level && IPV6_RECVERR == cm->cmsg_type );
+
+            if( !is_recverr )
+            {
+                continue;
+            }
+
+            ::sock_extended_err serr;
+            std::memcpy( &serr, CMSG_DATA( cm ), sizeof( serr ) );
+
+            if( SO_EE_ORIGIN_ZEROCOPY != serr.ee_origin || 0 != serr.ee_errno )
+            {
+                continue;
+            }
+
+            on_range( static_cast< std::uint32_t >( serr.ee_info ),
+                      static_cast< std::uint32_t >( serr.ee_data ),
+                      0 != ( serr.ee_code & SO_EE_CODE_ZEROCOPY_COPIED ) );
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+}  // namespace opio::net::tcp::details
+
+#endif  // defined( OPIO_NET_HAS_ZEROCOPY_SEND )
@@ -0,0 +1,727 @@
+/**
+ * @file
+ *
+ * This header file contains an operation watchdog based on
+ * a hierarchical timing wheel shared by all watchdogs
+ * running on the same asio execution context.
+ *
+ * Unlike asio_timer_operation_watchdog_t which uses a dedicated
+ * asio timer per watchdog (so each start/cancel is an insert/remove in
+ * asio timer heap), this watchdog registers deadlines in a timing wheel
+ * with O(1) start and cancel, and a single asio timer per execution context
+ * drives the wheel. Timeout callbacks are stored in place in watchdog's
+ * timer node, so starting a watch doesn't allocate.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <opio/net/asio_include.hpp>
+#include <opio/net/locking.hpp>
+
+namespace opio::net
+{
+
+//
+// timing_wheel_callback_t
+//
+
+/**
+ * @brief A `void(std::uint64_t)` callback stored in place.
+ *
+ * Unlike std::function it never allocates: a callable must fit
+ * `storage_size` bytes (which is checked at compile time),
+ * that is enough for a lambda capturing a weak_ptr and a couple of words.
+ */
+class timing_wheel_callback_t
+{
+public:
+    using key_t = std::uint64_t;
+
+    static constexpr std::size_t storage_size = 4 * sizeof( void * );
+
+    timing_wheel_callback_t() = default;
+
+    template < typename Callback >
+    explicit timing_wheel_callback_t( Callback cb ) noexcept
+    {
+        emplace( std::move( cb ) );
+    }
+
+    timing_wheel_callback_t( timing_wheel_callback_t && other ) noexcept
+    {
+        take( other );
+    }
+
+    timing_wheel_callback_t & operator=(
+        timing_wheel_callback_t && other ) noexcept
+    {
+        if( this != &other )
+        {
+            reset();
+            take( other );
+        }
+        return *this;
+    }
+
+    timing_wheel_callback_t( const timing_wheel_callback_t & ) = delete;
+    timing_wheel_callback_t & operator=( const timing_wheel_callback_t & ) =
+        delete;
+
+    ~timing_wheel_callback_t() { reset(); }
+
+    /**
+     * @brief Replace the callback with a given one.
+     */
+    template < typename Callback >
+    void emplace( Callback cb ) noexcept
+    {
+        static_assert( sizeof( Callback ) <= storage_size,
+                       "timeout callback is too large to be stored in place" );
+        static_assert( alignof( Callback ) <= alignof( std::max_align_t ) );
+        static_assert( std::is_nothrow_move_constructible_v< Callback > );
+        static_assert( std::is_invocable_v< Callback &, key_t > );
+
+        reset();
+        ::new( static_cast< void * >( m_storage ) ) Callback{ std::move( cb ) };
+        m_ops = &ops_for< Callback >;
+    }
+
+    void reset() noexcept
+    {
+        if( m_ops )
+        {
+            m_ops->destroy( m_storage );
+            m_ops = nullptr;
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return nullptr != m_ops;
+    }
+
+    void operator()( key_t key )
+    {
+        assert( m_ops );
+        m_ops->invoke( m_storage, key );
+    }
+
+private:
+    struct ops_t
+    {
+        void ( *invoke )( void *, key_t );
+        void ( *relocate )( void * from, void * to ) noexcept;
+        void ( *destroy )( void * ) noexcept;
+    };
+
+    template < typename Callback >
+    static constexpr ops_t ops_for{
+        []( void * cb, key_t key ) {
+            ( *static_cast< Callback * >( cb ) )( key );
+        },
+        []( void * from, void * to ) noexcept {
+            auto * cb = static_cast< Callback * >( from );
+            ::new( to ) Callback{ std::move( *cb ) };
+            cb->~Callback();
+        },
+        []( void * cb ) noexcept { static_cast< Callback * >( cb )->~Callback(); }
+    };
+
+    void take( timing_wheel_callback_t & other ) noexcept
+    {
+        if( other.m_ops )
+        {
+            other.m_ops->relocate( other.m_storage, m_storage );
+            m_ops = std::exchange( other.m_ops, nullptr );
+        }
+    }
+
+    alignas( std::max_align_t ) std::byte m_storage[ storage_size ];
+    const ops_t * m_ops{ nullptr };
+};
+
+//
+// timing_wheel_t
+//
+
+/**
+ * @brief Hierarchical timing wheel.
+ *
+ * Time is discrete (measured in ticks), the wheel consists of
+ * several levels each of which has `slots_count` slots.
+ * A slot of level `L` covers `slots_count^L` ticks.
+ * Timer is placed to the lowest level which covers its deadline and
+ * when the wheel comes to a slot of a higher level its timers are
+ * redistributed (cascaded) to the lower levels.
+ *
+ * Timers are intrusive nodes, so arm and cancel are O(1) and
+ * don't allocate.
+ *
+ * The wheel is not thread safe.
+ */
+class timing_wheel_t
+{
+public:
+    using clock_t      = std::chrono::steady_clock;
+    using time_point_t = clock_t::time_point;
+    using duration_t   = clock_t::duration;
+    using key_t        = timing_wheel_callback_t::key_t;
+    using callback_t   = timing_wheel_callback_t;
+
+    static constexpr std::size_t slot_bits    = 6;
+    static constexpr std::size_t slots_count  = std::size_t{ 1 } << slot_bits;
+    static constexpr std::size_t levels_count = 4;
+
+    /**
+     * @brief A timer registered in the wheel.
+     */
+    struct timer_t
+    {
+        timer_t() = default;
+
+        timer_t( const timer_t & ) = delete;
+        timer_t & operator=( const timer_t & ) = delete;
+
+        /**
+         * @brief Tells if timer is in the wheel.
+         */
+        [[nodiscard]] bool is_armed() const noexcept { return nullptr != next; }
+
+        timer_t * prev{ nullptr };
+        timer_t * next{ nullptr };
+
+        //! The tick at which timer expires.
+        std::uint64_t expires_at{};
+
+        //! The key passed to callback.
+        key_t key{};
+        callback_t cb;
+    };
+
+    explicit timing_wheel_t( duration_t tick, time_point_t origin = clock_t::now() )
+        : m_tick{ tick }
+        , m_origin{ origin }
+    {
+        assert( duration_t::zero() < tick );
+
+        for( auto & level : m_levels )
+        {
+            for( auto & slot : level )
+            {
+                slot.prev = &slot;
+                slot.next = &slot;
+            }
+        }
+    }
+
+    timing_wheel_t( const timing_wheel_t & ) = delete;
+    timing_wheel_t & operator=( const timing_wheel_t & ) = delete;
+
+    /**
+     * @brief Register a timer expiring at a given time point.
+     *
+     * If the timer is already armed it is rearmed.
+     *
+     * Timer never expires earlier than the deadline,
+     * but it might be up to one tick late.
+     */
+    void arm( timer_t & t, time_point_t deadline ) noexcept
+    {
+        cancel( t );
+
+        if( 0 == m_size )
+        {
+            // Idle wheel: no need to walk through the ticks
+            // that have passed since the last activity.
+            m_current_tick = tick_of( clock_t::now() );
+        }
+
+        // Round up, so timer doesn't fire earlier.
+        const auto since_origin = deadline - m_origin;
+        const auto ticks =
+            since_origin <= duration_t::zero()
+                ? 0
+                : ( since_origin + m_tick - duration_t{ 1 } ) / m_tick;
+
+        t.expires_at =
+            std::max( static_cast< std::uint64_t >( ticks ), m_current_tick + 1 );
+        schedule( t );
+        ++m_size;
+    }
+
+    /**
+     * @brief Remove a timer from the wheel (if it is there).
+     */
+    void cancel( timer_t & t ) noexcept
+    {
+        if( t.is_armed() )
+        {
+            unlink( t );
+            --m_size;
+        }
+    }
+
+    /**
+     * @brief Move the wheel to a given time point.
+     *
+     * @param now         Current time.
+     * @param on_expired  Handler for expired timers `void(timer_t&)`,
+     *                    timer is already removed from the wheel when called.
+     */
+    template < typename On_Expired >
+    void advance( time_point_t now, On_Expired && on_expired )
+    {
+        const auto target_tick = tick_of( now );
+
+        while( m_current_tick < target_tick )
+        {
+            if( 0 == m_size )
+            {
+                m_current_tick = target_tick;
+                break;
+            }
+
+            ++m_current_tick;
+            cascade();
+
+            auto & slot = m_levels[ 0 ][ m_current_tick & slot_mask ];
+            while( slot.next != &slot )
+            {
+                auto & t = *slot.next;
+                assert( t.expires_at <= m_current_tick );
+                unlink( t );
+                --m_size;
+                on_expired( t );
+            }
+        }
+    }
+
+    /**
+     * @brief Number of armed timers.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    [[nodiscard]] bool empty() const noexcept { return 0 == m_size; }
+
+    /**
+     * @brief Get the time point of the next tick.
+     */
+    [[nodiscard]] time_point_t next_tick_at() const noexcept
+    {
+        return m_origin
+               + m_tick * static_cast< duration_t::rep >( m_current_tick + 1 );
+    }
+
+private:
+    static constexpr std::uint64_t slot_mask = slots_count - 1;
+
+    /**
+     * @brief A mask for ticks within a single slot of a given level.
+     */
+    static constexpr std::uint64_t level_span_mask( std::size_t level ) noexcept
+    {
+        return ( std::uint64_t{ 1 } << ( slot_bits * level ) ) - 1;
+    }
+
+    [[nodiscard]] std::uint64_t tick_of( time_point_t tp ) const noexcept
+    {
+        return tp <= m_origin
+                   ? 0
+                   : static_cast< std::uint64_t >( ( tp - m_origin ) / m_tick );
+    }
+
+    static void link( timer_t & slot, timer_t & t ) noexcept
+    {
+        t.prev          = slot.prev;
+        t.next          = &slot;
+        slot.prev->next = &t;
+        slot.prev       = &t;
+    }
+
+    static void unlink( timer_t & t ) noexcept
+    {
+        t.prev->next = t.next;
+        t.next->prev = t.prev;
+        t.prev       = nullptr;
+        t.next       = nullptr;
+    }
+
+    /**
+     * @brief Place the timer to a proper slot relative to current tick.
+     */
+    void schedule( timer_t & t ) noexcept
+    {
+        if( t.expires_at <= m_current_tick )
+        {
+            // Only happens while cascading: timer is due at current tick.
+            link( m_levels[ 0 ][ m_current_tick & slot_mask ], t );
+            return;
+        }
+
+        // Timers beyond the wheel span go to the farthest slot and
+        // would be rescheduled once it is reached.
+        constexpr std::uint64_t max_delta = level_span_mask( levels_count );
+
+        const auto delta = std::min( t.expires_at - m_current_tick, max_delta );
+        const auto at    = m_current_tick + delta;
+
+        std::size_t level = 0;
+        while( delta > level_span_mask( level + 1 ) )
+        {
+            ++level;
+        }
+
+        link( m_levels[ level ][ ( at >> ( slot_bits * level ) ) & slot_mask ], t );
+    }
+
+    /**
+     * @brief Redistribute timers of higher levels which slots
+     *        start at current tick.
+     */
+    void cascade() noexcept
+    {
+        // Find the highest level to cascade.
+        std::size_t top_level = 0;
+        while( top_level + 1 < levels_count
+               && 0 == ( m_current_tick & level_span_mask( top_level + 1 ) ) )
+        {
+            ++top_level;
+        }
+
+        // Higher levels go first as their timers might land
+        // in the slots of lower levels which are cascaded right after.
+        for( auto level = top_level; 0 < level; --level )
+        {
+            auto & slot =
+                m_levels[ level ][ ( m_current_tick >> ( slot_bits * level ) )
+                                   & slot_mask ];
+
+            if( slot.next == &slot )
+            {
+                continue;
+            }
+
+            // Detach the whole list and reschedule its timers.
+            timer_t * t = slot.next;
+            slot.prev->next = nullptr;
+            slot.prev       = &slot;
+            slot.next       = &slot;
+
+            while( nullptr != t )
+            {
+                auto * next = t->next;
+                t->prev     = nullptr;
+                t->next     = nullptr;
+                schedule( *t );
+                t = next;
+            }
+        }
+    }
+
+    const duration_t m_tick;
+    const time_point_t m_origin;
+
+    //! The last processed tick.
+    std::uint64_t m_current_tick{};
+
+    std::size_t m_size{};
+
+    //! Slots are list heads (sentinels).
+    std::array< std::array< timer_t, slots_count >, levels_count > m_levels;
+};
+
+//
+// basic_timing_wheel_service_t
+//
+
+/**
+ * @brief Asio service that drives a timing wheel shared by
+ *        all the watchdogs running on a given execution context.
+ *
+ * The wheel is guarded with a lock defined by `Locking`
+ * (see opio/net/locking.hpp): a mutex is necessary when watchdogs
+ * are used from different threads, for an execution context
+ * running on a single thread noop_locking_t avoids locking at all.
+ * A single asio timer ticks the wheel while it has armed timers.
+ *
+ * Timeout callbacks are called on the execution context
+ * (not on any strand) and outside of the lock.
+ *
+ * @tparam Locking  Locking type (noop_locking_t or mutex_locking_t).
+ */
+template < typename Locking >
+class basic_timing_wheel_service_t final
+    : public asio_ns::execution_context::service
+{
+public:
+    using timer_t = timing_wheel_t::timer_t;
+
+    /**
+     * @brief The resolution of the wheel.
+     */
+    static constexpr std::chrono::milliseconds tick{ 10 };
+
+    inline static asio_ns::execution_context::id id;
+
+    explicit basic_timing_wheel_service_t( asio_ns::execution_context & ctx )
+        : asio_ns::execution_context::service{ ctx }
+        , m_wheel{ tick }
+    {
+    }
+
+    /**
+     * @brief Arm a timer.
+     *
+     * @param t         Timer.
+     * @param timeout   Timeout from now.
+     * @param key       The key to pass to callback.
+     * @param cb        Callback to call on timeout
+     *                  (is stored in place in the timer).
+     * @param executor  Executor to run the ticking timer on
+     *                  (is used only if the timer doesn't exist yet).
+     */
+    template < typename Callback >
+    void arm( timer_t & t,
+              timing_wheel_t::duration_t timeout,
+              timing_wheel_t::key_t key,
+              Callback cb,
+              const asio_ns::any_io_executor & executor )
+    {
+        lock_guard_t lock{ m_lock };
+
+        if( m_is_shutdown ) [[unlikely]]
+        {
+            return;
+        }
+
+        // Timer might be armed so it can be touched only under the lock.
+        m_wheel.cancel( t );
+        t.key = key;
+        t.cb.emplace( std::move( cb ) );
+        m_wheel.arm( t, timing_wheel_t::clock_t::now() + timeout );
+
+        if( !m_timer ) [[unlikely]]
+        {
+            m_timer.emplace( executor );
+        }
+
+        if( !m_timer_is_running )
+        {
+            schedule_tick();
+        }
+    }
+
+    /**
+     * @brief Cancel a timer.
+     */
+    void cancel( timer_t & t ) noexcept
+    {
+        lock_guard_t lock{ m_lock };
+        m_wheel.cancel( t );
+    }
+
+private:
+    using lock_t       = typename Locking::lock_t;
+    using lock_guard_t = typename Locking::lock_guard_t;
+
+    void shutdown() override
+    {
+        lock_guard_t lock{ m_lock };
+        m_is_shutdown = true;
+        m_timer.reset();
+    }
+
+    /**
+     * @brief Schedule next tick.
+     *
+     * @pre Lock is held.
+     */
+    void schedule_tick()
+    {
+        m_timer_is_running = true;
+        m_timer->expires_at( m_wheel.next_tick_at() );
+        m_timer->async_wait( [ this ]( const auto & ec ) {
+            if( !ec )
+            {
+                on_tick();
+            }
+        } );
+    }
+
+    void on_tick()
+    {
+        // Another tick might run concurrently (on multithreaded io_context)
+        // once the next one is scheduled, so expired callbacks are taken
+        // into a local storage under the lock and called outside of it.
+        std::vector<
+            std::pair< timing_wheel_t::key_t, timing_wheel_t::callback_t > >
+            expired;
+        {
+            lock_guard_t lock{ m_lock };
+            m_timer_is_running = false;
+
+            if( m_is_shutdown ) [[unlikely]]
+            {
+                return;
+            }
+
+            m_wheel.advance( timing_wheel_t::clock_t::now(), [ & ]( auto & t ) {
+                expired.emplace_back( t.key, std::move( t.cb ) );
+            } );
+
+            if( !m_wheel.empty() )
+            {
+                schedule_tick();
+            }
+        }
+
+        for( auto & [ key, cb ] : expired )
+        {
+            cb( key );
+        }
+    }
+
+    lock_t m_lock;
+    timing_wheel_t m_wheel;
+    std::optional< asio_ns::steady_timer > m_timer;
+    bool m_timer_is_running{ false };
+    bool m_is_shutdown{ false };
+};
+
+/**
+ * @brief Timing wheel service for execution contexts running
+ *        on several threads.
+ */
+using timing_wheel_service_t = basic_timing_wheel_service_t< mutex_locking_t >;
+
+/**
+ * @brief Timing wheel service for execution contexts running
+ *        on a single thread.
+ */
+using timing_wheel_service_st_t = basic_timing_wheel_service_t< noop_locking_t >;
+
+//
+// basic_timing_wheel_operation_watchdog_t
+//
+
+/**
+ * @brief Watchdog based on a timing wheel shared by all watchdogs
+ *        of the same execution context.
+ *
+ * Acts as one of a customization point for `connection_t<Traits>` class
+ * (a drop-in replacement for asio_timer_operation_watchdog_t).
+ *
+ * @note The execution context must outlive the watchdog.
+ *
+ * @tparam Locking  Locking type of the wheel
+ *                  (see basic_timing_wheel_service_t).
+ */
+template < typename Locking >
+class basic_timing_wheel_operation_watchdog_t final
+{
+public:
+    using timeout_event_key_t = timing_wheel_t::key_t;
+    using service_t           = basic_timing_wheel_service_t< Locking >;
+
+    explicit basic_timing_wheel_operation_watchdog_t(
+        asio_ns::any_io_executor executor )
+        : m_service{ &asio_ns::use_service< service_t >(
+            asio_ns::query( executor, asio_ns::execution::context ) ) }
+        , m_executor{ std::move( executor ) }
+        , m_timer{ std::make_unique< timing_wheel_t::timer_t >() }
+    {
+    }
+
+    explicit basic_timing_wheel_operation_watchdog_t( asio_ns::io_context & ioctx )
+        : basic_timing_wheel_operation_watchdog_t{ asio_ns::any_io_executor{
+            ioctx.get_executor() } }
+    {
+    }
+
+    basic_timing_wheel_operation_watchdog_t(
+        const basic_timing_wheel_operation_watchdog_t & ) = delete;
+    basic_timing_wheel_operation_watchdog_t(
+        basic_timing_wheel_operation_watchdog_t && ) = default;
+    basic_timing_wheel_operation_watchdog_t & operator=(
+        const basic_timing_wheel_operation_watchdog_t & ) = delete;
+    basic_timing_wheel_operation_watchdog_t & operator=(
+        basic_timing_wheel_operation_watchdog_t && ) = default;
+
+    ~basic_timing_wheel_operation_watchdog_t()
+    {
+        if( m_timer )
+        {
+            m_service->cancel( *m_timer );
+        }
+    }
+
+    /**
+     * @brief Start watching operation.
+     *
+     * @param cb  Callback `void(timeout_event_key_t)`, it is stored
+     *            in place (see timing_wheel_callback_t).
+     */
+    template < typename Callback >
+    void start_watch_operation( std::chrono::steady_clock::duration timeout,
+                                Callback cb )
+    {
+        // Memo `timeout_event_key` to make sure we do not
+        // trigger on cancelled timer.
+        m_service->arm(
+            *m_timer, timeout, ++m_timeout_key, std::move( cb ), m_executor );
+    }
+
+    /**
+     * @brief Get any scheduled check.
+     */
+    void cancel_watch_operation() noexcept
+    {
+        m_service->cancel( *m_timer );
+        ++m_timeout_key;
+    }
+
+    /**
+     * @brief Get current timeout key.
+     */
+    [[nodiscard]] timeout_event_key_t timeout_key() const noexcept
+    {
+        return m_timeout_key;
+    };
+
+private:
+    service_t * m_service;
+    asio_ns::any_io_executor m_executor;
+
+    //! Timer node (has a stable address as it is linked into the wheel).
+    std::unique_ptr< timing_wheel_t::timer_t > m_timer;
+    timeout_event_key_t m_timeout_key{};
+};
+
+/**
+ * @brief Timing wheel watchdog for execution contexts running
+ *        on several threads.
+ */
+using timing_wheel_operation_watchdog_t =
+    basic_timing_wheel_operation_watchdog_t< mutex_locking_t >;
+
+/**
+ * @brief Timing wheel watchdog for execution contexts running
+ *        on a single thread (the wheel is not locked).
+ */
+using timing_wheel_operation_watchdog_st_t =
+    basic_timing_wheel_operation_watchdog_t< noop_locking_t >;
+
+}  // namespace opio::net
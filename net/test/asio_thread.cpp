@@ -0,0 +1,105 @@
+#include <opio/net/asio_thread.hpp>
+
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;         // NOLINT
+using namespace opio::test_utils;  // NOLINT
+
+using namespace std::chrono_literals;
+
+using asio_thread_t = opio::net::asio_thread_t< opio::logger::logger_t >;
+
+void run_on( asio_thread_t & t )
+{
+    std::promise< void > p;
+    asio_ns::post( t.ioctx(), [ & ] { p.set_value(); } );
+    p.get_future().get();
+}
+
+TEST( OpioNetAsioThread, Blocking )  // NOLINT
+{
+    asio_thread_t t{ false, make_test_logger( "THREAD" ) };
+    t.start();
+
+    run_on( t );
+
+    t.stop();
+    t.join();
+    EXPECT_EQ( t.stats().parks, 0 );
+    EXPECT_EQ( t.stats().spin_hits, 0 );
+}
+
+void wait_for_park( asio_thread_t & t, std::uint64_t parks_before )
+{
+    while( parks_before == t.stats().parks )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+}
+
+TEST( OpioNetAsioThread, SpinThenPark )  // NOLINT
+{
+    event_loop_cfg_t cfg;
+    cfg.spin_window = 1ms;
+
+    asio_thread_t t{ cfg, make_test_logger( "THREAD" ) };
+    t.start();
+
+    // Idle loop parks once the window expires.
+    wait_for_park( t, 0 );
+
+    // A parked loop wakes up on post and runs the handler,
+    // then parks again.
+    for( int i = 0; i < 3; ++i )
+    {
+        const auto parks = t.stats().parks.load();
+
+        std::promise< void > p;
+        asio_ns::post( t.ioctx(), [ & ] { p.set_value(); } );
+        ASSERT_EQ( p.get_future().wait_for( 5s ), std::future_status::ready );
+
+        wait_for_park( t, parks );
+        EXPECT_EQ( t.stats().spin_hits, 0 );
+    }
+
+    // A handler posted by a handler is run by the spinning loop.
+    const auto parks = t.stats().parks.load();
+
+    std::promise< void > p;
+    asio_ns::post( t.ioctx(), [ & ] {
+        asio_ns::post( t.ioctx(), [ & ] { p.set_value(); } );
+    } );
+    ASSERT_EQ( p.get_future().wait_for( 5s ), std::future_status::ready );
+
+    wait_for_park( t, parks );
+    EXPECT_EQ( t.stats().spin_hits, 1 );
+
+    t.stop();
+    t.join();
+}
+
+TEST( OpioNetAsioThread, StopWhileParked )  // NOLINT
+{
+    event_loop_cfg_t cfg;
+    cfg.spin_window = 1ms;
+
+    asio_thread_t t{ cfg, make_test_logger( "THREAD" ) };
+    t.start();
+
+    while( 0 == t.stats().parks )
+    {
+        std::this_thread::sleep_for( 1ms );
+    }
+
+    t.stop();
+    t.join();
+}
+
+}  // anonymous namespace
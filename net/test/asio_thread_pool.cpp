@@ -0,0 +1,200 @@
+#include <opio/net/asio_thread_pool.hpp>
+
+#include <array>
+#include <future>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;           // NOLINT
+using namespace opio::test_utils;    // NOLINT
+
+using pool_t = asio_thread_pool_t< opio::logger::logger_t >;
+
+TEST( OpioNetAsioThreadPool, ParseCpuList )  // NOLINT
+{
+    EXPECT_EQ( details::parse_cpu_list( "0" ), ( std::vector< int >{ 0 } ) );
+    EXPECT_EQ( details::parse_cpu_list( "0-3\n" ),
+               ( std::vector< int >{ 0, 1, 2, 3 } ) );
+    EXPECT_EQ( details::parse_cpu_list( "0-1,8,10-11" ),
+               ( std::vector< int >{ 0, 1, 8, 10, 11 } ) );
+
+    EXPECT_TRUE( details::parse_cpu_list( "" ).empty() );
+    EXPECT_TRUE( details::parse_cpu_list( "x" ).empty() );
+    EXPECT_TRUE( details::parse_cpu_list( "3-1" ).empty() );
+    EXPECT_TRUE( details::parse_cpu_list( "1;2" ).empty() );
+}
+
+TEST( OpioNetAsioThreadPool, InvalidCpu )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 2;
+
+    cfg.cpus = { 0, -1 };
+    EXPECT_THROW( ( pool_t{ cfg, make_test_logger( "POOL" ) } ),
+                  std::runtime_error );
+
+#if defined( __linux__ )
+    cfg.cpus = { CPU_SETSIZE };
+    EXPECT_THROW( ( pool_t{ cfg, make_test_logger( "POOL" ) } ),
+                  std::runtime_error );
+#endif  // defined( __linux__ )
+
+    cfg.cpus = { 0 };
+    EXPECT_NO_THROW( ( pool_t{ cfg, make_test_logger( "POOL" ) } ) );
+}
+
+TEST( OpioNetAsioThreadPool, ThreadPerContext )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 3;
+    cfg.cpus          = { 0 };
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+    ASSERT_EQ( pool.size(), 3 );
+    pool.start();
+
+    std::set< std::thread::id > ids;
+    for( std::size_t i = 0; i < pool.size(); ++i )
+    {
+        std::promise< std::thread::id > p;
+        asio_ns::post( pool.ioctx( i ),
+                       [ & ] { p.set_value( std::this_thread::get_id() ); } );
+        ids.insert( p.get_future().get() );
+    }
+
+    EXPECT_EQ( ids.size(), 3 );
+    EXPECT_EQ( ids.count( std::this_thread::get_id() ), 0 );
+
+#if defined( __linux__ )
+    // Thread is named and pinned.
+    std::promise< std::pair< std::string, bool > > p;
+    asio_ns::post( pool.ioctx( 1 ), [ & ] {
+        std::array< char, 16 > name{};
+        ::pthread_getname_np( ::pthread_self(), name.data(), name.size() );
+
+        cpu_set_t cpuset;
+        CPU_ZERO( &cpuset );
+        ::pthread_getaffinity_np( ::pthread_self(), sizeof( cpuset ), &cpuset );
+        p.set_value( { std::string{ name.data() },
+                       1 == CPU_COUNT( &cpuset ) && CPU_ISSET( 0, &cpuset ) } );
+    } );
+    const auto [ name, pinned ] = p.get_future().get();
+    EXPECT_EQ( name, "opio_io1" );
+    EXPECT_TRUE( pinned );
+#endif  // defined( __linux__ )
+
+    pool.stop();
+    pool.join();
+}
+
+TEST( OpioNetAsioThreadPool, RoundRobinPicker )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 3;
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+
+    EXPECT_EQ( pool.pick_index(), 0 );
+    EXPECT_EQ( pool.pick_index(), 1 );
+    EXPECT_EQ( pool.pick_index(), 2 );
+    EXPECT_EQ( &pool.pick_ioctx(), &pool.ioctx( 0 ) );
+}
+
+TEST( OpioNetAsioThreadPool, LeastLoadedPicker )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 3;
+    cfg.picker        = io_context_picker::least_loaded;
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+
+    pool.add_load( 0, 5 );
+    pool.add_load( 1, 2 );
+    pool.add_load( 2, 7 );
+
+    for( int i = 0; i < 5; ++i )
+    {
+        EXPECT_EQ( pool.pick_index(), 1 );
+    }
+
+    pool.add_load( 2, -7 );
+    EXPECT_EQ( pool.load( 2 ), 0 );
+    EXPECT_EQ( pool.pick_index(), 2 );
+
+    // Ties are spread.
+    pool.add_load( 0, -5 );
+    pool.add_load( 1, -2 );
+    std::set< std::size_t > picked;
+    for( int i = 0; i < 3; ++i )
+    {
+        picked.insert( pool.pick_index() );
+    }
+    EXPECT_EQ( picked.size(), 3 );
+}
+
+TEST( OpioNetAsioThreadPool, IndexOfExecutor )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 3;
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+
+    for( std::size_t i = 0; i < pool.size(); ++i )
+    {
+        EXPECT_EQ( pool.index_of( pool.ioctx( i ).get_executor() ), i );
+    }
+    EXPECT_EQ( pool.index_of( pool.pick_executor() ), 0 );
+    EXPECT_EQ( pool.index_of( pool.pick_executor() ), 1 );
+
+    asio_ns::io_context other_ioctx;
+    EXPECT_FALSE( pool.index_of( other_ioctx.get_executor() ) );
+
+    asio_ns::strand< asio_ns::io_context::executor_type > strand{
+        pool.ioctx( 2 ).get_executor()
+    };
+    EXPECT_EQ( pool.index_of( strand ), 2 );
+    EXPECT_FALSE( pool.index_of( asio_ns::any_io_executor{} ) );
+}
+
+TEST( OpioNetAsioThreadPool, SpinThenPark )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 2;
+    cfg.spin_window   = std::chrono::microseconds{ 100 };
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+    pool.start();
+
+    for( std::size_t i = 0; i < pool.size(); ++i )
+    {
+        while( 0 == pool.stats( i ).parks )
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    pool.stop();
+    pool.join();
+}
+
+TEST( OpioNetAsioThreadPool, StopsOnDestruction )  // NOLINT
+{
+    asio_thread_pool_cfg_t cfg;
+    cfg.threads_count = 2;
+    cfg.busy_wait     = true;
+
+    pool_t pool{ cfg, make_test_logger( "POOL" ) };
+    pool.start();
+
+    std::promise< void > p;
+    asio_ns::post( pool.ioctx( 1 ), [ & ] { p.set_value(); } );
+    p.get_future().get();
+}
+
+}  // anonymous namespace
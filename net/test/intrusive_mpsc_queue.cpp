@@ -0,0 +1,102 @@
+#include <opio/net/intrusive_mpsc_queue.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;  // NOLINT
+
+struct node_t
+{
+    node_t * next{};
+    std::size_t producer{};
+    std::size_t value{};
+};
+
+TEST( OpioNet, IntrusiveMpscQueueFifo )  // NOLINT
+{
+    intrusive_mpsc_queue_t< node_t > q;
+
+    EXPECT_TRUE( q.empty() );
+    EXPECT_EQ( q.pop_all(), nullptr );
+
+    std::vector< node_t > nodes( 5 );
+    for( std::size_t i = 0; i < nodes.size(); ++i )
+    {
+        nodes[ i ].value = i;
+        EXPECT_EQ( q.push( &nodes[ i ] ), i == 0 );
+    }
+    EXPECT_FALSE( q.empty() );
+
+    std::size_t expected = 0;
+    for( auto * n = q.pop_all(); nullptr != n; n = n->next )
+    {
+        EXPECT_EQ( n->value, expected++ );
+    }
+    EXPECT_EQ( expected, nodes.size() );
+    EXPECT_TRUE( q.empty() );
+
+    // Queue is reusable after pop_all().
+    EXPECT_TRUE( q.push( &nodes[ 0 ] ) );
+    auto * n = q.pop_all();
+    ASSERT_EQ( n, &nodes[ 0 ] );
+    EXPECT_EQ( n->next, nullptr );
+}
+
+TEST( OpioNet, IntrusiveMpscQueueMultipleProducers )  // NOLINT
+{
+    constexpr std::size_t producers_count    = 4;
+    constexpr std::size_t nodes_per_producer = 20000;
+
+    intrusive_mpsc_queue_t< node_t > q;
+
+    std::vector< std::vector< node_t > > nodes( producers_count );
+    std::vector< std::thread > producers;
+
+    for( std::size_t p = 0; p < producers_count; ++p )
+    {
+        nodes[ p ].resize( nodes_per_producer );
+        producers.emplace_back( [ &, p ] {
+            for( std::size_t i = 0; i < nodes_per_producer; ++i )
+            {
+                auto & n   = nodes[ p ][ i ];
+                n.producer = p;
+                n.value    = i;
+                q.push( &n );
+            }
+        } );
+    }
+
+    std::vector< std::size_t > next_expected( producers_count, 0 );
+    std::size_t total = 0;
+
+    auto consume = [ & ] {
+        for( auto * n = q.pop_all(); nullptr != n; n = n->next )
+        {
+            // Order of a given producer must be preserved.
+            ASSERT_EQ( n->value, next_expected[ n->producer ] );
+            ++next_expected[ n->producer ];
+            ++total;
+        }
+    };
+
+    while( total < producers_count * nodes_per_producer )
+    {
+        consume();
+    }
+
+    for( auto & t : producers )
+    {
+        t.join();
+    }
+
+    consume();
+    EXPECT_EQ( total, producers_count * nodes_per_producer );
+    EXPECT_TRUE( q.empty() );
+}
+
+}  // anonymous namespace
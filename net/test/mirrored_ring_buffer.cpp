@@ -0,0 +1,247 @@
+#include <opio/net/mirrored_ring_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;  // NOLINT
+
+using ring_driver_t = mirrored_ring_input_buffer_driver_t<>;
+
+void fill( mirrored_ring_buffer_t & buf, char c )
+{
+    std::memset( buf.data(), c, buf.size() );
+}
+
+TEST( OpioNetMirroredRingBuffer, RingIsMirrored )  // NOLINT
+{
+    details::mirrored_ring_t ring{ 1 };
+    const auto cap = ring.capacity();
+
+    ASSERT_LT( 0, cap );
+    EXPECT_EQ( ring.at( 0 ) + 1, ring.at( 1 ) );
+    EXPECT_EQ( ring.at( cap ), ring.at( 0 ) );
+
+    // A write to the tail of the first mapping
+    // is visible at the beginning of the second one and vice versa.
+    *ring.at( cap - 1 ) = std::byte{ 'x' };
+    EXPECT_EQ( *( ring.at( 0 ) + 2 * cap - 1 ), std::byte{ 'x' } );
+
+    *( ring.at( 0 ) + cap ) = std::byte{ 'y' };
+    EXPECT_EQ( *ring.at( 0 ), std::byte{ 'y' } );
+}
+
+TEST( OpioNetMirroredRingBuffer, ReserveCommitRelease )  // NOLINT
+{
+    details::mirrored_ring_t ring{ 4096 };
+    const auto cap = ring.capacity();
+
+    std::uint64_t offset{};
+    ASSERT_EQ( ring.reserve( 100, offset ), 100 );
+    EXPECT_EQ( offset, 0 );
+
+    // Only one reservation at a time.
+    std::uint64_t offset2{};
+    EXPECT_EQ( ring.reserve( 100, offset2 ), 0 );
+
+    ring.commit( 10 );
+    EXPECT_EQ( ring.used_size(), 10 );
+
+    ASSERT_EQ( ring.reserve( 2 * cap, offset ), cap - 10 );
+    EXPECT_EQ( offset, 10 );
+    ring.commit( cap - 10 );
+    EXPECT_EQ( ring.used_size(), cap );
+
+    // Full.
+    EXPECT_EQ( ring.reserve( 1, offset ), 0 );
+
+    // Out of order release.
+    ring.release( 10, cap - 10 );
+    EXPECT_EQ( ring.used_size(), cap );
+    ring.release( 0, 10 );
+    EXPECT_EQ( ring.used_size(), 0 );
+
+    ASSERT_EQ( ring.reserve( 2 * cap, offset ), cap );
+    EXPECT_EQ( offset, cap );
+    ring.cancel_reservation();
+    EXPECT_EQ( ring.used_size(), 0 );
+}
+
+TEST( OpioNetMirroredRingBuffer, DriverAllocateInput )  // NOLINT
+{
+    ring_driver_t driver{ 64 * 1024 };
+
+    auto buf = driver.allocate_input( 1000 );
+    ASSERT_TRUE( buf.is_in_ring() );
+    EXPECT_EQ( buf.size(), 1000 );
+    fill( buf, 'a' );
+
+    auto data = driver.reduce_size_input( std::move( buf ), 10 );
+    EXPECT_EQ( data.size(), 10 );
+    EXPECT_EQ( data.make_string_view(), "aaaaaaaaaa" );
+
+    // Next input goes right after the data.
+    auto buf2 = driver.allocate_input( 1000 );
+    EXPECT_EQ( data.data() + data.size(), buf2.data() );
+
+    auto data2 = driver.reduce_size_input( std::move( buf2 ), 0 );
+    EXPECT_EQ( data2.size(), 0 );
+}
+
+TEST( OpioNetMirroredRingBuffer, MergeIsContiguousOverWrap )  // NOLINT
+{
+    ring_driver_t driver{ 64 * 1024 };
+    const auto cap = driver.ring_capacity();
+
+    // Move ring position close to the end.
+    {
+        auto buf = driver.allocate_input( cap - 100 );
+        ASSERT_EQ( buf.size(), cap - 100 );
+        auto data = driver.reduce_size_input( std::move( buf ), cap - 100 );
+    }
+
+    auto buf1 = driver.allocate_input( 60 );
+    fill( buf1, '1' );
+    auto data1 = driver.reduce_size_input( std::move( buf1 ), 60 );
+
+    // This one wraps.
+    auto buf2 = driver.allocate_input( 100 );
+    fill( buf2, '2' );
+    auto data2 = driver.reduce_size_input( std::move( buf2 ), 100 );
+
+    auto buf3 = driver.allocate_input( 100 );
+    fill( buf3, '3' );
+    auto data3 = driver.reduce_size_input( std::move( buf3 ), 100 );
+
+    ASSERT_TRUE( data1.try_merge( data2 ) );
+    EXPECT_EQ( data2.size(), 0 );
+    EXPECT_FALSE( data2.is_in_ring() );
+    ASSERT_TRUE( data1.try_merge( data3 ) );
+
+    EXPECT_EQ( data1.make_string_view(),
+               std::string( 60, '1' ) + std::string( 100, '2' )
+                   + std::string( 100, '3' ) );
+
+    // Not adjacent.
+    auto buf4 = driver.allocate_input( 100 );
+    auto data4 = driver.reduce_size_input( std::move( buf4 ), 100 );
+    auto buf5  = driver.allocate_input( 100 );
+    auto data5 = driver.reduce_size_input( std::move( buf5 ), 100 );
+    EXPECT_FALSE( data1.try_merge( data5 ) );
+
+    // Reservation can't be merged.
+    auto buf6 = driver.allocate_input( 100 );
+    EXPECT_FALSE( data5.try_merge( buf6 ) );
+}
+
+TEST( OpioNetMirroredRingBuffer, FullRingStartsNewOne )  // NOLINT
+{
+    ring_driver_t driver{ 64 * 1024 };
+    const auto cap = driver.ring_capacity();
+
+    auto buf  = driver.allocate_input( cap );
+    auto data = driver.reduce_size_input( std::move( buf ), cap );
+
+    // The data is kept, so there is no space in the ring.
+    auto buf2 = driver.allocate_input( 1000 );
+    EXPECT_EQ( buf2.size(), 1000 );
+    EXPECT_TRUE( buf2.is_in_ring() );
+
+    auto data2 = driver.reduce_size_input( std::move( buf2 ), 1000 );
+    EXPECT_FALSE( data.try_merge( data2 ) );
+
+    // A copy of a driver starts its own ring.
+    ring_driver_t driver_copy{ driver };
+    auto buf3 = driver_copy.allocate_input( 1000 );
+    EXPECT_EQ( buf3.size(), 1000 );
+}
+
+TEST( OpioNetMirroredRingBuffer, ResizeDetaches )  // NOLINT
+{
+    ring_driver_t driver{ 64 * 1024 };
+
+    auto buf = driver.allocate_input( 100 );
+    fill( buf, 'x' );
+    auto data = driver.reduce_size_input( std::move( buf ), 5 );
+
+    data.resize( 3 );
+    EXPECT_TRUE( data.is_in_ring() );
+    EXPECT_EQ( data.make_string_view(), "xxx" );
+
+    data.resize( 10 );
+    EXPECT_FALSE( data.is_in_ring() );
+    ASSERT_EQ( data.size(), 10 );
+    EXPECT_EQ( data.make_string_view().substr( 0, 3 ), "xxx" );
+
+    // Ring space is released.
+    auto buf2 = driver.allocate_input( 100 );
+    auto data2 = driver.reduce_size_input( std::move( buf2 ), 100 );
+    EXPECT_TRUE( data2.is_in_ring() );
+}
+
+TEST( OpioNetMirroredRingBuffer, ConsumeReleasesPrefix )  // NOLINT
+{
+    ring_driver_t driver{ 64 * 1024 };
+    const auto cap = driver.ring_capacity();
+
+    auto buf1  = driver.allocate_input( 100 );
+    fill( buf1, '1' );
+    auto data1 = driver.reduce_size_input( std::move( buf1 ), 100 );
+    const auto * ring_base = data1.data();
+
+    data1.consume( 60 );
+    EXPECT_EQ( data1.size(), 40 );
+    EXPECT_EQ( data1.data(), ring_base + 60 );
+
+    // Consumed prefix is given back, the rest is still kept.
+    auto buf2 = driver.allocate_input( 2 * cap );
+    EXPECT_EQ( buf2.size(), cap - 40 );
+    fill( buf2, '2' );
+    auto data2 = driver.reduce_size_input( std::move( buf2 ), 10 );
+
+    ASSERT_TRUE( data1.try_merge( data2 ) );
+    EXPECT_EQ( data1.make_string_view(),
+               std::string( 40, '1' ) + std::string( 10, '2' ) );
+
+    data1.consume( 50 );
+    EXPECT_TRUE( data1.empty() );
+
+    auto buf3 = driver.allocate_input( 2 * cap );
+    EXPECT_EQ( buf3.size(), cap );
+    EXPECT_GE( buf3.data(), ring_base );
+    EXPECT_LT( buf3.data(), ring_base + 2 * cap );
+}
+
+TEST( OpioNetMirroredRingBuffer, ManyOutOfOrderReleases )  // NOLINT
+{
+    details::mirrored_ring_t ring{ 64 * 1024 };
+    const auto cap = ring.capacity();
+
+    std::uint64_t offset{};
+    ASSERT_EQ( ring.reserve( cap, offset ), cap );
+    ring.commit( cap );
+
+    // Release every other range first, there are more of them
+    // than the preallocated storage for pending ranges has.
+    constexpr std::size_t range_size = 64;
+    const auto ranges_count          = cap / range_size;
+    ASSERT_LT( 2 * 64, ranges_count );
+
+    for( std::size_t i = 1; i < ranges_count; i += 2 )
+    {
+        ring.release( i * range_size, range_size );
+    }
+    for( std::size_t i = 0; i < ranges_count; i += 2 )
+    {
+        ring.release( i * range_size, range_size );
+    }
+
+    EXPECT_EQ( ring.used_size(), 0 );
+}
+
+}  // anonymous namespace
+
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
@@ -1,6 +1,9 @@
 #include <opio/net/operation_watchdog.hpp>
+#include <opio/net/timing_wheel_operation_watchdog.hpp>
 
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -59,4 +62,173 @@ TEST( OpioNet, OperationWatchdogTriggerSecond )  // NOLINT
     ioctx.run();
 }
 
+TEST( OpioNet, TimingWheelExpiresInTime )  // NOLINT
+{
+    // A huge tick makes the test independent of the real clock.
+    constexpr auto tick = std::chrono::hours( 1 );
+    const auto origin   = std::chrono::steady_clock::now();
+
+    timing_wheel_t wheel{ tick, origin };
+
+    const std::vector< std::uint64_t > deadlines{
+        1, 2, 63, 64, 65, 127, 128, 4095, 4096, 4097, 262'143, 262'144, 300'000
+    };
+
+    std::vector< timing_wheel_t::timer_t > timers( deadlines.size() );
+    for( std::size_t i = 0; i < deadlines.size(); ++i )
+    {
+        timers[ i ].key = i;
+        wheel.arm( timers[ i ], origin + tick * deadlines[ i ] );
+    }
+    EXPECT_EQ( wheel.size(), deadlines.size() );
+
+    std::size_t next_to_expire = 0;
+    for( std::uint64_t t = 1; t <= deadlines.back(); ++t )
+    {
+        wheel.advance( origin + tick * t, [ & ]( auto & timer ) {
+            ASSERT_LT( next_to_expire, deadlines.size() );
+            EXPECT_EQ( timer.key, next_to_expire );
+            EXPECT_EQ( deadlines[ next_to_expire ], t );
+            EXPECT_FALSE( timer.is_armed() );
+            ++next_to_expire;
+        } );
+    }
+
+    EXPECT_EQ( next_to_expire, deadlines.size() );
+    EXPECT_TRUE( wheel.empty() );
+}
+
+TEST( OpioNet, TimingWheelCancel )  // NOLINT
+{
+    constexpr auto tick = std::chrono::hours( 1 );
+    const auto origin   = std::chrono::steady_clock::now();
+
+    timing_wheel_t wheel{ tick, origin };
+
+    timing_wheel_t::timer_t t1;
+    timing_wheel_t::timer_t t2;
+    wheel.arm( t1, origin + tick * 10 );
+    wheel.arm( t2, origin + tick * 100 );
+    EXPECT_TRUE( t1.is_armed() );
+    EXPECT_EQ( wheel.size(), 2 );
+
+    wheel.cancel( t1 );
+    EXPECT_FALSE( t1.is_armed() );
+    EXPECT_EQ( wheel.size(), 1 );
+
+    // Rearm.
+    wheel.arm( t2, origin + tick * 20 );
+    EXPECT_EQ( wheel.size(), 1 );
+
+    std::size_t expired = 0;
+    wheel.advance( origin + tick * 200, [ & ]( auto & timer ) {
+        EXPECT_EQ( &timer, &t2 );
+        ++expired;
+    } );
+    EXPECT_EQ( expired, 1 );
+    EXPECT_TRUE( wheel.empty() );
+}
+
+TEST( OpioNet, TimingWheelCallback )  // NOLINT
+{
+    auto counter = std::make_shared< int >( 0 );
+
+    timing_wheel_callback_t cb1;
+    EXPECT_FALSE( cb1 );
+
+    cb1.emplace( [ counter ]( auto k ) { *counter += static_cast< int >( k ); } );
+    ASSERT_TRUE( cb1 );
+    EXPECT_EQ( counter.use_count(), 2 );
+
+    timing_wheel_callback_t cb2{ std::move( cb1 ) };
+    EXPECT_FALSE( cb1 );  // NOLINT
+    ASSERT_TRUE( cb2 );
+    EXPECT_EQ( counter.use_count(), 2 );
+
+    cb2( 3 );
+    EXPECT_EQ( *counter, 3 );
+
+    cb1 = std::move( cb2 );
+    cb1( 4 );
+    EXPECT_EQ( *counter, 7 );
+
+    cb1.reset();
+    EXPECT_FALSE( cb1 );
+    EXPECT_EQ( counter.use_count(), 1 );
+}
+
+template < typename Watchdog >
+void run_timing_wheel_watchdog_trigger_test()
+{
+    asio_ns::io_context ioctx;
+    Watchdog wd{ ioctx };
+
+    bool triggered = false;
+    const auto started_at = std::chrono::steady_clock::now();
+    wd.start_watch_operation( std::chrono::milliseconds( 30 ), [ & ]( auto k ) {
+        ASSERT_EQ( k, wd.timeout_key() );
+        triggered = true;
+    } );
+    ioctx.run();
+
+    EXPECT_TRUE( triggered );
+    EXPECT_LE( std::chrono::milliseconds( 30 ),
+               std::chrono::steady_clock::now() - started_at );
+}
+
+TEST( OpioNet, TimingWheelWatchdogTrigger )  // NOLINT
+{
+    run_timing_wheel_watchdog_trigger_test< timing_wheel_operation_watchdog_t >();
+}
+
+TEST( OpioNet, TimingWheelWatchdogTriggerSt )  // NOLINT
+{
+    run_timing_wheel_watchdog_trigger_test<
+        timing_wheel_operation_watchdog_st_t >();
+}
+
+TEST( OpioNet, TimingWheelWatchdogNoTrigger )  // NOLINT
+{
+    asio_ns::io_context ioctx;
+    timing_wheel_operation_watchdog_t wd{ ioctx };
+    wd.start_watch_operation( std::chrono::milliseconds( 10 ), []( auto /*k*/ ) {
+        FAIL() << "SHOULD NOT BE CALLED!";
+    } );
+    auto original_key = wd.timeout_key();
+    ioctx.poll();
+    ASSERT_EQ( original_key, wd.timeout_key() );
+    wd.cancel_watch_operation();
+    ioctx.run();
+    ASSERT_NE( original_key, wd.timeout_key() );
+}
+
+TEST( OpioNet, TimingWheelWatchdogShared )  // NOLINT
+{
+    asio_ns::io_context ioctx;
+
+    std::vector< timing_wheel_operation_watchdog_t > watchdogs;
+    for( int i = 0; i < 100; ++i )
+    {
+        watchdogs.emplace_back( ioctx );
+    }
+
+    std::size_t triggered = 0;
+    for( std::size_t i = 0; i < watchdogs.size(); ++i )
+    {
+        watchdogs[ i ].start_watch_operation(
+            std::chrono::milliseconds( 10 + i % 10 ), [ & ]( auto /*k*/ ) {
+                ++triggered;
+            } );
+    }
+
+    // Cancel every other.
+    for( std::size_t i = 0; i < watchdogs.size(); i += 2 )
+    {
+        watchdogs[ i ].cancel_watch_operation();
+    }
+
+    ioctx.run();
+    EXPECT_EQ( triggered, watchdogs.size() / 2 );
+}
+
 }  // anonymous namespace
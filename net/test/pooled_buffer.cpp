@@ -0,0 +1,223 @@
+#include <cstring>
+#include <thread>
+
+#include <opio/net/pooled_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;  // NOLINT
+
+TEST( OpioNetPooledBuffer, SizeClasses )  // NOLINT
+{
+    using namespace opio::net::details;  // NOLINT
+
+    EXPECT_EQ( pooled_size_class_of( 0 ), 0 );
+    EXPECT_EQ( pooled_size_class_of( 1 ), 0 );
+    EXPECT_EQ( pooled_size_class_of( 64 ), 0 );
+    EXPECT_EQ( pooled_size_class_of( 65 ), 1 );
+    EXPECT_EQ( pooled_size_class_of( 128 ), 1 );
+    EXPECT_EQ( pooled_size_class_of( 129 ), 2 );
+    EXPECT_EQ( pooled_size_class_of( 4 * 1024 * 1024 ),
+               pooled_size_classes_count - 1 );
+    EXPECT_EQ( pooled_size_class_of( 4 * 1024 * 1024 + 1 ),
+               pooled_size_classes_count );
+
+    for( std::size_t i = 0; i < pooled_size_classes_count; ++i )
+    {
+        EXPECT_EQ( pooled_size_class_capacity( i ), std::size_t{ 64 } << i );
+        EXPECT_EQ( pooled_size_class_of( pooled_size_class_capacity( i ) ), i );
+        EXPECT_GE( pooled_thread_cache_limit( i ), 1 );
+    }
+}
+
+TEST( OpioNetPooledBuffer, CtorDefault )  // NOLINT
+{
+    pooled_buffer_t b{};
+    EXPECT_EQ( b.data(), nullptr );
+    EXPECT_EQ( b.size(), 0 );
+    EXPECT_EQ( b.capacity(), 0 );
+    EXPECT_EQ( b.use_count(), 0 );
+}
+
+TEST( OpioNetPooledBuffer, CtorWithSize )  // NOLINT
+{
+    pooled_buffer_t b{ 100 };
+    EXPECT_NE( b.data(), nullptr );
+    EXPECT_EQ( b.size(), 100 );
+    EXPECT_EQ( b.capacity(), 128 );
+    EXPECT_EQ( b.use_count(), 1 );
+
+    pooled_buffer_t b2{ 5, std::byte{ 'x' } };
+    EXPECT_EQ( b2.make_string_view(), "xxxxx" );
+
+    const char * str = "0123456789";
+    pooled_buffer_t b3{ str, 10 };
+    EXPECT_EQ( b3.make_string_view(), str );
+    EXPECT_EQ( b3.make_copy().make_string_view(), str );
+}
+
+TEST( OpioNetPooledBuffer, HugeBufferIsNotPooled )  // NOLINT
+{
+    constexpr std::size_t sz = 5 * 1024 * 1024;
+    pooled_buffer_t b{ sz, std::byte{ 'z' } };
+    EXPECT_EQ( b.size(), sz );
+    EXPECT_EQ( b.capacity(), sz );
+    EXPECT_EQ( b.data()[ sz - 1 ], std::byte{ 'z' } );
+}
+
+TEST( OpioNetPooledBuffer, BlockIsReused )  // NOLINT
+{
+    const std::byte * first_data = nullptr;
+    {
+        pooled_buffer_t b{ 1000 };
+        first_data = b.data();
+    }
+
+    // The same size class must be served
+    // with a block just returned to the pool.
+    pooled_buffer_t b{ 600 };
+    EXPECT_EQ( b.data(), first_data );
+    EXPECT_EQ( b.capacity(), 1024 );
+
+    // But not for a different size class.
+    pooled_buffer_t b2{ 60 };
+    EXPECT_NE( b2.data(), first_data );
+}
+
+TEST( OpioNetPooledBuffer, Share )  // NOLINT
+{
+    const std::byte * data = nullptr;
+    {
+        pooled_buffer_t b1{ "abc", 3 };
+        data = b1.data();
+
+        auto b2 = b1.share();
+        EXPECT_EQ( b1.use_count(), 2 );
+        EXPECT_EQ( b2.use_count(), 2 );
+        EXPECT_EQ( b2.data(), b1.data() );
+        EXPECT_EQ( b2.make_string_view(), "abc" );
+
+        b1 = pooled_buffer_t{};
+        EXPECT_EQ( b2.use_count(), 1 );
+        EXPECT_EQ( b2.make_string_view(), "abc" );
+
+        // The block is still in use.
+        pooled_buffer_t b3{ 3 };
+        EXPECT_NE( b3.data(), data );
+    }
+
+    // The last owner returned the block to the pool.
+    pooled_buffer_t b{ 3 };
+    EXPECT_EQ( b.data(), data );
+}
+
+TEST( OpioNetPooledBuffer, MakeSlice )  // NOLINT
+{
+    const std::byte * data = nullptr;
+    {
+        shared_buffer_slice_t slice;
+        {
+            pooled_buffer_t b{ "0123456789", 10 };
+            data  = b.data();
+            slice = b.make_slice( 2, 5 );
+            EXPECT_EQ( b.use_count(), 2 );
+        }
+
+        // The slice keeps the block.
+        EXPECT_EQ( slice.data(), data + 2 );
+        EXPECT_EQ( slice.make_string_view(), "23456" );
+
+        pooled_buffer_t b{ 10 };
+        EXPECT_NE( b.data(), data );
+    }
+
+    pooled_buffer_t b{ 10 };
+    EXPECT_EQ( b.data(), data );
+}
+
+TEST( OpioNetPooledBuffer, Resize )  // NOLINT
+{
+    pooled_buffer_t b{ "0123456789", 10 };
+    const auto * data = b.data();
+
+    b.shrink_size( 5 );
+    EXPECT_EQ( b.make_string_view(), "01234" );
+
+    // Fits capacity.
+    b.resize( 60 );
+    EXPECT_EQ( b.data(), data );
+    EXPECT_EQ( b.size(), 60 );
+
+    b.resize( 1000 );
+    EXPECT_NE( b.data(), data );
+    EXPECT_EQ( b.size(), 1000 );
+    EXPECT_EQ( b.capacity(), 1024 );
+    EXPECT_EQ( std::memcmp( b.data(), "0123456789", 10 ), 0 );
+
+    b.resize_drop_data( 2000 );
+    EXPECT_EQ( b.size(), 2000 );
+    EXPECT_EQ( b.capacity(), 2048 );
+}
+
+TEST( OpioNetPooledBuffer, ReleaseOnAnotherThread )  // NOLINT
+{
+    pooled_buffer_t b{ 1 << 20, std::byte{ 'a' } };
+
+    // The block goes to the cache of another thread
+    // and then to the global pool when that thread finishes.
+    std::thread t{ [ buf = std::move( b ) ]() mutable {
+        EXPECT_EQ( buf.data()[ 0 ], std::byte{ 'a' } );
+        buf = pooled_buffer_t{};
+    } };
+    t.join();
+
+    const auto cls = details::pooled_size_class_of( 1 << 20 );
+    EXPECT_GE( details::pooled_global_pool().free_blocks_count( cls ), 1 );
+}
+
+TEST( OpioNetPooledBuffer, DriverReallocateInput )  // NOLINT
+{
+    pooled_buffer_driver_t driver;
+
+    auto b = driver.allocate_input( 100 );
+    const auto * data = b.data();
+
+    b = driver.reallocate_input( std::move( b ), 120 );
+    EXPECT_EQ( b.data(), data );
+    EXPECT_EQ( b.size(), 120 );
+
+    b = driver.reduce_size_input( std::move( b ), 10 );
+    EXPECT_EQ( b.data(), data );
+    EXPECT_EQ( b.size(), 10 );
+
+    // A shared buffer must not be reused.
+    auto shared = b.share();
+    b = driver.reallocate_input( std::move( b ), 20 );
+    EXPECT_NE( b.data(), data );
+    EXPECT_EQ( shared.data(), data );
+}
+
+TEST( OpioNetPooledBuffer, HeteroDriver )  // NOLINT
+{
+    pooled_heterogeneous_buffer_driver_t driver;
+
+    auto out = driver.allocate_output( 3 );
+    std::memcpy( out.data(), "xyz", 3 );
+
+    auto hb = driver.reallocate_output(
+        pooled_heterogeneous_buffer_driver_t::output_buffer_t{ std::move( out ) },
+        5 );
+    EXPECT_EQ( pooled_heterogeneous_buffer_driver_t::buffer_size( hb ), 5 );
+    EXPECT_EQ(
+        std::memcmp(
+            pooled_heterogeneous_buffer_driver_t::make_asio_const_buffer( hb )
+                .data(),
+            "xyz",
+            3 ),
+        0 );
+}
+
+}  // anonymous namespace
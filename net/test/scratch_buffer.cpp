@@ -0,0 +1,168 @@
+#include <opio/net/scratch_buffer.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;  // NOLINT
+
+using scratch_driver_t = scratch_input_buffer_driver_t<>;
+
+void put( scratch_input_buffer_t & buf, std::string_view s )
+{
+    ASSERT_LE( s.size(), buf.size() );
+    std::memcpy( buf.data(), s.data(), s.size() );
+}
+
+TEST( OpioNetScratchBuffer, ThreadScratchMemory )  // NOLINT
+{
+    auto * p1 = details::thread_scratch_memory( 100 );
+    auto * p2 = details::thread_scratch_memory( 50 );
+    EXPECT_EQ( p1, p2 );
+
+    std::byte * other_thread_p{};
+    std::thread t{ [ & ] {
+        other_thread_p = details::thread_scratch_memory( 100 );
+    } };
+    t.join();
+
+    EXPECT_NE( p1, other_thread_p );
+}
+
+TEST( OpioNetScratchBuffer, ConnectionsShareScratch )  // NOLINT
+{
+    scratch_driver_t driver1;
+    scratch_driver_t driver2;
+
+    auto buf1 = driver1.allocate_input( 100 );
+    const auto * data1 = buf1.data();
+    buf1 = scratch_input_buffer_t{};
+
+    auto buf2 = driver2.allocate_input( 100 );
+    EXPECT_EQ( buf2.data(), data1 );
+}
+
+TEST( OpioNetScratchBuffer, NoTail )  // NOLINT
+{
+    scratch_driver_t driver;
+
+    auto buf = driver.allocate_input( 100 );
+    ASSERT_EQ( buf.size(), 100 );
+
+    put( buf, "hello" );
+    buf = driver.reduce_size_input( std::move( buf ), 5 );
+    EXPECT_EQ( buf.make_string_view(), "hello" );
+    EXPECT_EQ( driver.carry_size(), 0 );
+
+    buf = driver.reallocate_input( std::move( buf ), 100 );
+    EXPECT_EQ( buf.size(), 100 );
+    put( buf, "world" );
+    buf = driver.reduce_size_input( std::move( buf ), 5 );
+    EXPECT_EQ( buf.make_string_view(), "world" );
+}
+
+TEST( OpioNetScratchBuffer, KeepTail )  // NOLINT
+{
+    scratch_driver_t driver;
+
+    auto buf = driver.allocate_input( 100 );
+    put( buf, "package#1;pack" );
+    buf = driver.reduce_size_input( std::move( buf ), 14 );
+    EXPECT_EQ( buf.make_string_view(), "package#1;pack" );
+
+    // The data is consumed up to ';'.
+    buf.keep_tail( 4 );
+    EXPECT_EQ( driver.carry_size(), 4 );
+    buf = scratch_input_buffer_t{};
+
+    // Overwrite the scratch by other connection.
+    {
+        scratch_driver_t other_driver;
+        auto other_buf = other_driver.allocate_input( 100 );
+        put( other_buf, "xxxxxxxxxxxxxxxxxxxx" );
+    }
+
+    // Kept tail goes in front of the data of the next read.
+    buf = driver.allocate_input( 100 );
+    EXPECT_EQ( buf.size(), 100 );
+    put( buf, "age#2;" );
+
+    // Nothing is read (spurious readiness), tail is still kept.
+    EXPECT_EQ( driver.carry_size(), 4 );
+    buf = driver.allocate_input( 100 );
+    put( buf, "age#2;" );
+
+    buf = driver.reduce_size_input( std::move( buf ), 6 );
+    EXPECT_EQ( buf.make_string_view(), "package#2;" );
+    EXPECT_EQ( driver.carry_size(), 0 );
+
+    // Not kept anymore.
+    buf = driver.allocate_input( 100 );
+    put( buf, "package#3;" );
+    buf = driver.reduce_size_input( std::move( buf ), 10 );
+    EXPECT_EQ( buf.make_string_view(), "package#3;" );
+}
+
+TEST( OpioNetScratchBuffer, KeepWholeData )  // NOLINT
+{
+    scratch_driver_t driver;
+
+    std::string expected;
+    for( int i = 0; i < 10; ++i )
+    {
+        auto buf = driver.allocate_input( 3 );
+        put( buf, "abc" );
+        buf = driver.reduce_size_input( std::move( buf ), 3 );
+        expected += "abc";
+        EXPECT_EQ( buf.make_string_view(), expected );
+        buf.keep_tail( buf.size() );
+    }
+
+    EXPECT_EQ( driver.carry_size(), 30 );
+}
+
+TEST( OpioNetScratchBuffer, CopiesStartWithEmptyCarry )  // NOLINT
+{
+    scratch_driver_t driver;
+
+    auto buf = driver.allocate_input( 100 );
+    put( buf, "abc" );
+    buf = driver.reduce_size_input( std::move( buf ), 3 );
+    buf.keep_tail( 2 );
+    ASSERT_EQ( driver.carry_size(), 2 );
+
+    scratch_driver_t copy{ driver };
+    EXPECT_EQ( copy.carry_size(), 0 );
+
+    auto buf2 = copy.allocate_input( 10 );
+    EXPECT_EQ( buf2.size(), 10 );
+    EXPECT_EQ( copy.reduce_size_input( std::move( buf2 ), 0 ).size(), 0 );
+}
+
+TEST( OpioNetScratchBuffer, MovesKeepCarry )  // NOLINT
+{
+    scratch_driver_t driver;
+
+    auto buf = driver.allocate_input( 100 );
+    put( buf, "package#1;pack" );
+    buf = driver.reduce_size_input( std::move( buf ), 14 );
+
+    // Buffer refers the carry of the driver moved after it was given.
+    scratch_driver_t moved{ std::move( driver ) };
+    buf.keep_tail( 4 );
+    EXPECT_EQ( moved.carry_size(), 4 );
+
+    scratch_driver_t move_assigned;
+    move_assigned = std::move( moved );
+    EXPECT_EQ( move_assigned.carry_size(), 4 );
+
+    buf = move_assigned.allocate_input( 100 );
+    put( buf, "age#2;" );
+    buf = move_assigned.reduce_size_input( std::move( buf ), 6 );
+    EXPECT_EQ( buf.make_string_view(), "package#2;" );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,107 @@
+#include <opio/net/shared_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace opio::net;  // NOLINT
+
+TEST( OpioNetSharedBuffer, CtorDefault )  // NOLINT
+{
+    shared_buffer_t b{};
+    EXPECT_EQ( b.data(), nullptr );
+    EXPECT_EQ( b.size(), 0 );
+    EXPECT_EQ( b.capacity(), 0 );
+    EXPECT_EQ( b.use_count(), 0 );
+
+    shared_buffer_slice_t s{};
+    EXPECT_EQ( s.data(), nullptr );
+    EXPECT_TRUE( s.empty() );
+}
+
+TEST( OpioNetSharedBuffer, CtorWithSize )  // NOLINT
+{
+    shared_buffer_t b{ 100 };
+    EXPECT_NE( b.data(), nullptr );
+    EXPECT_EQ( b.size(), 100 );
+    EXPECT_EQ( b.capacity(), 100 );
+    EXPECT_EQ( b.use_count(), 1 );
+
+    const char * str = "0123456789";
+    shared_buffer_t b2{ str, 10 };
+    EXPECT_EQ( b2.make_string_view(), str );
+    EXPECT_EQ( b2.make_copy().make_string_view(), str );
+}
+
+TEST( OpioNetSharedBuffer, MakeSlice )  // NOLINT
+{
+    shared_buffer_slice_t slice;
+    {
+        shared_buffer_t b{ "0123456789", 10 };
+        slice = b.make_slice( 2, 5 );
+        EXPECT_EQ( b.use_count(), 2 );
+        EXPECT_EQ( slice.data(), b.data() + 2 );
+
+        auto sub_slice = slice.make_slice( 1, 2 );
+        EXPECT_EQ( sub_slice.make_string_view(), "34" );
+        EXPECT_EQ( b.use_count(), 3 );
+    }
+
+    // The slice keeps the data.
+    EXPECT_EQ( slice.use_count(), 1 );
+    EXPECT_EQ( slice.size(), 5 );
+    EXPECT_EQ( slice.make_string_view(), "23456" );
+    EXPECT_EQ( slice.make_copy().make_string_view(), "23456" );
+}
+
+TEST( OpioNetSharedBuffer, SliceOwningSimpleBuffer )  // NOLINT
+{
+    auto buf        = simple_buffer_t::make_from( { 'a', 'b', 'c' } );
+    const auto data = buf.data();
+
+    shared_buffer_slice_t slice{ std::move( buf ) };
+    EXPECT_EQ( slice.data(), data );
+    EXPECT_EQ( slice.make_string_view(), "abc" );
+
+    EXPECT_TRUE( shared_buffer_slice_t{ simple_buffer_t{} }.empty() );
+}
+
+TEST( OpioNetSharedBuffer, SliceAsHeteroBuffer )  // NOLINT
+{
+    shared_buffer_t b{ "0123456789", 10 };
+
+    heterogeneous_buffer_t hb{ b.make_slice( 5, 5 ) };
+    EXPECT_EQ( b.use_count(), 2 );
+    EXPECT_EQ( hb.make_string_view(), "56789" );
+    EXPECT_EQ( hb.make_asio_const_buffer().data(), b.data() + 5 );
+}
+
+TEST( OpioNetSharedBuffer, DriverReallocateInput )  // NOLINT
+{
+    shared_buffer_driver_t driver;
+
+    auto b          = driver.allocate_input( 100 );
+    const auto data = b.data();
+
+    // Not shared: reused.
+    b = driver.reallocate_input( std::move( b ), 50 );
+    EXPECT_EQ( b.data(), data );
+    EXPECT_EQ( b.size(), 50 );
+
+    // Shared: a new buffer is allocated.
+    auto slice = b.make_slice( 0, 10 );
+    b          = driver.reallocate_input( std::move( b ), 50 );
+    EXPECT_NE( b.data(), data );
+    EXPECT_EQ( slice.data(), data );
+
+    b = driver.reduce_size_input( std::move( b ), 10 );
+    EXPECT_EQ( b.size(), 10 );
+    EXPECT_EQ( shared_buffer_driver_t::make_asio_mutable_buffer( b ).data(),
+               b.data() );
+
+    heterogeneous_buffer_t out{ std::move( slice ) };
+    EXPECT_EQ( shared_buffer_driver_t::buffer_size( out ), 10 );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,91 @@
+#include <opio/net/spsc_buffers_queue.hpp>
+
+#include <cstring>
+#include <thread>
+
+#include <opio/net/buffer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;  // NOLINT
+
+TEST( OpioNet, SpscBuffersQueueFifo )  // NOLINT
+{
+    spsc_buffers_queue_t< simple_buffer_t, 4 > q;
+
+    EXPECT_EQ( q.size(), 0 );
+    EXPECT_FALSE( q.try_pop() );
+
+    for( std::size_t i = 0; i < 4; ++i )
+    {
+        simple_buffer_t buf{ i + 1 };
+        EXPECT_TRUE( q.try_push( buf ) );
+        EXPECT_EQ( buf.size(), 0 );
+    }
+    EXPECT_EQ( q.size(), 4 );
+
+    // Queue is full: buffer remains untouched.
+    simple_buffer_t extra_buf{ 100 };
+    EXPECT_FALSE( q.try_push( extra_buf ) );
+    EXPECT_EQ( extra_buf.size(), 100 );
+
+    for( std::size_t i = 0; i < 4; ++i )
+    {
+        auto buf = q.try_pop();
+        ASSERT_TRUE( buf );
+        EXPECT_EQ( buf->size(), i + 1 );
+    }
+    EXPECT_FALSE( q.try_pop() );
+
+    // Wrap around.
+    EXPECT_TRUE( q.try_push( extra_buf ) );
+    auto buf = q.try_pop();
+    ASSERT_TRUE( buf );
+    EXPECT_EQ( buf->size(), 100 );
+}
+
+TEST( OpioNet, SpscBuffersQueueTwoThreads )  // NOLINT
+{
+    constexpr std::size_t buffers_count = 10'000;
+
+    spsc_buffers_queue_t< simple_buffer_t, 8 > q;
+
+    std::thread producer{ [ & ] {
+        for( std::size_t i = 0; i < buffers_count; )
+        {
+            simple_buffer_t buf{ &i, sizeof( i ) };
+            if( q.try_push( buf ) )
+            {
+                ++i;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    } };
+
+    std::size_t expected = 0;
+    while( expected < buffers_count )
+    {
+        if( auto buf = q.try_pop(); buf )
+        {
+            ASSERT_EQ( buf->size(), sizeof( std::size_t ) );
+            std::size_t value{};
+            std::memcpy( &value, buf->data(), sizeof( value ) );
+            ASSERT_EQ( value, expected++ );
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ( q.size(), 0 );
+}
+
+}  // anonymous namespace
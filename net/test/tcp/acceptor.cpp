@@ -1,5 +1,7 @@
 #include <opio/net/tcp/acceptor.hpp>
 
+#include <opio/net/asio_thread_pool.hpp>
+
 #include <opio/net/tcp/connector.hpp>
 #include <opio/net/tcp/error_code.hpp>
 #include <opio/exception.hpp>
@@ -333,4 +335,75 @@ TEST( OpioNetTcp, AcceptorAccept10 )  // NOLINT
     ASSERT_EQ( connect_happened, 10 );
 }
 
+TEST( OpioNetTcp, AcceptorBatchAcceptToLeastLoaded )  // NOLINT
+{
+    constexpr std::size_t clients_count = 20;
+
+    asio_ns::io_context ioctx( 1 );
+    asio_ns::ip::tcp::endpoint ep{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                   make_random_port_value() };
+
+    // Contexts of the pool are not run: sockets are only created on them.
+    asio_thread_pool_cfg_t pool_cfg;
+    pool_cfg.threads_count = 3;
+    pool_cfg.picker        = io_context_picker::least_loaded;
+    asio_thread_pool_t pool{ pool_cfg, make_test_logger( "pool" ) };
+
+    // Some connections are already there.
+    pool.add_load( 0, 4 );
+
+    acceptor_options_cfg_t acceptor_options_cfg;
+    acceptor_options_cfg.accept_batch_budget    = 8;
+    acceptor_options_cfg.socket_executor_picker = [ & ] {
+        return pool.pick_executor();
+    };
+
+    std::vector< asio_ns::ip::tcp::socket > accepted;
+    auto acceptor = std::make_shared< acceptor_t< logger::logger_t > >(
+        ioctx.get_executor(),
+        ep,
+        acceptor_options_cfg,
+        socket_options_cfg_t{},
+        make_test_logger( "acceptor" ),
+        [ & ]( auto socket ) {
+            ASSERT_TRUE( socket.is_open() );
+            const auto i = pool.index_of( socket.get_executor() );
+            ASSERT_TRUE( i );
+            pool.add_load( *i, 1 );
+            accepted.push_back( std::move( socket ) );
+        } );
+
+    acceptor->open( []( const auto & ec ) { ASSERT_FALSE( ec ); } );
+    ioctx.poll();
+
+    // Clients pile up in the backlog.
+    asio_ns::io_context client_ioctx( 1 );
+    std::vector< asio_ns::ip::tcp::socket > clients;
+    for( std::size_t i = 0; i < clients_count; ++i )
+    {
+        clients.emplace_back( client_ioctx );
+        clients.back().connect( ep );
+    }
+
+    std::size_t wakeups = 0;
+    while( accepted.size() < clients_count )  // NOLINT
+    {
+        if( 0 != ioctx.run_one() )
+        {
+            ++wakeups;
+        }
+    }
+
+    // Backlog is drained in batches.
+    EXPECT_LE( wakeups, clients_count / 8 + 2 );
+
+    // Load is leveled: (20 + 4) / 3 per context.
+    EXPECT_EQ( pool.load( 0 ), 8 );
+    EXPECT_EQ( pool.load( 1 ), 8 );
+    EXPECT_EQ( pool.load( 2 ), 8 );
+
+    acceptor->close();
+    ioctx.run();
+}
+
 }  // anonymous namespace
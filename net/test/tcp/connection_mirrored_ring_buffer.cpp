@@ -0,0 +1,122 @@
+#include <opio/net/mirrored_ring_buffer.hpp>
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+using ring_driver_t = mirrored_ring_input_buffer_driver_t<>;
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t        = opio::logger::logger_t;
+    using buffer_driver_t = ring_driver_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+TEST( OpioNetTcp, MirroredRingBufferInput )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    for( std::size_t i = 0; i < 50'000; ++i )
+    {
+        etalon_data.append( fmt::format( "{:04};", i % 10'000 ) );
+    }
+
+    std::string srv_input{};
+
+    // Received data is kept for a while (and released out of order),
+    // so the ring wraps and the data has to be glued.
+    std::vector< mirrored_ring_buffer_t > pending;
+    std::size_t pending_size{};
+    std::size_t merges_count{};
+
+    auto flush_pending = [ & ] {
+        for( auto & buf : pending )
+        {
+            srv_input.append( buf.make_string_view() );
+        }
+        for( std::size_t i = 1; i < pending.size(); i += 2 )
+        {
+            pending[ i ] = mirrored_ring_buffer_t{};
+        }
+        pending.clear();
+        pending_size = 0;
+    };
+
+    auto server_conn = connection_t::make( std::move( s1 ), [ & ]( auto & params ) {
+        params.connection_id( 0 )
+            .connection_cfg( connection_cfg_t{}.input_buffer_size( 1000 ) )
+            .logger( make_test_logger( "SERVER_CONN" ) )
+            .buffer_driver( ring_driver_t{ 64 * 1024 } )
+            .input_handler( [ & ]( auto & ctx ) {
+                auto & buf = ctx.buf();
+                EXPECT_TRUE( buf.is_in_ring() );
+
+                pending_size += buf.size();
+                if( !pending.empty() && pending.back().try_merge( buf ) )
+                {
+                    ++merges_count;
+                }
+                else
+                {
+                    pending.push_back( std::move( buf ) );
+                }
+
+                if( 10'000 <= pending_size )
+                {
+                    flush_pending();
+                }
+
+                if( srv_input.size() + pending_size == etalon_data.size() )
+                {
+                    flush_pending();
+                    ctx.connection().shutdown();
+                }
+            } );
+    } );
+    server_conn->start_reading();
+
+    auto client_conn = connection_t::make( std::move( s2 ), [ & ]( auto & params ) {
+        params.connection_id( 1 )
+            .logger( make_test_logger( "CLIENT_CONN" ) )
+            .buffer_driver( ring_driver_t{ 64 * 1024 } )
+            .input_handler( []( [[maybe_unused]] auto & ctx ) {} );
+    } );
+    client_conn->start_reading();
+
+    for( std::size_t pos = 0; pos < etalon_data.size(); pos += 500 )
+    {
+        const auto part = std::string_view{ etalon_data }.substr( pos, 500 );
+        client_conn->schedule_send( simple_buffer_t{ part.data(), part.size() } );
+    }
+    client_conn->shutdown();
+
+    ioctx.run();
+    EXPECT_EQ( etalon_data, srv_input );
+    EXPECT_LT( 0, merges_count );
+}
+
+}  // anonymous namespace
+
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
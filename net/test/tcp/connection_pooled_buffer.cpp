@@ -0,0 +1,100 @@
+#include <opio/net/tcp/pooled_buffers_traits.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+struct connection_traits_st_t : public pooled_buffers_traits_st_t
+{
+    using logger_t = opio::logger::logger_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+template < typename Input_Handler >
+connection_t::sptr_t make_connection( connection_traits_st_t::socket_t socket,
+                                      opio::net::tcp::connection_id_t id,
+                                      const opio::net::tcp::connection_cfg_t & cfg,
+                                      opio::logger::logger_t logger,
+                                      Input_Handler input_handler )
+{
+    return connection_t::make( std::move( socket ), [ & ]( auto & params ) {
+        params.connection_id( id )
+            .connection_cfg( cfg )
+            .logger( std::move( logger ) )
+            .input_handler( std::move( input_handler ) );
+    } );
+}
+
+TEST( OpioNetTcp, PooledBufRawConnectionPingPong )  // NOLINT
+{
+    connection_cfg_t cfg{};
+    cfg.input_buffer_size( 100 );
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        etalon_data.append( fmt::format( "{:04};", i ) );
+    }
+
+    std::string srv_input{};
+    std::string cli_input{};
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        cfg,
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            srv_input += ctx.buf().make_string_view();
+
+            // Send back the received buffer itself.
+            ctx.connection().schedule_send( std::move( ctx.buf() ) );
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection(
+        std::move( s2 ),
+        1,
+        cfg,
+        make_test_logger( "CLIENT_CONN" ),
+        [ & ]( auto & ctx ) {
+            cli_input += ctx.buf().make_string_view();
+
+            if( cli_input.size() >= etalon_data.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    client_conn->start_reading();
+
+    for( std::size_t pos = 0; pos < etalon_data.size(); pos += 500 )
+    {
+        const auto part = std::string_view{ etalon_data }.substr( pos, 500 );
+        client_conn->schedule_send( pooled_buffer_t{ part.data(), part.size() } );
+    }
+
+    ioctx.run();
+    EXPECT_EQ( etalon_data, srv_input );
+    EXPECT_EQ( etalon_data, cli_input );
+}
+
+}  // anonymous namespace
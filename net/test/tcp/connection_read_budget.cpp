@@ -0,0 +1,188 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+//
+// reads_stats_driver_t
+//
+
+struct reads_stats_driver_t : public opio::net::noop_stats_driver_t
+{
+    std::size_t async_reads_count{};
+    std::size_t sync_reads_count{};
+    std::size_t input_bytes{};
+
+    template < typename Connection >
+    void inc_bytes_rx_async( std::size_t n,
+                             [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++async_reads_count;
+        input_bytes += n;
+    }
+
+    template < typename Connection >
+    void inc_bytes_rx_sync( std::size_t n,
+                            [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++sync_reads_count;
+        input_bytes += n;
+    }
+};
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t       = opio::logger::logger_t;
+    using stats_driver_t = reads_stats_driver_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+template < typename Input_Handler >
+connection_t::sptr_t make_connection( connection_traits_st_t::socket_t socket,
+                                      opio::net::tcp::connection_id_t id,
+                                      const opio::net::tcp::connection_cfg_t & cfg,
+                                      opio::logger::logger_t logger,
+                                      Input_Handler input_handler )
+{
+    return connection_t::make( std::move( socket ), [ & ]( auto & params ) {
+        params.connection_id( id )
+            .connection_cfg( cfg )
+            .logger( std::move( logger ) )
+            .input_handler( std::move( input_handler ) );
+    } );
+}
+
+/**
+ * @brief Send a bulk of data from client to server
+ *        and return server's read stats.
+ *
+ * Server starts reading only after all the data is sent,
+ * so socket always has more data than a single read consumes.
+ */
+reads_stats_driver_t run_read_budget_scenario( const connection_cfg_t & cfg )
+{
+    constexpr std::size_t bufs_count = 16;
+    constexpr std::size_t buf_size   = 4 * 1024;
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    std::string received_data;
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        cfg,
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == etalon_data.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+
+    auto client_conn = make_connection( std::move( s2 ),
+                                        1,
+                                        connection_cfg_t{},
+                                        make_test_logger( "CLIENT_CONN" ),
+                                        [ & ]( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::size_t cb_count = 0;
+    for( std::size_t i = 0; i < bufs_count; ++i )
+    {
+        simple_buffer_t buf{ buf_size, static_cast< std::byte >( 'a' + i % 26 ) };
+        etalon_data.append( buf.make_string_view() );
+
+        client_conn->schedule_send_with_cb(
+            [ & ]( auto res ) {
+                EXPECT_EQ( res, send_buffers_result::success );
+                if( ++cb_count == bufs_count )
+                {
+                    client_conn->shutdown();
+                    server_conn->start_reading();
+                }
+            },
+            std::move( buf ) );
+    }
+
+    ioctx.run();
+
+    EXPECT_EQ( cb_count, bufs_count );
+    EXPECT_EQ( received_data.size(), etalon_data.size() );
+    EXPECT_TRUE( received_data == etalon_data );
+
+    const auto & stats = server_conn->stats_driver();
+    EXPECT_EQ( stats.input_bytes, etalon_data.size() );
+    return stats;
+}
+
+TEST( OpioNetTcp, ReadBudgetCfg )  // NOLINT
+{
+    const connection_cfg_t default_cfg{};
+    EXPECT_EQ( default_cfg.read_budget_iterations(), 0 );
+    EXPECT_EQ( default_cfg.read_budget_bytes(), 1024 * 1024 );
+
+    const auto cfg =
+        connection_cfg_t{}.read_budget_iterations( 8 ).read_budget_bytes( 4096 );
+
+    EXPECT_EQ( cfg.read_budget_iterations(), 8 );
+    EXPECT_EQ( cfg.read_budget_bytes(), 4096 );
+}
+
+TEST( OpioNetTcp, ReadBudgetOff )  // NOLINT
+{
+    const auto stats =
+        run_read_budget_scenario( connection_cfg_t{}.input_buffer_size( 1024 ) );
+
+    EXPECT_EQ( stats.sync_reads_count, 0 );
+    EXPECT_LE( 64, stats.async_reads_count );
+}
+
+TEST( OpioNetTcp, ReadBudgetIterations )  // NOLINT
+{
+    const auto stats = run_read_budget_scenario( connection_cfg_t{}
+                                                     .input_buffer_size( 1024 )
+                                                     .read_budget_iterations( 7 )
+                                                     .read_budget_bytes( 0 ) );
+
+    // Data is already there, so each async read is followed
+    // by 7 sync reads (except for the tail).
+    EXPECT_LE( 56, stats.sync_reads_count );
+    EXPECT_LE( stats.async_reads_count, 9 );
+    EXPECT_LE( stats.sync_reads_count, 7 * stats.async_reads_count );
+}
+
+TEST( OpioNetTcp, ReadBudgetBytes )  // NOLINT
+{
+    const auto stats = run_read_budget_scenario( connection_cfg_t{}
+                                                     .input_buffer_size( 1024 )
+                                                     .read_budget_iterations( 100 )
+                                                     .read_budget_bytes( 4096 ) );
+
+    // Each completion reads at most 4 chunks.
+    EXPECT_LE( 16, stats.async_reads_count );
+    EXPECT_LE( stats.sync_reads_count, 3 * stats.async_reads_count );
+    EXPECT_LT( 0, stats.sync_reads_count );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,142 @@
+#include <opio/net/tcp/connection.hpp>
+#include <opio/net/scratch_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+struct scratch_traits_st_t : public default_traits_st_t
+{
+    using logger_t        = opio::logger::logger_t;
+    using buffer_driver_t = opio::net::scratch_input_buffer_driver_t<>;
+    using input_handler_t =
+        std::function< void( input_ctx_t< scratch_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< scratch_traits_st_t >;
+
+struct client_traits_st_t : public default_traits_st_t
+{
+    using logger_t = opio::logger::logger_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< client_traits_st_t > & ) >;
+};
+
+using client_connection_t = opio::net::tcp::connection_t< client_traits_st_t >;
+
+/**
+ * @brief Make a package: 1 byte of size followed by payload.
+ */
+std::string make_package( std::size_t i )
+{
+    std::string payload = fmt::format( "package #{}", i );
+    payload.append( i % 17, static_cast< char >( 'a' + i % 26 ) );
+
+    std::string pkg( 1, static_cast< char >( payload.size() ) );
+    pkg.append( payload );
+    return pkg;
+}
+
+TEST( OpioNetTcp, ScratchBufferPackagesWithTail )  // NOLINT
+{
+    constexpr std::size_t pairs_count    = 3;
+    constexpr std::size_t packages_count = 200;
+
+    asio_ns::io_context ioctx( 1 );
+
+    std::vector< connection_t::sptr_t > servers;
+    std::vector< client_connection_t::sptr_t > clients;
+    std::vector< std::vector< std::string > > received( pairs_count );
+    std::size_t received_total = 0;
+
+    for( std::size_t p = 0; p < pairs_count; ++p )
+    {
+        opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+        opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+        connect_pair( ioctx, s1, s2 );
+
+        servers.push_back( connection_t::make(
+            std::move( s1 ), [ & ]( auto & params ) {
+                params.connection_id( p )
+                    // A small read size makes packages straddle reads.
+                    .connection_cfg( connection_cfg_t{}.input_buffer_size( 7 ) )
+                    .logger( make_test_logger( "SERVER_CONN" ) )
+                    .input_handler( [ &, p ]( auto & ctx ) {
+                        const auto data = ctx.buf().make_string_view();
+
+                        std::size_t pos = 0;
+                        while( pos < data.size() )
+                        {
+                            const auto size =
+                                static_cast< std::size_t >( data[ pos ] );
+                            if( data.size() < pos + 1 + size )
+                            {
+                                break;
+                            }
+                            received[ p ].emplace_back(
+                                data.substr( pos, 1 + size ) );
+                            pos += 1 + size;
+                            ++received_total;
+                        }
+
+                        ctx.buf().keep_tail( data.size() - pos );
+
+                        if( received_total == pairs_count * packages_count )
+                        {
+                            for( auto & s : servers )
+                            {
+                                s->shutdown();
+                            }
+                            for( auto & c : clients )
+                            {
+                                c->shutdown();
+                            }
+                        }
+                    } );
+            } ) );
+
+        clients.push_back( client_connection_t::make(
+            std::move( s2 ), [ & ]( auto & params ) {
+                params.connection_id( 100 + p )
+                    .logger( make_test_logger( "CLIENT_CONN" ) )
+                    .input_handler( []( [[maybe_unused]] auto & ctx ) {} );
+            } ) );
+    }
+
+    for( std::size_t p = 0; p < pairs_count; ++p )
+    {
+        servers[ p ]->start_reading();
+        clients[ p ]->start_reading();
+
+        for( std::size_t i = 0; i < packages_count; ++i )
+        {
+            const auto pkg = make_package( i + p );
+            clients[ p ]->schedule_send(
+                simple_buffer_t{ pkg.data(), pkg.size() } );
+        }
+    }
+
+    ioctx.run();
+
+    ASSERT_EQ( received_total, pairs_count * packages_count );
+    for( std::size_t p = 0; p < pairs_count; ++p )
+    {
+        ASSERT_EQ( received[ p ].size(), packages_count );
+        for( std::size_t i = 0; i < packages_count; ++i )
+        {
+            EXPECT_EQ( received[ p ][ i ], make_package( i + p ) );
+        }
+    }
+}
+
+}  // anonymous namespace
@@ -0,0 +1,226 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <cstring>
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t = opio::logger::logger_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_t = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+/**
+ * @brief A message tagged with producer and sequence number.
+ */
+struct tagged_message_t
+{
+    std::uint32_t producer;
+    std::uint32_t seq;
+};
+
+simple_buffer_t make_message( std::uint32_t producer, std::uint32_t seq )
+{
+    const tagged_message_t msg{ producer, seq };
+    simple_buffer_t buf{ sizeof( msg ) };
+    std::memcpy( buf.data(), &msg, sizeof( msg ) );
+    return buf;
+}
+
+TEST( OpioNetTcp, SubmitSendMultipleProducers )  // NOLINT
+{
+    constexpr std::uint32_t producers_count       = 4;
+    constexpr std::uint32_t messages_per_producer = 5000;
+    constexpr std::size_t total_size =
+        producers_count * messages_per_producer * sizeof( tagged_message_t );
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string received_data;
+    std::promise< void > all_received;
+
+    auto server_conn = make_connection< connection_t >(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == total_size )
+            {
+                all_received.set_value();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection< connection_t >(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{},
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    auto work_guard = asio_ns::make_work_guard( ioctx );
+    std::thread ioctx_thread{ [ & ] { ioctx.run(); } };
+
+    std::atomic< std::size_t > success_cb_count{ 0 };
+    std::vector< std::thread > producers;
+    for( std::uint32_t p = 0; p < producers_count; ++p )
+    {
+        producers.emplace_back( [ &, p ] {
+            for( std::uint32_t i = 0; i < messages_per_producer; ++i )
+            {
+                if( 0 == i % 2 )
+                {
+                    client_conn->submit_send( make_message( p, i ) );
+                }
+                else
+                {
+                    client_conn->submit_send_with_cb(
+                        [ & ]( auto res ) {
+                            if( send_buffers_result::success == res )
+                            {
+                                ++success_cb_count;
+                            }
+                        },
+                        make_message( p, i ) );
+                }
+            }
+        } );
+    }
+
+    for( auto & t : producers )
+    {
+        t.join();
+    }
+
+    ASSERT_EQ( all_received.get_future().wait_for( std::chrono::seconds( 10 ) ),
+               std::future_status::ready );
+
+    asio_ns::post( ioctx, [ & ] {
+        client_conn->shutdown();
+        server_conn->shutdown();
+    } );
+    work_guard.reset();
+    ioctx_thread.join();
+
+    EXPECT_EQ( success_cb_count, producers_count * messages_per_producer / 2 );
+
+    ASSERT_EQ( received_data.size(), total_size );
+
+    std::vector< std::uint32_t > next_expected( producers_count, 0 );
+    for( std::size_t i = 0; i < received_data.size();
+         i += sizeof( tagged_message_t ) )
+    {
+        tagged_message_t msg;
+        std::memcpy( &msg, received_data.data() + i, sizeof( msg ) );
+        ASSERT_LT( msg.producer, producers_count );
+        // Order of a given producer must be preserved.
+        ASSERT_EQ( msg.seq, next_expected[ msg.producer ] );
+        ++next_expected[ msg.producer ];
+    }
+}
+
+TEST( OpioNetTcp, SubmitSendVec )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string received_data;
+
+    auto server_conn = make_connection< connection_t >(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == 6 )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection< connection_t >(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{},
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::vector< simple_buffer_t > bufs;
+    bufs.emplace_back( simple_buffer_t::make_from( { '1', '2' } ) );
+    bufs.emplace_back( simple_buffer_t::make_from( { '3', '4' } ) );
+
+    std::optional< send_buffers_result > cb_result;
+    client_conn->submit_send_vec_with_cb(
+        [ & ]( auto res ) { cb_result = res; }, std::move( bufs ) );
+
+    bufs.clear();
+    bufs.emplace_back( simple_buffer_t::make_from( { '5', '6' } ) );
+    client_conn->submit_send_vec_with_cb(
+        [ & ]( [[maybe_unused]] auto res ) { client_conn->shutdown(); },
+        std::move( bufs ) );
+
+    ioctx.run();
+
+    EXPECT_EQ( received_data, "123456" );
+    ASSERT_TRUE( cb_result );
+    EXPECT_EQ( *cb_result, send_buffers_result::success );
+}
+
+TEST( OpioNetTcp, SubmitSendAfterShutdown )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    auto client_conn = make_connection< connection_t >(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{},
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+    client_conn->shutdown();
+
+    std::optional< send_buffers_result > cb_result;
+    client_conn->submit_send_with_cb( [ & ]( auto res ) { cb_result = res; },
+                                      simple_buffer_t::make_from( { '1' } ) );
+
+    ioctx.run();
+
+    ASSERT_TRUE( cb_result );
+    EXPECT_EQ( *cb_result, send_buffers_result::rejected_schedule_send );
+}
+
+}  // anonymous namespace
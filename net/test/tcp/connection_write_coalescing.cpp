@@ -0,0 +1,269 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+//
+// writes_stats_driver_t
+//
+
+struct writes_stats_driver_t : public opio::net::noop_stats_driver_t
+{
+    std::size_t writes_count{};
+    std::size_t write_iovecs_total{};
+
+    template < typename Connection >
+    void write_iovecs_count( std::size_t n,
+                             [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++writes_count;
+        write_iovecs_total += n;
+    }
+};
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t       = opio::logger::logger_t;
+    using stats_driver_t = writes_stats_driver_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+template < typename Input_Handler >
+connection_t::sptr_t make_connection( connection_traits_st_t::socket_t socket,
+                                      opio::net::tcp::connection_id_t id,
+                                      const opio::net::tcp::connection_cfg_t & cfg,
+                                      opio::logger::logger_t logger,
+                                      Input_Handler input_handler )
+{
+    return connection_t::make( std::move( socket ), [ & ]( auto & params ) {
+        params.connection_id( id )
+            .connection_cfg( cfg )
+            .logger( std::move( logger ) )
+            .input_handler( std::move( input_handler ) );
+    } );
+}
+
+/**
+ * @brief Send a number of buffers of a given size from client to server
+ *        and return client's write stats.
+ */
+writes_stats_driver_t run_coalescing_scenario( const connection_cfg_t & cfg,
+                                               std::size_t bufs_count,
+                                               std::size_t buf_size )
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    std::string received_data;
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == etalon_data.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection( std::move( s2 ),
+                                        1,
+                                        cfg,
+                                        make_test_logger( "CLIENT_CONN" ),
+                                        [ & ]( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::size_t cb_count = 0;
+    for( std::size_t i = 0; i < bufs_count; ++i )
+    {
+        simple_buffer_t buf{ buf_size,
+                             static_cast< std::byte >( 'a' + i % 26 ) };
+        etalon_data.append( buf.make_string_view() );
+
+        client_conn->schedule_send_with_cb(
+            [ & ]( auto res ) {
+                EXPECT_EQ( res, send_buffers_result::success );
+                if( ++cb_count == bufs_count )
+                {
+                    client_conn->shutdown();
+                }
+            },
+            std::move( buf ) );
+    }
+
+    ioctx.run();
+
+    EXPECT_EQ( cb_count, bufs_count );
+    EXPECT_EQ( received_data.size(), etalon_data.size() );
+    EXPECT_TRUE( received_data == etalon_data );
+
+    return client_conn->stats_driver();
+}
+
+TEST( OpioNetTcp, WriteCoalescingCfg )  // NOLINT
+{
+    const connection_cfg_t default_cfg{};
+    EXPECT_EQ( default_cfg.write_coalescing_delay(),
+               std::chrono::microseconds::zero() );
+    EXPECT_EQ( default_cfg.write_coalescing_bytes(), 16 * 1024 );
+    EXPECT_EQ( default_cfg.write_coalescing_buffers(), 0 );
+    EXPECT_FALSE( default_cfg.write_coalescing_use_tcp_cork() );
+
+    const auto cfg = connection_cfg_t{}
+                         .write_coalescing_delay( std::chrono::microseconds{ 50 } )
+                         .write_coalescing_bytes( 4096 )
+                         .write_coalescing_buffers( 8 )
+                         .write_coalescing_use_tcp_cork( true );
+
+    EXPECT_EQ( cfg.write_coalescing_delay(), std::chrono::microseconds{ 50 } );
+    EXPECT_EQ( cfg.write_coalescing_bytes(), 4096 );
+    EXPECT_EQ( cfg.write_coalescing_buffers(), 8 );
+    EXPECT_TRUE( cfg.write_coalescing_use_tcp_cork() );
+
+    EXPECT_EQ( connection_cfg_t{}
+                   .write_coalescing_delay( std::chrono::microseconds{ -1 } )
+                   .write_coalescing_delay(),
+               std::chrono::microseconds::zero() );
+}
+
+TEST( OpioNetTcp, WriteCoalescingOff )  // NOLINT
+{
+    const auto stats = run_coalescing_scenario( connection_cfg_t{}, 10, 3 );
+
+    // Each buffer goes with its own aggressive write.
+    EXPECT_EQ( stats.writes_count, 10 );
+    EXPECT_EQ( stats.write_iovecs_total, 10 );
+}
+
+TEST( OpioNetTcp, WriteCoalescingByDelay )  // NOLINT
+{
+    const auto stats = run_coalescing_scenario(
+        connection_cfg_t{}.write_coalescing_delay( std::chrono::milliseconds{ 20 } ),
+        10,
+        3 );
+
+    EXPECT_EQ( stats.writes_count, 1 );
+    EXPECT_EQ( stats.write_iovecs_total, 10 );
+}
+
+TEST( OpioNetTcp, WriteCoalescingByBytes )  // NOLINT
+{
+    const auto stats = run_coalescing_scenario(
+        connection_cfg_t{}
+            .write_coalescing_delay( std::chrono::milliseconds{ 20 } )
+            .write_coalescing_bytes( 100 ),
+        10,
+        30 );
+
+    // 4 + 4 buffers go as soon as 100 bytes are pending,
+    // the last 2 go after delay.
+    EXPECT_EQ( stats.writes_count, 3 );
+    EXPECT_EQ( stats.write_iovecs_total, 10 );
+}
+
+TEST( OpioNetTcp, WriteCoalescingByBuffers )  // NOLINT
+{
+    const auto stats = run_coalescing_scenario(
+        connection_cfg_t{}
+            .write_coalescing_delay( std::chrono::seconds{ 10 } )
+            .write_coalescing_buffers( 5 ),
+        10,
+        1 );
+
+    EXPECT_EQ( stats.writes_count, 2 );
+    EXPECT_EQ( stats.write_iovecs_total, 10 );
+}
+
+TEST( OpioNetTcp, WriteCoalescingWithTcpCork )  // NOLINT
+{
+    const auto stats = run_coalescing_scenario(
+        connection_cfg_t{}
+            .write_coalescing_delay( std::chrono::milliseconds{ 1 } )
+            .write_coalescing_use_tcp_cork( true ),
+        100,
+        1000 );
+
+    EXPECT_LT( stats.writes_count, 100 );
+}
+
+TEST( OpioNetTcp, WriteCoalescingFlush )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string received_data;
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == 5 )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    // Delay is long enough for the test to notice
+    // the data went without waiting for it.
+    auto client_conn = make_connection(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{}.write_coalescing_delay( std::chrono::seconds{ 30 } ),
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::optional< send_buffers_result > cb_result;
+    client_conn->schedule_send_with_cb(
+        [ & ]( auto res ) {
+            cb_result = res;
+            client_conn->shutdown();
+        },
+        simple_buffer_t::make_from( { '1', '2' } ),
+        simple_buffer_t::make_from( { '3', '4', '5' } ) );
+    client_conn->flush();
+
+    const auto started_at = std::chrono::steady_clock::now();
+    ioctx.run();
+    const auto elapsed = std::chrono::steady_clock::now() - started_at;
+
+    EXPECT_EQ( received_data, "12345" );
+    ASSERT_TRUE( cb_result );
+    EXPECT_EQ( *cb_result, send_buffers_result::success );
+    EXPECT_LT( elapsed, std::chrono::seconds{ 10 } );
+
+    EXPECT_EQ( client_conn->stats_driver().writes_count, 1 );
+    EXPECT_EQ( client_conn->stats_driver().write_iovecs_total, 2 );
+}
+
+}  // anonymous namespace
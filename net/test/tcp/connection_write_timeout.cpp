@@ -4,6 +4,7 @@
 #define OPIO_NET_QUIK_SYNC_WRITE_HEURISTIC_SIZE 0  // NOLINT
 
 #include <opio/net/tcp/connection.hpp>
+#include <opio/net/timing_wheel_operation_watchdog.hpp>
 
 #include <gtest/gtest.h>
 
@@ -23,34 +24,45 @@ using namespace ::opio::net;         // NOLINT
 using namespace ::opio::net::tcp;    // NOLINT
 using namespace ::opio::test_utils;  // NOLINT
 
+template < typename Operation_Watchdog >
 struct connection_traits_st_t : public default_traits_st_t
 {
     using logger_t             = opio::logger::logger_t;
-    using operation_watchdog_t = asio_timer_operation_watchdog_t;
+    using operation_watchdog_t = Operation_Watchdog;
     using input_handler_t =
         std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
 };
 
 using connection_cfg_t = opio::net::tcp::connection_cfg_t;
-using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
-using buffer_t         = opio::net::simple_buffer_t;
-
-template < typename Input_Handler >
-connection_t::sptr_t make_connection( connection_traits_st_t::socket_t socket,
-                                      opio::net::tcp::connection_id_t id,
-                                      const opio::net::tcp::connection_cfg_t & cfg,
-                                      opio::logger::logger_t logger,
-                                      Input_Handler input_handler )
+template < typename Operation_Watchdog >
+using connection_t =
+    opio::net::tcp::connection_t< connection_traits_st_t< Operation_Watchdog > >;
+using buffer_t = opio::net::simple_buffer_t;
+
+template < typename Operation_Watchdog, typename Input_Handler >
+typename connection_t< Operation_Watchdog >::sptr_t make_connection(
+    asio_ns::ip::tcp::socket socket,
+    opio::net::tcp::connection_id_t id,
+    const opio::net::tcp::connection_cfg_t & cfg,
+    opio::logger::logger_t logger,
+    Input_Handler input_handler )
 {
-    return connection_t::make( std::move( socket ), [ & ]( auto & params ) {
-        params.connection_id( id )
-            .connection_cfg( cfg )
-            .logger( std::move( logger ) )
-            .input_handler( std::move( input_handler ) );
-    } );
+    return connection_t< Operation_Watchdog >::make(
+        std::move( socket ), [ & ]( auto & params ) {
+            params.connection_id( id )
+                .connection_cfg( cfg )
+                .logger( std::move( logger ) )
+                .input_handler( std::move( input_handler ) );
+        } );
 }
 
-TEST( OpioNetTcp, WriteOperationTimeout )  // NOLINT
+/**
+ * @brief Run a write that hangs and check it is timed out.
+ *
+ * @param max_extra_delay  How late the timeout is allowed to be.
+ */
+template < typename Operation_Watchdog >
+void run_write_operation_timeout_test( std::chrono::milliseconds max_extra_delay )
 {
     connection_cfg_t cfg{};
     cfg.write_timeout_per_1mb( std::chrono::milliseconds( 300 ) );
@@ -69,19 +81,21 @@ TEST( OpioNetTcp, WriteOperationTimeout )  // NOLINT
 
     connect_pair( ioctx, s1, s2 );
 
-    auto server_conn = make_connection( std::move( s1 ),
-                                        0,
-                                        cfg,
-                                        make_test_logger( "SERVER_CONN" ),
-                                        [ & ]( [[maybe_unused]] auto & ctx ) {
+    auto server_conn = make_connection< Operation_Watchdog >(
+        std::move( s1 ),
+        0,
+        cfg,
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( [[maybe_unused]] auto & ctx ) {
 
-                                        } );
+        } );
     server_conn->update_socket_options( socket_cfg );
-    auto client_conn = make_connection( std::move( s2 ),
-                                        1,
-                                        cfg,
-                                        make_test_logger( "client_conn" ),
-                                        [ & ]( [[maybe_unused]] auto & ctx ) {} );
+    auto client_conn = make_connection< Operation_Watchdog >(
+        std::move( s2 ),
+        1,
+        cfg,
+        make_test_logger( "client_conn" ),
+        [ & ]( [[maybe_unused]] auto & ctx ) {} );
     client_conn->update_socket_options( socket_cfg );
 
     // give it some time to connect:
@@ -117,7 +131,26 @@ TEST( OpioNetTcp, WriteOperationTimeout )  // NOLINT
                            std::chrono::steady_clock::now() - started_write_at )
                            .count();
     EXPECT_LE( 300, delay );
-    EXPECT_GE( 320, delay );
+    EXPECT_GE( 300 + max_extra_delay.count(), delay );
+}
+
+TEST( OpioNetTcp, WriteOperationTimeout )  // NOLINT
+{
+    run_write_operation_timeout_test< asio_timer_operation_watchdog_t >(
+        std::chrono::milliseconds( 20 ) );
+}
+
+TEST( OpioNetTcp, WriteOperationTimeoutTimingWheel )  // NOLINT
+{
+    // Timing wheel might be one tick late.
+    run_write_operation_timeout_test< timing_wheel_operation_watchdog_t >(
+        timing_wheel_service_t::tick + std::chrono::milliseconds( 20 ) );
+}
+
+TEST( OpioNetTcp, WriteOperationTimeoutTimingWheelSt )  // NOLINT
+{
+    run_write_operation_timeout_test< timing_wheel_operation_watchdog_st_t >(
+        timing_wheel_service_st_t::tick + std::chrono::milliseconds( 20 ) );
 }
 
 #endif  // !defined(OPIO_ASIO_WINDOWS)
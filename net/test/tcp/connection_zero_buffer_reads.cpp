@@ -0,0 +1,190 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+//
+// released_buffers_stats_driver_t
+//
+
+struct released_buffers_stats_driver_t : public opio::net::noop_stats_driver_t
+{
+    std::size_t released_count{};
+
+    template < typename Connection >
+    void read_buffer_released( [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++released_count;
+    }
+};
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t       = opio::logger::logger_t;
+    using stats_driver_t = released_buffers_stats_driver_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+template < typename Input_Handler >
+connection_t::sptr_t make_connection( connection_traits_st_t::socket_t socket,
+                                      opio::net::tcp::connection_id_t id,
+                                      const opio::net::tcp::connection_cfg_t & cfg,
+                                      opio::logger::logger_t logger,
+                                      Input_Handler input_handler )
+{
+    return connection_t::make( std::move( socket ), [ & ]( auto & params ) {
+        params.connection_id( id )
+            .connection_cfg( cfg )
+            .logger( std::move( logger ) )
+            .input_handler( std::move( input_handler ) );
+    } );
+}
+
+TEST( OpioNetTcp, ZeroBufferReadsCfg )  // NOLINT
+{
+    EXPECT_EQ( connection_cfg_t{}.read_buffer_release_threshold(), 0 );
+
+    const auto cfg = connection_cfg_t{}.read_buffer_release_threshold( 512 );
+    EXPECT_EQ( cfg.read_buffer_release_threshold(), 512 );
+}
+
+TEST( OpioNetTcp, ZeroBufferReadsPingPong )  // NOLINT
+{
+    constexpr std::size_t messages_count = 32;
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    // Server echoes everything it receives.
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{}.read_buffer_release_threshold( 1024 ),
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            ctx.connection().schedule_send( std::move( ctx.buf() ) );
+        } );
+
+    std::size_t received_count = 0;
+    connection_t::sptr_t client_conn;
+
+    const auto send_next = [ & ] {
+        std::string msg = fmt::format( "msg #{}", received_count );
+        client_conn->schedule_send( simple_buffer_t{ msg.data(), msg.size() } );
+    };
+
+    client_conn = make_connection(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{},
+        make_test_logger( "CLIENT_CONN" ),
+        [ & ]( auto & ctx ) {
+            EXPECT_EQ( ctx.buf().make_string_view(),
+                       fmt::format( "msg #{}", received_count ) );
+
+            if( ++received_count == messages_count )
+            {
+                server_conn->shutdown();
+                client_conn->shutdown();
+                return;
+            }
+            send_next();
+        } );
+
+    server_conn->start_reading();
+    client_conn->start_reading();
+    send_next();
+
+    ioctx.run();
+
+    EXPECT_EQ( received_count, messages_count );
+
+    // Each message is small so buffer is released after each read.
+    EXPECT_EQ( server_conn->stats_driver().released_count, messages_count );
+}
+
+TEST( OpioNetTcp, ZeroBufferReadsBulkData )  // NOLINT
+{
+    constexpr std::size_t bufs_count = 16;
+    constexpr std::size_t buf_size   = 4 * 1024;
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    std::string received_data;
+
+    const auto cfg = connection_cfg_t{}
+                         .input_buffer_size( 1024 )
+                         .read_budget_iterations( 4 )
+                         .read_buffer_release_threshold( 512 );
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        cfg,
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == etalon_data.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+
+    auto client_conn = make_connection( std::move( s2 ),
+                                        1,
+                                        connection_cfg_t{},
+                                        make_test_logger( "CLIENT_CONN" ),
+                                        [ & ]( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::size_t cb_count = 0;
+    for( std::size_t i = 0; i < bufs_count; ++i )
+    {
+        simple_buffer_t buf{ buf_size, static_cast< std::byte >( 'a' + i % 26 ) };
+        etalon_data.append( buf.make_string_view() );
+
+        client_conn->schedule_send_with_cb(
+            [ & ]( auto res ) {
+                EXPECT_EQ( res, send_buffers_result::success );
+                if( ++cb_count == bufs_count )
+                {
+                    client_conn->shutdown();
+                    server_conn->start_reading();
+                }
+            },
+            std::move( buf ) );
+    }
+
+    ioctx.run();
+
+    EXPECT_EQ( cb_count, bufs_count );
+    EXPECT_TRUE( received_data == etalon_data );
+
+    // All reads fill the whole buffer, so it is never released.
+    EXPECT_EQ( server_conn->stats_driver().released_count, 0 );
+}
+
+}  // anonymous namespace
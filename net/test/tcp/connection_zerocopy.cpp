@@ -0,0 +1,163 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t = opio::logger::logger_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+simple_buffer_t make_patterned_buffer( std::size_t size, std::size_t seed )
+{
+    simple_buffer_t buf{ size };
+    for( std::size_t i = 0; i < size; ++i )
+    {
+        buf.data()[ i ] = static_cast< std::byte >( ( seed + i ) % 251 );
+    }
+    return buf;
+}
+
+TEST( OpioNetTcp, ZerocopySendThresholdCfg )  // NOLINT
+{
+    EXPECT_EQ( connection_cfg_t{}.zerocopy_send_threshold(), 0 );
+
+    const auto cfg = connection_cfg_t{}.zerocopy_send_threshold( 128 * 1024 );
+    EXPECT_EQ( cfg.zerocopy_send_threshold(), 128 * 1024 );
+}
+
+TEST( OpioNetTcp, ZerocopySendLargeBuffers )  // NOLINT
+{
+    constexpr std::size_t large_buf_size = 1024 * 1024;
+    constexpr std::size_t bufs_count     = 8;
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    std::string received_data;
+
+    auto server_conn = make_connection< connection_t >(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == etalon_data.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection< connection_t >(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{}.zerocopy_send_threshold( 64 * 1024 ),
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::vector< send_buffers_result > cb_results;
+
+    for( std::size_t i = 0; i < bufs_count; ++i )
+    {
+        auto buf = make_patterned_buffer( large_buf_size, i );
+        etalon_data.append( buf.make_string_view() );
+
+        // A small one to be sent along with a large one.
+        auto small_buf = make_patterned_buffer( 100, i );
+        etalon_data.append( small_buf.make_string_view() );
+
+        client_conn->schedule_send_with_cb(
+            [ & ]( auto res ) {
+                cb_results.push_back( res );
+                if( cb_results.size() == bufs_count )
+                {
+                    client_conn->shutdown();
+                }
+            },
+            std::move( buf ),
+            std::move( small_buf ) );
+    }
+
+    ioctx.run();
+
+    ASSERT_EQ( received_data.size(), etalon_data.size() );
+    EXPECT_TRUE( received_data == etalon_data );
+
+    ASSERT_EQ( cb_results.size(), bufs_count );
+    for( auto r : cb_results )
+    {
+        EXPECT_EQ( r, send_buffers_result::success );
+    }
+}
+
+TEST( OpioNetTcp, ZerocopySendBelowThreshold )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string received_data;
+
+    auto server_conn = make_connection< connection_t >(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received_data.append( ctx.buf().make_string_view() );
+            if( received_data.size() == 5 )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection< connection_t >(
+        std::move( s2 ),
+        1,
+        connection_cfg_t{}.zerocopy_send_threshold( 1024 * 1024 ),
+        make_test_logger( "CLIENT_CONN" ),
+        []( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    std::optional< send_buffers_result > cb_result;
+    client_conn->schedule_send_with_cb(
+        [ & ]( auto res ) {
+            cb_result = res;
+            client_conn->shutdown();
+        },
+        simple_buffer_t::make_from( { '1', '2', '3', '4', '5' } ) );
+
+    ioctx.run();
+
+    EXPECT_EQ( received_data, "12345" );
+    ASSERT_TRUE( cb_result );
+    EXPECT_EQ( *cb_result, send_buffers_result::success );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,364 @@
+#include <opio/net/tcp/connector_pool.hpp>
+
+#if defined( __linux__ )
+#    include <fcntl.h>
+#    include <sys/resource.h>
+#    include <unistd.h>
+#endif
+
+#include <opio/net/tcp/acceptor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio;              // NOLINT
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+using namespace std::chrono_literals;
+
+template < typename Pred >
+bool poll_until( asio_ns::io_context & ioctx, Pred pred )
+{
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while( !pred() )
+    {
+        if( std::chrono::steady_clock::now() > deadline )
+        {
+            return false;
+        }
+        // Context stops when it runs out of work.
+        ioctx.restart();
+        ioctx.run_for( 1ms );
+    }
+    return true;
+}
+
+tcp_resolver_query_t make_query( std::uint16_t port )
+{
+    return tcp_resolver_query_t{ asio_ns::ip::tcp::v4(),
+                                 "127.0.0.1",
+                                 std::to_string( port ) };
+}
+
+TEST( OpioNetTcp, ConnectorPoolBackoff )  // NOLINT
+{
+    connector_pool_cfg_t cfg;
+    cfg.backoff_initial    = 100ms;
+    cfg.backoff_max        = 1000ms;
+    cfg.backoff_multiplier = 2.0;
+    cfg.backoff_jitter     = 0.0;
+
+    details::backoff_t backoff{ cfg };
+    EXPECT_EQ( backoff.next_delay(), 100ms );
+    EXPECT_EQ( backoff.next_delay(), 200ms );
+    EXPECT_EQ( backoff.next_delay(), 400ms );
+    EXPECT_EQ( backoff.next_delay(), 800ms );
+    EXPECT_EQ( backoff.next_delay(), 1000ms );
+    EXPECT_EQ( backoff.next_delay(), 1000ms );
+    EXPECT_EQ( backoff.failures(), 4 );
+
+    backoff.reset();
+    EXPECT_EQ( backoff.next_delay(), 100ms );
+
+    cfg.backoff_jitter = 0.5;
+    details::backoff_t jittered{ cfg };
+    bool spread = false;
+    for( int i = 0; i < 100; ++i )
+    {
+        jittered.reset();
+        const auto d = jittered.next_delay();
+        EXPECT_GE( d, 50ms );
+        EXPECT_LE( d, 150ms );
+        spread = spread || d != 100ms;
+    }
+    EXPECT_TRUE( spread );
+}
+
+TEST( OpioNetTcp, ConnectorPoolKeepsWarmConnections )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+    const auto port = make_random_port_value();
+
+    std::vector< asio_ns::ip::tcp::socket > accepted;
+    auto acceptor = make_acceptor(
+        ioctx.get_executor(),
+        asio_ns::ip::tcp::endpoint{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                    port },
+        make_test_logger( "acceptor" ),
+        [ & ]( auto socket ) { accepted.push_back( std::move( socket ) ); } );
+    acceptor->open();
+    ioctx.poll();
+
+    connector_pool_cfg_t cfg;
+    cfg.warm_connections = 3;
+
+    socket_options_cfg_t socket_options;
+    socket_options.no_delay = true;
+
+    auto pool = make_connector_pool( ioctx.get_executor(),
+                                     make_query( port ),
+                                     socket_options,
+                                     cfg,
+                                     make_test_logger( "pool" ) );
+    pool->start();
+
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return 3 == pool->ready_count() && 3 == accepted.size();
+    } ) );
+    EXPECT_EQ( pool->resolves_count(), 1 );
+
+    std::optional< asio_ns::ip::tcp::socket > taken;
+    pool->async_take( [ & ]( const auto & ec, auto socket ) {
+        ASSERT_FALSE( ec );
+        taken.emplace( std::move( socket ) );
+    } );
+
+    ASSERT_TRUE( poll_until( ioctx, [ & ] { return taken.has_value(); } ) );
+    ASSERT_TRUE( taken->is_open() );
+
+    asio_ns::ip::tcp::no_delay no_delay;
+    taken->get_option( no_delay );
+    EXPECT_TRUE( no_delay.value() );
+
+    // The pool is replenished, resolved endpoints are reused.
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return 3 == pool->ready_count() && 4 == accepted.size();
+    } ) );
+    EXPECT_EQ( pool->resolves_count(), 1 );
+
+    pool->stop();
+    acceptor->close();
+    ioctx.restart();
+    ioctx.poll();
+    EXPECT_EQ( pool->ready_count(), 0 );
+}
+
+TEST( OpioNetTcp, ConnectorPoolReconnectsWithBackoff )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+    const auto port = make_random_port_value();
+
+    connector_pool_cfg_t cfg;
+    cfg.warm_connections = 1;
+    cfg.backoff_initial  = 5ms;
+    cfg.backoff_max      = 20ms;
+
+    auto pool = make_connector_pool( ioctx.get_executor(),
+                                     make_query( port ),
+                                     socket_options_cfg_t{},
+                                     cfg,
+                                     make_test_logger( "pool" ) );
+    pool->start();
+
+    std::optional< asio_ns::ip::tcp::socket > taken;
+    pool->async_take( [ & ]( const auto & ec, auto socket ) {
+        ASSERT_FALSE( ec );
+        taken.emplace( std::move( socket ) );
+    } );
+
+    // Nobody listens: connects fail, endpoints get resolved again.
+    ASSERT_TRUE(
+        poll_until( ioctx, [ & ] { return 3 <= pool->resolves_count(); } ) );
+    EXPECT_FALSE( taken );
+    EXPECT_EQ( pool->waiters_count(), 1 );
+
+    std::vector< asio_ns::ip::tcp::socket > accepted;
+    auto acceptor = make_acceptor(
+        ioctx.get_executor(),
+        asio_ns::ip::tcp::endpoint{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                    port },
+        make_test_logger( "acceptor" ),
+        [ & ]( auto socket ) { accepted.push_back( std::move( socket ) ); } );
+    acceptor->open();
+
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return taken.has_value() && 1 == pool->ready_count();
+    } ) );
+    EXPECT_TRUE( taken->is_open() );
+    EXPECT_EQ( pool->waiters_count(), 0 );
+
+    pool->stop();
+    acceptor->close();
+    ioctx.restart();
+    ioctx.poll();
+}
+
+TEST( OpioNetTcp, ConnectorPoolStopAbortsWaiters )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    connector_pool_cfg_t cfg;
+    cfg.backoff_initial = 10s;
+
+    auto pool = make_connector_pool( ioctx.get_executor(),
+                                     make_query( make_random_port_value() ),
+                                     socket_options_cfg_t{},
+                                     cfg,
+                                     make_test_logger( "pool" ) );
+    pool->start();
+
+    std::optional< asio_ns::error_code > result;
+    pool->async_take( [ & ]( const auto & ec, [[maybe_unused]] auto socket ) {
+        result = ec;
+    } );
+    ASSERT_TRUE(
+        poll_until( ioctx, [ & ] { return 1 == pool->waiters_count(); } ) );
+
+    pool->stop();
+    ASSERT_TRUE( poll_until( ioctx, [ & ] { return result.has_value(); } ) );
+    EXPECT_TRUE( error_is_operation_aborted( *result ) );
+
+    // Taking from a stopped pool fails right away.
+    result.reset();
+    pool->async_take( [ & ]( const auto & ec, [[maybe_unused]] auto socket ) {
+        result = ec;
+    } );
+    ASSERT_TRUE( poll_until( ioctx, [ & ] { return result.has_value(); } ) );
+    EXPECT_TRUE( error_is_operation_aborted( *result ) );
+}
+
+TEST( OpioNetTcp, ConnectorPoolStopAbortsConnects )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+    const auto port = make_random_port_value();
+
+    // A listener that never accepts: once its queue is full
+    // connects hang.
+    asio_ns::ip::tcp::acceptor listener{ ioctx };
+    const asio_ns::ip::tcp::endpoint ep{ asio_ns::ip::make_address(
+                                             "127.0.0.1" ),
+                                         port };
+    listener.open( ep.protocol() );
+    listener.set_option( asio_ns::socket_base::reuse_address{ true } );
+    listener.bind( ep );
+    listener.listen( 0 );
+
+    connector_pool_cfg_t cfg;
+    cfg.warm_connections = 4;
+
+    auto pool = make_connector_pool( ioctx.get_executor(),
+                                     make_query( port ),
+                                     socket_options_cfg_t{},
+                                     cfg,
+                                     make_test_logger( "pool" ) );
+    pool->start();
+
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return 4 == pool->ready_count() + pool->pending_connects_count()
+               && 0 < pool->pending_connects_count();
+    } ) );
+    ioctx.restart();
+    ioctx.run_for( 50ms );
+    ASSERT_LT( 0, pool->pending_connects_count() );
+
+    pool->stop();
+    ASSERT_TRUE( poll_until(
+        ioctx, [ & ] { return 0 == pool->pending_connects_count(); } ) );
+    EXPECT_EQ( pool->ready_count(), 0 );
+}
+
+#if defined( __linux__ )
+
+//
+// rlimit_guard_t
+//
+
+/**
+ * @brief Restores the limit of open files on scope exit.
+ */
+class rlimit_guard_t
+{
+public:
+    rlimit_guard_t() { getrlimit( RLIMIT_NOFILE, &m_original ); }
+    ~rlimit_guard_t() { setrlimit( RLIMIT_NOFILE, &m_original ); }
+
+    rlimit_guard_t( const rlimit_guard_t & ) = delete;
+    rlimit_guard_t & operator=( const rlimit_guard_t & ) = delete;
+
+    [[nodiscard]] const rlimit & original() const noexcept { return m_original; }
+
+private:
+    rlimit m_original{};
+};
+
+TEST( OpioNetTcp, ConnectorPoolBacksOffOnSyncFailure )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+    const auto port = make_random_port_value();
+
+    std::vector< asio_ns::ip::tcp::socket > accepted;
+    auto acceptor = make_acceptor(
+        ioctx.get_executor(),
+        asio_ns::ip::tcp::endpoint{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                    port },
+        make_test_logger( "acceptor" ),
+        [ & ]( auto socket ) { accepted.push_back( std::move( socket ) ); } );
+    acceptor->open();
+    ioctx.poll();
+
+    connector_pool_cfg_t cfg;
+    cfg.warm_connections = 1;
+    cfg.backoff_initial  = 20ms;
+    cfg.backoff_max      = 20ms;
+
+    auto pool = make_connector_pool( ioctx.get_executor(),
+                                     make_query( port ),
+                                     socket_options_cfg_t{},
+                                     cfg,
+                                     make_test_logger( "pool" ) );
+    pool->start();
+
+    // Endpoints get cached.
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return 1 == pool->ready_count() && 1 == accepted.size();
+    } ) );
+
+    // No more descriptors: opening a socket fails synchronously.
+    // The limit is restored even if an assertion fails.
+    std::optional< rlimit_guard_t > rlimit_guard;
+    rlimit_guard.emplace();
+    const int next_fd = ::open( "/dev/null", O_RDONLY );
+    ASSERT_LE( 0, next_fd );
+    ::close( next_fd );
+
+    rlimit limit   = rlimit_guard->original();
+    limit.rlim_cur = static_cast< rlim_t >( next_fd );
+    ASSERT_EQ( 0, setrlimit( RLIMIT_NOFILE, &limit ) );
+
+    std::optional< asio_ns::ip::tcp::socket > taken;
+    pool->async_take( [ & ]( const auto & ec, auto socket ) {
+        ASSERT_FALSE( ec );
+        taken.emplace( std::move( socket ) );
+    } );
+
+    // Replenishing fails once and backs off instead of retrying in a loop.
+    ioctx.restart();
+    ioctx.poll();
+    rlimit_guard.reset();
+
+    ASSERT_TRUE( taken.has_value() );
+    EXPECT_EQ( pool->ready_count(), 0 );
+    EXPECT_EQ( pool->pending_connects_count(), 0 );
+
+    // Reconnects after backoff.
+    ASSERT_TRUE( poll_until( ioctx, [ & ] {
+        return 1 == pool->ready_count() && 2 == accepted.size();
+    } ) );
+
+    pool->stop();
+    acceptor->close();
+    ioctx.restart();
+    ioctx.poll();
+}
+
+#endif  // defined( __linux__ )
+
+}  // anonymous namespace
@@ -0,0 +1,52 @@
+#include <opio/net/tcp/gather_write.hpp>
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+#    include <unistd.h>
+#endif
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;       // NOLINT
+using namespace ::opio::net::tcp;  // NOLINT
+
+#if defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+TEST( OpioNetTcp, GatherWriteDoesntBlock )  // NOLINT
+{
+    // Sockets of a pair are in blocking mode.
+    std::array< int, 2 > fds{};
+    ASSERT_EQ( 0, ::socketpair( AF_UNIX, SOCK_STREAM, 0, fds.data() ) );
+
+    std::vector< std::byte > data( 64 * 1024, std::byte{ '*' } );
+    const std::array< asio_ns::const_buffer, 2 > bufs{
+        asio_ns::const_buffer{ data.data(), data.size() / 2 },
+        asio_ns::const_buffer{ data.data() + data.size() / 2,
+                               data.size() / 2 }
+    };
+    std::array< ::iovec, 2 > iov{};
+
+    // Write until the peer's buffer is full.
+    asio_ns::error_code ec;
+    std::size_t total = 0;
+    for( int i = 0; i < 1024 && !ec; ++i )
+    {
+        total += details::gather_write(
+            fds[ 0 ], std::span{ bufs }, std::span{ iov }, ec );
+    }
+
+    EXPECT_TRUE( error_is_would_block( ec ) );
+    EXPECT_LT( 0, total );
+
+    ::close( fds[ 0 ] );
+    ::close( fds[ 1 ] );
+}
+
+#endif  // defined( OPIO_NET_HAS_NATIVE_GATHER_WRITE )
+
+}  // anonymous namespace
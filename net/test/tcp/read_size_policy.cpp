@@ -0,0 +1,215 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+TEST( OpioNetTcp, FixedReadSizePolicy )  // NOLINT
+{
+    fixed_read_size_policy_t policy{};
+
+    EXPECT_EQ( policy.next_read_size( 32, 32, 32, 1024 ), 32 );
+    EXPECT_EQ( policy.next_read_size( 1, 32, 32, 1024 ), 32 );
+    EXPECT_EQ( policy.next_read_size( 0, 0, 64, 1024 ), 64 );
+}
+
+TEST( OpioNetTcp, AdaptiveReadSizePolicyGrow )  // NOLINT
+{
+    adaptive_read_size_policy_t policy{};
+
+    // Partially used buffer.
+    EXPECT_EQ( policy.next_read_size( 16, 32, 32, 1024 ), 32 );
+    EXPECT_EQ( policy.grows_count(), 0 );
+
+    // Fully utilized buffer.
+    EXPECT_EQ( policy.next_read_size( 32, 32, 32, 1024 ), 64 );
+    EXPECT_EQ( policy.next_read_size( 64, 64, 32, 1024 ), 128 );
+    EXPECT_EQ( policy.next_read_size( 128, 128, 32, 1024 ), 256 );
+    EXPECT_EQ( policy.next_read_size( 256, 256, 32, 1024 ), 512 );
+    EXPECT_EQ( policy.next_read_size( 512, 512, 32, 1024 ), 1024 );
+
+    // Hard max.
+    EXPECT_EQ( policy.next_read_size( 1024, 1024, 32, 1024 ), 1024 );
+    EXPECT_EQ( policy.grows_count(), 5 );
+    EXPECT_EQ( policy.current_size(), 1024 );
+
+    // Buffer provided by someone else is larger than the current size.
+    adaptive_read_size_policy_t policy2{};
+    EXPECT_EQ( policy2.next_read_size( 256, 256, 32, 1024 ), 512 );
+}
+
+TEST( OpioNetTcp, AdaptiveReadSizePolicyShrink )  // NOLINT
+{
+    constexpr std::size_t shrink_after_reads = 4;
+    adaptive_read_size_policy_t policy{ shrink_after_reads };
+
+    std::size_t size = 32;
+    while( size < 1024 )
+    {
+        size = policy.next_read_size( size, size, 32, 1024 );
+    }
+    ASSERT_EQ( size, 1024 );
+
+    // Short reads for a while but average is still high.
+    EXPECT_EQ( policy.next_read_size( 300, 1024, 32, 1024 ), 1024 );
+    EXPECT_EQ( policy.next_read_size( 300, 1024, 32, 1024 ), 1024 );
+    EXPECT_EQ( policy.shrinks_count(), 0 );
+
+    // A long run of tiny reads makes the size go down
+    // but not faster than once per `shrink_after_reads` reads.
+    std::size_t reads = 0;
+    while( 32 < size )
+    {
+        const auto prev_size = size;
+        size = policy.next_read_size( 10, size, 32, 1024 );
+        ++reads;
+        ASSERT_TRUE( size == prev_size || size == prev_size / 2 );
+        ASSERT_LT( reads, 200 );
+    }
+
+    EXPECT_EQ( policy.shrinks_count(), 5 );
+    EXPECT_LE( shrink_after_reads * 5, reads );
+    EXPECT_LT( policy.average_read_size(), 32 );
+
+    // Never below min.
+    EXPECT_EQ( policy.next_read_size( 1, 32, 32, 1024 ), 32 );
+}
+
+TEST( OpioNetTcp, AdaptiveReadSizePolicyNoFlapping )  // NOLINT
+{
+    adaptive_read_size_policy_t policy{ 2 };
+
+    EXPECT_EQ( policy.next_read_size( 64, 64, 64, 1024 ), 128 );
+
+    // Reads of half the buffer are fine: no shrinking.
+    for( int i = 0; i < 100; ++i )
+    {
+        EXPECT_EQ( policy.next_read_size( 64, 128, 64, 1024 ), 128 );
+    }
+    EXPECT_EQ( policy.grows_count(), 1 );
+    EXPECT_EQ( policy.shrinks_count(), 0 );
+}
+
+//
+// read_size_stats_driver_t
+//
+
+struct read_size_stats_driver_t : public opio::net::noop_stats_driver_t
+{
+    std::size_t max_read_size{};
+    std::size_t changes_count{};
+
+    template < typename Connection >
+    void read_size_changed( [[maybe_unused]] std::size_t old_size,
+                            std::size_t new_size,
+                            [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++changes_count;
+        max_read_size = std::max( max_read_size, new_size );
+    }
+};
+
+struct connection_traits_st_t : public default_traits_st_t
+{
+    using logger_t       = opio::logger::logger_t;
+    using stats_driver_t = read_size_stats_driver_t;
+    using input_handler_t =
+        std::function< void( input_ctx_t< connection_traits_st_t > & ) >;
+    using read_size_policy_t = adaptive_read_size_policy_t;
+};
+
+using connection_cfg_t = opio::net::tcp::connection_cfg_t;
+using connection_t     = opio::net::tcp::connection_t< connection_traits_st_t >;
+
+TEST( OpioNetTcp, ConnectionAdaptiveReadSize )  // NOLINT
+{
+    constexpr std::size_t bufs_count = 16;
+    constexpr std::size_t buf_size   = 4 * 1024;
+
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string etalon_data;
+    std::string received_data;
+    std::size_t max_chunk_size = 0;
+
+    const auto cfg = connection_cfg_t{}
+                         .input_buffer_size( 1024 )
+                         .max_input_buffer_size( 16 * 1024 );
+
+    auto server_conn =
+        connection_t::make( std::move( s1 ), [ & ]( auto & params ) {
+            params.connection_id( 0 )
+                .connection_cfg( cfg )
+                .logger( make_test_logger( "SERVER_CONN" ) )
+                .input_handler( [ & ]( auto & ctx ) {
+                    max_chunk_size =
+                        std::max( max_chunk_size, ctx.buf().size() );
+                    EXPECT_LE( ctx.next_read_size(), 16 * 1024 );
+                    received_data.append( ctx.buf().make_string_view() );
+                    if( received_data.size() == etalon_data.size() )
+                    {
+                        ctx.connection().shutdown();
+                    }
+                } );
+        } );
+
+    auto client_conn =
+        connection_t::make( std::move( s2 ), [ & ]( auto & params ) {
+            params.connection_id( 1 )
+                .logger( make_test_logger( "CLIENT_CONN" ) )
+                .input_handler( [ & ]( [[maybe_unused]] auto & ctx ) {} );
+        } );
+    client_conn->start_reading();
+
+    std::size_t cb_count = 0;
+    for( std::size_t i = 0; i < bufs_count; ++i )
+    {
+        simple_buffer_t buf{ buf_size, static_cast< std::byte >( 'a' + i % 26 ) };
+        etalon_data.append( buf.make_string_view() );
+
+        client_conn->schedule_send_with_cb(
+            [ & ]( auto res ) {
+                EXPECT_EQ( res, send_buffers_result::success );
+                if( ++cb_count == bufs_count )
+                {
+                    client_conn->shutdown();
+                    server_conn->start_reading();
+                }
+            },
+            std::move( buf ) );
+    }
+
+    ioctx.run();
+
+    EXPECT_EQ( cb_count, bufs_count );
+    EXPECT_TRUE( received_data == etalon_data );
+
+    // Data is already there when reading starts,
+    // so buffer grows up to the max.
+    EXPECT_EQ( max_chunk_size, 16 * 1024 );
+    EXPECT_EQ( server_conn->stats_driver().max_read_size, 16 * 1024 );
+    EXPECT_LE( 4, server_conn->stats_driver().changes_count );
+    EXPECT_LE( 4, server_conn->read_size_policy().grows_count() );
+}
+
+TEST( OpioNetTcp, ConnectionCfgMaxInputBufferSize )  // NOLINT
+{
+    EXPECT_EQ( connection_cfg_t{}.max_input_buffer_size(), 32 * 1024 * 1024 );
+    const auto cfg = connection_cfg_t{}.max_input_buffer_size( 4096 );
+    EXPECT_EQ( cfg.max_input_buffer_size(), 4096 );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,100 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net::tcp;  // NOLINT
+
+struct item_t
+{
+    int value{ -1 };
+    int reset_count{ 0 };
+
+    void reset() noexcept
+    {
+        value = -1;
+        ++reset_count;
+    }
+};
+
+using ring_t = details::recycling_ring_t< item_t >;
+
+TEST( OpioNetTcp, RecyclingRingFifo )  // NOLINT
+{
+    ring_t ring{ 3 };
+    EXPECT_EQ( ring.capacity(), 4 );
+    EXPECT_TRUE( ring.empty() );
+
+    // Go around the ring a few times.
+    int next_push = 0;
+    int next_pop  = 0;
+    for( int k = 0; k < 10; ++k )
+    {
+        ring.push().value = next_push++;
+        ring.push().value = next_push++;
+        ring.push().value = next_push++;
+        EXPECT_EQ( ring.size(), 3 );
+        EXPECT_EQ( ring.back().value, next_push - 1 );
+
+        for( int i = 0; i < 3; ++i )
+        {
+            ASSERT_EQ( ring.front().value, next_pop++ );
+            ring.pop();
+        }
+        EXPECT_TRUE( ring.empty() );
+    }
+
+    EXPECT_EQ( ring.capacity(), 4 );
+}
+
+TEST( OpioNetTcp, RecyclingRingItemsAreRecycled )  // NOLINT
+{
+    ring_t ring{ 1 };
+
+    auto * first = &ring.push();
+    first->value = 1;
+    ring.pop();
+
+    auto & second = ring.push();
+    EXPECT_EQ( &second, first );
+    EXPECT_EQ( second.value, -1 );
+    EXPECT_EQ( second.reset_count, 1 );
+}
+
+TEST( OpioNetTcp, RecyclingRingGrow )  // NOLINT
+{
+    ring_t ring{ 2 };
+
+    // Make head to be in the middle of the ring.
+    ring.push();
+    ring.pop();
+
+    std::vector< item_t * > items;
+    for( int i = 0; i < 9; ++i )
+    {
+        auto & item = ring.push();
+        item.value  = i;
+        items.push_back( &item );
+    }
+
+    EXPECT_EQ( ring.size(), 9 );
+    EXPECT_EQ( ring.capacity(), 16 );
+
+    for( int i = 0; i < 9; ++i )
+    {
+        ASSERT_EQ( &ring[ static_cast< std::size_t >( i ) ], items[ i ] );
+    }
+
+    // References remain valid after growing.
+    for( int i = 0; i < 9; ++i )
+    {
+        ASSERT_EQ( &ring.front(), items[ i ] );
+        ASSERT_EQ( ring.front().value, i );
+        ring.pop();
+    }
+    EXPECT_TRUE( ring.empty() );
+}
+
+}  // anonymous namespace
@@ -0,0 +1,110 @@
+#include <opio/net/tcp/connection.hpp>
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio::net::tcp;  // NOLINT
+
+using pool_t = details::send_submission_pool_t< opio::net::simple_buffer_t >;
+using submission_t = pool_t::submission_t;
+
+TEST( OpioNetTcp, SendSubmissionPoolReusesItems )  // NOLINT
+{
+    pool_t pool;
+
+    auto s1 = pool.acquire();
+    auto s2 = pool.acquire();
+    ASSERT_TRUE( s1 );
+    ASSERT_TRUE( s2 );
+
+    s1->bufs.emplace_back( opio::net::simple_buffer_t{ "abc", 3 } );
+    s1->cb = []( auto ) {};
+    const auto * bufs_storage = s1->bufs.data();
+
+    auto * const p1 = s1.get();
+    auto * const p2 = s2.get();
+
+    s1->next = s2.release();
+    pool.recycle( s1.release() );
+
+    // Items are taken in the order they were given back.
+    auto r1 = pool.acquire();
+    auto r2 = pool.acquire();
+    EXPECT_EQ( r1.get(), p1 );
+    EXPECT_EQ( r2.get(), p2 );
+
+    // Items are reset, but keep the storage for buffers.
+    EXPECT_EQ( r1->next, nullptr );
+    EXPECT_TRUE( r1->bufs.empty() );
+    EXPECT_FALSE( r1->cb );
+    r1->bufs.emplace_back( opio::net::simple_buffer_t{ "xyz", 3 } );
+    EXPECT_EQ( r1->bufs.data(), bufs_storage );
+
+    // Freelist is empty.
+    auto r3 = pool.acquire();
+    EXPECT_NE( r3.get(), p1 );
+    EXPECT_NE( r3.get(), p2 );
+}
+
+TEST( OpioNetTcp, SendSubmissionPoolIsLimited )  // NOLINT
+{
+    pool_t pool;
+
+    const auto n = pool_t::max_free_count + 10;
+
+    std::vector< submission_t * > items;
+    submission_t * head = nullptr;
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        auto * s = pool.acquire().release();
+        items.push_back( s );
+        s->next = head;
+        head    = s;
+    }
+
+    pool.recycle( head );
+
+    // Only a limited number of items are kept.
+    std::vector< std::unique_ptr< submission_t > > reused;
+    for( std::size_t i = 0; i < pool_t::max_free_count; ++i )
+    {
+        reused.push_back( pool.acquire() );
+        EXPECT_NE( std::find( items.begin(), items.end(), reused.back().get() ),
+                   items.end() );
+    }
+}
+
+TEST( OpioNetTcp, SendSubmissionPoolConcurrentAcquire )  // NOLINT
+{
+    pool_t pool;
+
+    constexpr int threads_count = 4;
+    constexpr int iterations    = 20000;
+
+    std::vector< std::thread > threads;
+    for( int t = 0; t < threads_count; ++t )
+    {
+        threads.emplace_back( [ & ] {
+            for( int i = 0; i < iterations; ++i )
+            {
+                auto s = pool.acquire();
+                ASSERT_EQ( s->next, nullptr );
+                ASSERT_TRUE( s->bufs.empty() );
+                s->bufs.emplace_back( opio::net::simple_buffer_t{ "a", 1 } );
+                pool.recycle( s.release() );
+            }
+        } );
+    }
+
+    for( auto & t : threads )
+    {
+        t.join();
+    }
+}
+
+}  // anonymous namespace
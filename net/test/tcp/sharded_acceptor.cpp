@@ -0,0 +1,248 @@
+#include <opio/net/tcp/sharded_acceptor.hpp>
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <opio/test_utils/test_logger.hpp>
+
+#include <tcp_test_utils.hpp>
+
+namespace /* anonymous */
+{
+
+using namespace ::opio;              // NOLINT
+using namespace ::opio::net;         // NOLINT
+using namespace ::opio::net::tcp;    // NOLINT
+using namespace ::opio::test_utils;  // NOLINT
+
+/**
+ * @brief Run a set of io_contexts each on its own thread.
+ */
+struct shards_t
+{
+    explicit shards_t( std::size_t n )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            ioctxs.push_back( std::make_unique< asio_ns::io_context >( 1 ) );
+            guards.emplace_back( asio_ns::make_work_guard( *ioctxs.back() ) );
+        }
+        for( auto & ioctx : ioctxs )
+        {
+            threads.emplace_back( [ &ioctx = *ioctx ] { ioctx.run(); } );
+        }
+    }
+
+    ~shards_t()
+    {
+        guards.clear();
+        for( auto & t : threads )
+        {
+            t.join();
+        }
+    }
+
+    shards_t( const shards_t & ) = delete;
+    shards_t( shards_t && )      = delete;
+    shards_t & operator=( const shards_t & ) = delete;
+    shards_t & operator=( shards_t && ) = delete;
+
+    [[nodiscard]] std::vector< asio_ns::any_io_executor > executors() const
+    {
+        std::vector< asio_ns::any_io_executor > res;
+        for( const auto & ioctx : ioctxs )
+        {
+            res.emplace_back( ioctx->get_executor() );
+        }
+        return res;
+    }
+
+    [[nodiscard]] std::size_t running_shard() const
+    {
+        for( std::size_t i = 0; i < ioctxs.size(); ++i )
+        {
+            if( ioctxs[ i ]->get_executor().running_in_this_thread() )
+            {
+                return i;
+            }
+        }
+        return ioctxs.size();
+    }
+
+    std::vector< std::unique_ptr< asio_ns::io_context > > ioctxs;
+    std::vector<
+        asio_ns::executor_work_guard< asio_ns::io_context::executor_type > >
+        guards;
+    std::vector< std::thread > threads;
+};
+
+constexpr std::size_t shards_count = 3;
+
+/**
+ * @brief Accept a number of clients connecting from several threads.
+ *
+ * @param accepted_on_shard  The number of sockets accepted on each shard
+ *                           (and on other threads as the last item).
+ */
+void run_sharded_accept( bool cpu_steering,
+                         std::uint16_t port,
+                         std::vector< std::size_t > & accepted_on_shard )
+{
+    constexpr std::size_t client_threads_count = 3;
+    constexpr std::size_t clients_count        = 30;
+
+    shards_t shards{ shards_count };
+
+    asio_ns::ip::tcp::endpoint ep{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                   port };
+
+    std::mutex lock;
+    std::vector< asio_ns::ip::tcp::socket > accepted;
+    accepted_on_shard.assign( shards_count + 1, 0 );
+    std::promise< void > all_accepted;
+
+    auto acceptor = make_sharded_acceptor(
+        shards.executors(),
+        ep,
+        socket_options_cfg_t{},
+        make_test_logger( "acceptor" ),
+        [ & ]( auto socket ) {
+            std::lock_guard< std::mutex > guard{ lock };
+            ++accepted_on_shard[ shards.running_shard() ];
+            accepted.push_back( std::move( socket ) );
+            if( clients_count == accepted.size() )
+            {
+                all_accepted.set_value();
+            }
+        },
+        cpu_steering );
+
+    ASSERT_EQ( acceptor->size(), shards_count );
+
+    if( 0 == port )
+    {
+        // The port is known before listeners are opened.
+        ASSERT_NE( acceptor->endpoint().port(), 0 );
+        ep = acceptor->endpoint();
+    }
+
+    std::promise< asio_ns::error_code > opened;
+    acceptor->open( [ & ]( const auto & ec ) { opened.set_value( ec ); } );
+    ASSERT_FALSE( opened.get_future().get() );
+    ASSERT_EQ( acceptor->endpoint(), ep );
+
+    std::vector< std::unique_ptr< asio_ns::io_context > > client_ioctxs;
+    std::vector< asio_ns::ip::tcp::socket > clients;
+    std::vector< std::thread > client_threads;
+    for( std::size_t i = 0; i < client_threads_count; ++i )
+    {
+        client_ioctxs.push_back( std::make_unique< asio_ns::io_context >( 1 ) );
+        for( std::size_t j = i; j < clients_count; j += client_threads_count )
+        {
+            clients.emplace_back( *client_ioctxs.back() );
+        }
+    }
+    for( std::size_t i = 0; i < client_threads_count; ++i )
+    {
+        client_threads.emplace_back( [ &, i ] {
+            for( std::size_t j = i; j < clients_count; j += client_threads_count )
+            {
+                clients[ j ].connect( ep );
+            }
+        } );
+    }
+    for( auto & t : client_threads )
+    {
+        t.join();
+    }
+
+    ASSERT_EQ( all_accepted.get_future().wait_for( std::chrono::seconds( 5 ) ),
+               std::future_status::ready );
+
+    std::promise< asio_ns::error_code > closed;
+    acceptor->close( [ & ]( const auto & ec ) { closed.set_value( ec ); } );
+    ASSERT_FALSE( closed.get_future().get() );
+
+    // All sockets are accepted on shards' threads.
+    EXPECT_EQ( accepted_on_shard[ shards_count ], 0 );
+
+    std::size_t total = 0;
+    for( std::size_t i = 0; i < shards_count; ++i )
+    {
+        total += accepted_on_shard[ i ];
+    }
+    EXPECT_EQ( total, clients_count );
+
+    // Sockets must be destroyed on their contexts.
+    std::lock_guard< std::mutex > guard{ lock };
+    for( auto & s : accepted )
+    {
+        s.close();
+    }
+}
+
+TEST( OpioNetTcp, ShardedAcceptorAccept )  // NOLINT
+{
+    std::vector< std::size_t > accepted_on_shard;
+    run_sharded_accept( false, make_random_port_value(), accepted_on_shard );
+}
+
+TEST( OpioNetTcp, ShardedAcceptorAcceptCpuSteering )  // NOLINT
+{
+    std::vector< std::size_t > accepted_on_shard;
+    run_sharded_accept( true, make_random_port_value(), accepted_on_shard );
+}
+
+TEST( OpioNetTcp, ShardedAcceptorAcceptOnPickedPort )  // NOLINT
+{
+    std::vector< std::size_t > accepted_on_shard;
+    run_sharded_accept( false, 0, accepted_on_shard );
+
+    // Listeners share the port, so connections are balanced between them.
+    const auto shards_that_accepted =
+        std::count_if( accepted_on_shard.begin(),
+                       accepted_on_shard.begin() + shards_count,
+                       []( auto n ) { return 0 < n; } );
+    EXPECT_LT( 1, shards_that_accepted );
+}
+
+TEST( OpioNetTcp, ShardedAcceptorOpenFails )  // NOLINT
+{
+    shards_t shards{ 2 };
+
+    asio_ns::ip::tcp::endpoint ep{ asio_ns::ip::make_address( "127.0.0.1" ),
+                                   make_random_port_value() };
+
+    // A listener without SO_REUSEPORT occupies the endpoint.
+    asio_ns::io_context ioctx( 1 );
+    auto plain_acceptor = make_acceptor( ioctx.get_executor(),
+                                         ep,
+                                         make_test_logger( "plain_acceptor" ),
+                                         []( [[maybe_unused]] auto socket ) {} );
+    plain_acceptor->open( []( const auto & ec ) { ASSERT_FALSE( ec ); } );
+    ioctx.poll();
+
+    auto acceptor = make_sharded_acceptor( shards.executors(),
+                                           ep,
+                                           socket_options_cfg_t{},
+                                           make_test_logger( "acceptor" ),
+                                           []( [[maybe_unused]] auto socket ) {} );
+
+    std::promise< asio_ns::error_code > opened;
+    acceptor->open( [ & ]( const auto & ec ) { opened.set_value( ec ); } );
+    EXPECT_TRUE( opened.get_future().get() );
+
+    std::promise< void > closed;
+    acceptor->close( [ & ]( [[maybe_unused]] const auto & ec ) {
+        closed.set_value();
+    } );
+    closed.get_future().get();
+
+    plain_acceptor->close();
+    ioctx.run();
+}
+
+}  // anonymous namespace
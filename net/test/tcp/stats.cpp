@@ -93,6 +93,17 @@ struct test_stats_driver_t : public opio::net::noop_stats_driver_t
     {
         async_write_size_finished += n;
     }
+
+    std::size_t writes_count{};
+    std::size_t write_iovecs_total{};
+
+    template < typename Connection >
+    void write_iovecs_count( std::size_t n,
+                             [[maybe_unused]] Connection & con ) noexcept
+    {
+        ++writes_count;
+        write_iovecs_total += n;
+    }
 };
 
 using namespace ::opio::net;         // NOLINT
@@ -189,6 +200,11 @@ TEST( OpioNetTcp, StatsDriver )  // NOLINT
     EXPECT_EQ( size_buf3 + size_buf4,
                client_conn->stats_driver().async_write_size_finished );
 
+    // buf1 and buf2 are written with a single sync write
+    // and buf3 with buf4 with a single async write.
+    EXPECT_EQ( 2, client_conn->stats_driver().writes_count );
+    EXPECT_EQ( 4, client_conn->stats_driver().write_iovecs_total );
+
     EXPECT_EQ( 0, client_conn->stats_driver().input_bytes_sync );
     EXPECT_EQ( 0, client_conn->stats_driver().input_bytes_async );
 
@@ -199,4 +215,149 @@ TEST( OpioNetTcp, StatsDriver )  // NOLINT
     EXPECT_EQ( 0, server_conn->stats_driver().output_bytes_async );
 }
 
+TEST( OpioNetTcp, StatsDriverWriteIovecsCount )  // NOLINT
+{
+    constexpr std::size_t bufs_count = 64;
+
+    for( const std::size_t max_iov : { std::size_t{ 16 }, bufs_count } )
+    {
+        asio_ns::io_context ioctx( 1 );
+
+        opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+        opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+        connect_pair( ioctx, s1, s2 );
+
+        std::size_t received = 0;
+
+        auto server_conn = make_connection(
+            std::move( s1 ),
+            0,
+            connection_cfg_t{},
+            make_test_logger( "SERVER_CONN" ),
+            [ & ]( auto & ctx ) {
+                received += ctx.buf().size();
+                if( bufs_count == received )
+                {
+                    ctx.connection().shutdown();
+                }
+            } );
+        server_conn->start_reading();
+
+        auto client_conn = make_connection(
+            std::move( s2 ),
+            1,
+            connection_cfg_t{}.max_iov_per_write( max_iov ),
+            make_test_logger( "client_conn" ),
+            [ & ]( [[maybe_unused]] auto & ctx ) {} );
+        client_conn->start_reading();
+
+        // Submitted buffers go to write queue without aggressive writes,
+        // so they are written with gather writes
+        // (total size fits a sync write).
+        std::vector< buffer_t > bufs;
+        for( std::size_t i = 0; i < bufs_count; ++i )
+        {
+            bufs.emplace_back( 1, static_cast< std::byte >( '*' ) );
+        }
+        client_conn->submit_send_vec_with_cb(
+            [ & ]( [[maybe_unused]] auto res ) { client_conn->shutdown(); },
+            std::move( bufs ) );
+
+        ioctx.run();
+
+        const auto & stats = client_conn->stats_driver();
+
+        EXPECT_EQ( bufs_count, received );
+        EXPECT_EQ( bufs_count, stats.output_bytes_sync );
+
+        if( bufs_count == max_iov )
+        {
+            // All buffers go with a single write.
+            EXPECT_EQ( 1, stats.writes_count );
+            EXPECT_EQ( bufs_count, stats.write_iovecs_total );
+        }
+        else
+        {
+            EXPECT_LT( 1, stats.writes_count );
+            EXPECT_GE( max_iov * stats.writes_count, stats.write_iovecs_total );
+        }
+    }
+}
+
+TEST( OpioNetTcp, StatsDriverAggressiveGatherWrite )  // NOLINT
+{
+    asio_ns::io_context ioctx( 1 );
+
+    opio::net::asio_ns::ip::tcp::socket s1{ ioctx };
+    opio::net::asio_ns::ip::tcp::socket s2{ ioctx };
+
+    connect_pair( ioctx, s1, s2 );
+
+    std::string received;
+
+    auto server_conn = make_connection(
+        std::move( s1 ),
+        0,
+        connection_cfg_t{},
+        make_test_logger( "SERVER_CONN" ),
+        [ & ]( auto & ctx ) {
+            received.append( ctx.buf().make_string_view() );
+            if( 10 == received.size() )
+            {
+                ctx.connection().shutdown();
+            }
+        } );
+    server_conn->start_reading();
+
+    auto client_conn = make_connection( std::move( s2 ),
+                                        1,
+                                        connection_cfg_t{},
+                                        make_test_logger( "client_conn" ),
+                                        [ & ]( [[maybe_unused]] auto & ctx ) {} );
+    client_conn->start_reading();
+
+    // A header and a few "attached" buffers.
+    std::vector< buffer_t > bufs;
+    bufs.emplace_back( buffer_t::make_from( { 'H', 'D', 'R' } ) );
+    bufs.emplace_back( buffer_t::make_from( { '1', '2' } ) );
+    bufs.emplace_back( buffer_t::make_from( { '3' } ) );
+    bufs.emplace_back( buffer_t::make_from( { '4', '5', '6', '7' } ) );
+
+    std::optional< send_buffers_result > cb_result;
+    client_conn->schedule_send_vec_with_cb(
+        [ & ]( auto res ) {
+            cb_result = res;
+            client_conn->shutdown();
+        },
+        std::move( bufs ) );
+
+    ioctx.run();
+
+    EXPECT_EQ( received, "HDR1234567" );
+    ASSERT_TRUE( cb_result );
+    EXPECT_EQ( *cb_result, send_buffers_result::success );
+
+    // The whole vector goes with a single write.
+    const auto & stats = client_conn->stats_driver();
+    EXPECT_EQ( 1, stats.writes_count );
+    EXPECT_EQ( 4, stats.write_iovecs_total );
+    EXPECT_EQ( 10, stats.sync_write_size_started );
+    EXPECT_EQ( 10, stats.output_bytes_sync );
+}
+
+TEST( OpioNetTcp, RawConnectionCfgMaxIovPerWrite )  // NOLINT
+{
+    EXPECT_EQ( connection_cfg_t{}.max_iov_per_write(),
+               details::reasonable_max_iov_len() );
+    EXPECT_EQ( connection_cfg_t{}.max_iov_per_write( 256 ).max_iov_per_write(),
+               std::min< std::size_t >( 256,
+                                        details::max_gather_write_iov_len() ) );
+    EXPECT_EQ( connection_cfg_t{}.max_iov_per_write( 0 ).max_iov_per_write(), 1 );
+    EXPECT_EQ( connection_cfg_t{}
+                   .max_iov_per_write( details::max_gather_write_iov_len() + 1 )
+                   .max_iov_per_write(),
+               details::max_gather_write_iov_len() );
+}
+
 }  // anonymous namespace
@@ -0,0 +1,137 @@
+/**
+ * @file
+ *
+ * Stress benchmark for pkg_input_t receiving large packages.
+ *
+ * A large message is delivered into pkg_input_t in many small reads
+ * (as it happens when reading from a socket), then it is parsed
+ * from the input. The time of appending reads and the time of parsing
+ * are reported separately.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+
+#include <fmt/format.h>
+
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+#include <opio/proto_entry/pkg_input.hpp>
+
+#include "bench.pb.h"
+
+using message_t = opio::proto_entry::benchmarks::large_message;
+
+//
+// bench_params_t
+//
+
+struct bench_params_t
+{
+    std::size_t package_size_mb{ 100 };
+    std::size_t read_size{ 16 * 1024 };
+    std::size_t rounds{ 3 };
+};
+
+using seconds_t = std::chrono::duration< double >;
+
+int main( int argc, char * argv[] )
+{
+    try
+    {
+        bench_params_t params;
+
+        CLI::App app{ "_benchmark.opio.proto_entry.pkg_input_large_package" };
+
+        app.add_option(
+               "--package-size,-p", params.package_size_mb, "package size in MB" )
+            ->required( false );
+        app.add_option( "--read-size,-s",
+                        params.read_size,
+                        "size of a single read in bytes" )
+            ->required( false );
+        app.add_option( "--rounds,-r", params.rounds, "number of rounds" )
+            ->required( false );
+
+        CLI11_PARSE( app, argc, argv );
+
+        message_t msg;
+        msg.set_id( 42 );
+        msg.set_payload(
+            std::string( params.package_size_mb * 1024 * 1024, 'P' ) );
+        const auto data = msg.SerializeAsString();
+
+        seconds_t append_elapsed{};
+        seconds_t parse_elapsed{};
+        std::size_t queue_capacity = 0;
+
+        for( std::size_t r = 0; r < params.rounds; ++r )
+        {
+            // Prepare reads beforehand, so only appending is measured.
+            std::vector< opio::net::simple_buffer_t > reads;
+            reads.reserve( data.size() / params.read_size + 1 );
+            for( std::size_t offset = 0; offset < data.size();
+                 offset += params.read_size )
+            {
+                const auto n = std::min( params.read_size, data.size() - offset );
+                opio::net::simple_buffer_t buf{ n };
+                std::memcpy( buf.data(), data.data() + offset, n );
+                reads.push_back( std::move( buf ) );
+            }
+
+            opio::proto_entry::pkg_input_t input{};
+
+            const auto append_started_at = std::chrono::steady_clock::now();
+            for( auto & buf : reads )
+            {
+                input.append( std::move( buf ) );
+            }
+            const auto parse_started_at = std::chrono::steady_clock::now();
+
+            google::protobuf::io::LimitingInputStream message_stream{
+                &input, static_cast< std::int64_t >( data.size() ) };
+
+            message_t parsed;
+            if( !parsed.ParseFromZeroCopyStream( &message_stream )
+                || parsed.payload().size() != msg.payload().size() ) [[unlikely]]
+            {
+                throw std::runtime_error{ "failed to parse a message" };
+            }
+
+            append_elapsed += parse_started_at - append_started_at;
+            parse_elapsed += std::chrono::steady_clock::now() - parse_started_at;
+            queue_capacity = input.queue_capacity();
+        }
+
+        const auto total_mb =
+            static_cast< double >( params.rounds * data.size() )
+            / ( 1024.0 * 1024.0 );
+
+        std::cout << fmt::format(
+            "package size: {} bytes; read size: {}; reads: {}; rounds: {}\n"
+            "queue capacity: {}\n"
+            "append: {:.3f} sec ({:.0f} MB/s)\n"
+            "parse:  {:.3f} sec ({:.0f} MB/s)\n",
+            data.size(),
+            params.read_size,
+            ( data.size() + params.read_size - 1 ) / params.read_size,
+            params.rounds,
+            queue_capacity,
+            append_elapsed.count(),
+            total_mb / append_elapsed.count(),
+            parse_elapsed.count(),
+            total_mb / parse_elapsed.count() );
+    }
+    catch( const std::exception & ex )
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file
+ *
+ * Benchmark for parsing protobuf messages out of pkg_input_t.
+ *
+ * Compares two ways of parsing a package content that lies
+ * in a single input buffer (which is a typical case for small messages):
+ *
+ * - `stream`: LimitingInputStream over pkg_input_t
+ *             and `ParseFromZeroCopyStream()`;
+ * - `contiguous`: pkg_input_t::view_contiguous() and `ParseFromArray()`.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <CLI/CLI.hpp>
+
+#include <fmt/format.h>
+
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+
+#include <opio/proto_entry/pkg_input.hpp>
+#include <opio/proto_entry/impl/protobuf_parsing_engines.hpp>
+
+#include "bench.pb.h"
+
+using message_t = opio::proto_entry::benchmarks::small_message;
+
+//
+// bench_params_t
+//
+
+struct bench_params_t
+{
+    std::size_t messages_per_buffer{ 64 };
+    std::size_t symbol_size{ 8 };
+    std::size_t rounds{ 100'000 };
+};
+
+//
+// make_input_data()
+//
+
+/**
+ * @brief Serializes a number of messages back to back.
+ */
+std::string make_input_data( const bench_params_t & params )
+{
+    message_t msg;
+    msg.set_id( 0x1234'5678'9ABC );
+    msg.set_kind( 3 );
+    msg.set_price( 1'000'025 );
+    msg.set_qty( 100 );
+    msg.set_symbol( std::string( params.symbol_size, 'S' ) );
+
+    std::string res;
+    for( std::size_t i = 0; i < params.messages_per_buffer; ++i )
+    {
+        res += msg.SerializeAsString();
+    }
+    return res;
+}
+
+//
+// run_bench()
+//
+
+/**
+ * @brief Runs a given parse routine over all messages in a buffer
+ *        for a given number of rounds.
+ *
+ * @return Elapsed time in seconds.
+ */
+template < typename Parse >
+double run_bench( const bench_params_t & params,
+                  const std::string & data,
+                  std::size_t message_size,
+                  Parse parse )
+{
+    std::size_t parsed = 0;
+
+    const auto started_at = std::chrono::steady_clock::now();
+    for( std::size_t r = 0; r < params.rounds; ++r )
+    {
+        opio::net::simple_buffer_t buf{ data.size() };
+        std::memcpy( buf.data(), data.data(), data.size() );
+
+        opio::proto_entry::pkg_input_t input{};
+        input.append( std::move( buf ) );
+
+        for( std::size_t i = 0; i < params.messages_per_buffer; ++i )
+        {
+            parsed += parse( input, message_size );
+        }
+    }
+    const auto elapsed = std::chrono::duration< double >(
+                             std::chrono::steady_clock::now() - started_at )
+                             .count();
+
+    if( parsed != params.rounds * params.messages_per_buffer ) [[unlikely]]
+    {
+        throw std::runtime_error{ "failed to parse messages" };
+    }
+
+    return elapsed;
+}
+
+int main( int argc, char * argv[] )
+{
+    try
+    {
+        bench_params_t params;
+
+        CLI::App app{ "_benchmark.opio.proto_entry.pkg_input_parse" };
+
+        app.add_option( "--messages,-m",
+                        params.messages_per_buffer,
+                        "messages per input buffer" )
+            ->required( false );
+        app.add_option( "--symbol-size,-s",
+                        params.symbol_size,
+                        "size of a string field of a message" )
+            ->required( false );
+        app.add_option( "--rounds,-r", params.rounds, "number of rounds" )
+            ->required( false );
+
+        CLI11_PARSE( app, argc, argv );
+
+        const auto data = make_input_data( params );
+        const auto message_size = data.size() / params.messages_per_buffer;
+
+        using engine_t =
+            opio::proto_entry::impl::protobuf_trivial_parsing_engine_t<
+                message_t >;
+
+        const auto stream_elapsed = run_bench(
+            params, data, message_size, []( auto & input, std::size_t n ) {
+                google::protobuf::io::LimitingInputStream message_stream{
+                    &input, static_cast< std::int64_t >( n ) };
+                const auto res = engine_t::parse_package( message_stream );
+                return res && message_stream.ByteCount()
+                                  == static_cast< std::int64_t >( n );
+            } );
+
+        const auto contiguous_elapsed = run_bench(
+            params, data, message_size, []( auto & input, std::size_t n ) {
+                const auto content = input.view_contiguous( n );
+                if( !content ) [[unlikely]]
+                {
+                    return false;
+                }
+                const auto res = engine_t::parse_package( *content );
+                input.Skip( static_cast< int >( n ) );
+                return res.has_value();
+            } );
+
+        const auto total = static_cast< double >( params.rounds
+                                                  * params.messages_per_buffer );
+
+        std::cout << fmt::format(
+            "message size: {}; messages per buffer: {}; rounds: {}\n"
+            "stream:     {:.1f} ns/msg\n"
+            "contiguous: {:.1f} ns/msg ({:.2f}x)\n",
+            message_size,
+            params.messages_per_buffer,
+            params.rounds,
+            stream_elapsed * 1e9 / total,
+            contiguous_elapsed * 1e9 / total,
+            stream_elapsed / contiguous_elapsed );
+    }
+    catch( const std::exception & ex )
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
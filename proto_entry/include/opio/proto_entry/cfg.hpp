@@ -17,6 +17,12 @@ inline constexpr std::uint32_t default_await_heartbeat_reply_timeout_msec = 2000
 inline constexpr std::uint32_t default_max_valid_package_size = 100 * 1024 * 1024;
 inline constexpr std::size_t default_input_buffer_size        = 256 * 1024;
 inline constexpr std::uint32_t default_write_timeout_per_1mb_msec = 1000;
+inline constexpr std::uint32_t default_zerocopy_send_threshold    = 0;
+inline constexpr std::uint32_t default_max_iov_per_write          = 16;
+inline constexpr std::uint32_t default_write_coalescing_delay_usec = 0;
+inline constexpr std::uint32_t default_write_coalescing_bytes      = 16 * 1024;
+inline constexpr std::uint32_t default_write_coalescing_buffers    = 0;
+inline constexpr bool default_write_coalescing_use_tcp_cork        = false;
 
 }  // namespace details
 
@@ -139,6 +145,58 @@ struct entry_full_cfg_t
     std::uint32_t write_timeout_per_1mb_msec =
         details::default_write_timeout_per_1mb_msec;
 
+    /**
+     * @brief Zero-copy send threshold.
+     *
+     * Outgoing data (a package with attached binary) of this size or greater
+     * is sent with zero-copy send (`MSG_ZEROCOPY`, Linux only).
+     * Zero means disabled.
+     *
+     * @see opio::net::tcp::connection_cfg_t::zerocopy_send_threshold().
+     */
+    std::uint32_t zerocopy_send_threshold =
+        details::default_zerocopy_send_threshold;
+
+    /**
+     * @brief The maximum number of buffers passed to a single write.
+     *
+     * @see opio::net::tcp::connection_cfg_t::max_iov_per_write().
+     */
+    std::uint32_t max_iov_per_write = details::default_max_iov_per_write;
+
+    /**
+     * @brief The longest time outgoing data is held to coalesce small writes.
+     *
+     * Zero means coalescing is disabled.
+     *
+     * @see opio::net::tcp::connection_cfg_t::write_coalescing_delay().
+     */
+    std::uint32_t write_coalescing_delay_usec =
+        details::default_write_coalescing_delay_usec;
+
+    /**
+     * @brief Pending bytes that trigger write of coalesced data.
+     *
+     * @see opio::net::tcp::connection_cfg_t::write_coalescing_bytes().
+     */
+    std::uint32_t write_coalescing_bytes = details::default_write_coalescing_bytes;
+
+    /**
+     * @brief Pending buffers that trigger write of coalesced data.
+     *
+     * @see opio::net::tcp::connection_cfg_t::write_coalescing_buffers().
+     */
+    std::uint32_t write_coalescing_buffers =
+        details::default_write_coalescing_buffers;
+
+    /**
+     * @brief Whether to cork socket while coalesced data is written.
+     *
+     * @see opio::net::tcp::connection_cfg_t::write_coalescing_use_tcp_cork().
+     */
+    bool write_coalescing_use_tcp_cork =
+        details::default_write_coalescing_use_tcp_cork;
+
     [[nodiscard]] opio::net::tcp::connection_cfg_t make_underlying_connection_cfg()
         const noexcept
     {
@@ -147,6 +205,13 @@ struct entry_full_cfg_t
         res.input_buffer_size( input_buffer_size );
         res.write_timeout_per_1mb(
             std::chrono::milliseconds( write_timeout_per_1mb_msec ) );
+        res.zerocopy_send_threshold( zerocopy_send_threshold );
+        res.max_iov_per_write( max_iov_per_write );
+        res.write_coalescing_delay(
+            std::chrono::microseconds( write_coalescing_delay_usec ) );
+        res.write_coalescing_bytes( write_coalescing_bytes );
+        res.write_coalescing_buffers( write_coalescing_buffers );
+        res.write_coalescing_use_tcp_cork( write_coalescing_use_tcp_cork );
 
         return res;
     }
@@ -43,7 +43,31 @@ void json_io( Json_Io & io, opio::proto_entry::entry_full_cfg_t & cfg )
         & json_dto::optional(
             "write_timeout_per_1mb_msec",
             cfg.write_timeout_per_1mb_msec,
-            opio::proto_entry::details::default_write_timeout_per_1mb_msec );
+            opio::proto_entry::details::default_write_timeout_per_1mb_msec )
+        & json_dto::optional(
+            "zerocopy_send_threshold",
+            cfg.zerocopy_send_threshold,
+            opio::proto_entry::details::default_zerocopy_send_threshold )
+        & json_dto::optional(
+            "max_iov_per_write",
+            cfg.max_iov_per_write,
+            opio::proto_entry::details::default_max_iov_per_write )
+        & json_dto::optional(
+            "write_coalescing_delay_usec",
+            cfg.write_coalescing_delay_usec,
+            opio::proto_entry::details::default_write_coalescing_delay_usec )
+        & json_dto::optional(
+            "write_coalescing_bytes",
+            cfg.write_coalescing_bytes,
+            opio::proto_entry::details::default_write_coalescing_bytes )
+        & json_dto::optional(
+            "write_coalescing_buffers",
+            cfg.write_coalescing_buffers,
+            opio::proto_entry::details::default_write_coalescing_buffers )
+        & json_dto::optional(
+            "write_coalescing_use_tcp_cork",
+            cfg.write_coalescing_use_tcp_cork,
+            opio::proto_entry::details::default_write_coalescing_use_tcp_cork );
 }
 
 }  // namespace json_dto
@@ -6,12 +6,17 @@
 
 #include <opio/net/tcp/connection.hpp>
 #include <opio/net/heterogeneous_buffer.hpp>
+#include <opio/net/mirrored_ring_buffer.hpp>
+#include <opio/net/pooled_buffer.hpp>
+#include <opio/net/shared_buffer.hpp>
+#include <opio/net/spsc_buffers_queue.hpp>
 
 #include <opio/log.hpp>
 #include <opio/proto_entry/cfg.hpp>
 #include <opio/proto_entry/pkg_input.hpp>
 #include <opio/proto_entry/utils.hpp>
 #include <opio/proto_entry/message_carrier.hpp>
+#include <opio/proto_entry/raw_package.hpp>
 
 #include <opio/proto_entry/impl/protobuf_parsing_engines.hpp>
 
@@ -218,6 +223,80 @@ struct on_message_callback_support_ext_info : std::false_type
 {
 };
 
+//
+// message_consumer_ref
+//
+
+/**
+ * @brief Get the type of the eventual message consumer
+ *        (the one execute_for_reference() gives a reference to).
+ */
+template < typename Message_Consumer >
+struct message_consumer_ref
+{
+    using type = Message_Consumer;
+};
+
+template < typename Message_Consumer >
+struct message_consumer_ref< Message_Consumer * >
+{
+    using type = Message_Consumer;
+};
+
+template < typename Message_Consumer >
+struct message_consumer_ref< std::unique_ptr< Message_Consumer > >
+{
+    using type = Message_Consumer;
+};
+
+template < typename Message_Consumer >
+struct message_consumer_ref< std::shared_ptr< Message_Consumer > >
+{
+    using type = Message_Consumer;
+};
+
+template < typename Message_Consumer >
+struct message_consumer_ref< std::weak_ptr< Message_Consumer > >
+{
+    using type = Message_Consumer;
+};
+
+//
+// on_raw_package_callback_support
+//
+
+/**
+ * @brief Checks if a consumer takes packages of a given message type
+ *        unparsed.
+ *
+ * That is the consumer has `on_raw_package( header, raw_pkg, entry )`
+ * that accepts `const pkg_header_t &`, `raw_package_t< Message >`
+ * and `Entry &`.
+ */
+template < typename Consumer, typename Message, typename Entry, typename = void >
+struct on_raw_package_callback_support : std::false_type
+{
+};
+
+template < typename Consumer, typename Message, typename Entry >
+struct on_raw_package_callback_support<
+    Consumer,
+    Message,
+    Entry,
+    std::void_t< decltype( std::declval< Consumer & >().on_raw_package(
+        std::declval< const pkg_header_t & >(),
+        std::declval< raw_package_t< Message > >(),
+        std::declval< Entry & >() ) ) > > : std::true_type
+{
+};
+
+template < typename Message_Consumer, typename Message, typename Entry >
+inline constexpr bool on_raw_package_callback_support_v =
+    on_raw_package_callback_support<
+        typename message_consumer_ref< Message_Consumer >::type,
+        Message,
+        Entry >::value;
+
 //
 // consume_message()
 //
@@ -234,6 +313,24 @@ void consume_message( Message_Consumer & message_consumer,
         mc.on_message( std::move( message ), entry );
     } );
 }
+
+//
+// consume_raw_package()
+//
+
+/**
+ * @brief Call a consumer hook for an unparsed package.
+ */
+template < typename Message_Consumer, typename Message, typename Entry >
+void consume_raw_package( Message_Consumer & message_consumer,
+                          const pkg_header_t & header,
+                          raw_package_t< Message > pkg,
+                          Entry & entry )
+{
+    execute_for_reference( message_consumer, [ & ]( auto & mc ) {
+        mc.on_raw_package( header, std::move( pkg ), entry );
+    } );
+}
 ///@}
 
 }  // namespace details
@@ -732,11 +829,14 @@ private:
  *       as it is boring, repetitive and is very valnurable to copy paste
  *       errors.
  *
+ * @note Input buffers are reused in a ring fashion: once a buffer
+ *       is fully consumed by `m_pkg_input` it goes back to
+ *       underlying connection (see `recycled_input_buffers_t`)
+ *       to be used for one of the next read operations.
+ *
  * @todo Think of buffer reuse practice: comming input buffers can be
  *       stored to buffer-pool and later be used for carrying
- *       outpud data. The same mechanics can be achieved on
- *       the part of connection object, so that we may end up with
- *       some bunch of buffer reused in a ring fashion.
+ *       outpud data.
  */
 template < typename Traits >
 class entry_base_t : public std::enable_shared_from_this< entry_base_t< Traits > >
@@ -752,6 +852,14 @@ public:
     using buffer_driver_t = typename Traits::buffer_driver_t;
     static_assert( ::opio::net::Buffer_Driver_Concept< buffer_driver_t > );
 
+    // Entry keeps input buffers until packages are complete,
+    // so buffers that are valid only during a read can't be used.
+    static_assert(
+        !::opio::net::tcp::details::has_transient_input_buffers_v<
+            buffer_driver_t >,
+        "input buffers must outlive a read "
+        "(e.g. scratch_input_buffer_driver_t can't be used with entry)" );
+
     using underlying_stats_driver_t = typename Traits::underlying_stats_driver_t;
 
     using strand_t = typename Traits::strand_t;
@@ -766,6 +874,19 @@ public:
     template < typename Message >
     using message_carrier_t = protobuf_engine_t< Message >::message_carrier_t;
 
+    /**
+     * @brief A channel to return input buffers consumed by the entry
+     *        back to underlying connection.
+     *
+     * Entry (on its strand) is the only producer and
+     * connection (on its strand) is the only consumer,
+     * so a lock-free spsc queue fits well.
+     */
+    using recycled_input_buffers_t = opio::net::spsc_buffers_queue_t<
+        typename buffer_driver_t::input_buffer_t >;
+    using recycled_input_buffers_sptr_t =
+        std::shared_ptr< recycled_input_buffers_t >;
+
     /**
      * @brief The handler of input supplied by
      *        underlying connection.
@@ -775,9 +896,13 @@ public:
     class raw_bytes_handler_t
     {
     public:
-        raw_bytes_handler_t( strand_t strand, weak_ptr_t entry )
+        raw_bytes_handler_t(
+            strand_t strand,
+            weak_ptr_t entry,
+            recycled_input_buffers_sptr_t recycled_input_buffers = {} )
             : m_strand{ std::move( strand ) }
             , m_entry{ std::move( entry ) }
+            , m_recycled_input_buffers{ std::move( recycled_input_buffers ) }
         {
         }
 
@@ -787,9 +912,6 @@ public:
         template < typename Input_Context >
         void operator()( Input_Context & ctx )
         {
-            const auto input_buffer_size =
-                buffer_driver_t::make_asio_const_buffer( ctx.buf() ).size();
-
             opio::net::asio_ns::dispatch(
                 m_strand,
                 [ buf = std::move( ctx.buf() ), entry_wp = m_entry ]() mutable {
@@ -800,64 +922,20 @@ public:
                     }
                 } );
 
-            const auto confugured_buf_size =
-                ctx.connection().cfg().input_buffer_size();
-            const auto read_buf_was_fully_utilized =
-                latest_explicitly_allocated_read_buf_size ?
-                    // If the latest read buffer was allocated explicitly
-                    // we check with the allocated size.
-                    latest_explicitly_allocated_read_buf_size == input_buffer_size
-                    // if no, then we should compare to connection
-                    // configured read buffer size
-                    :
-                    confugured_buf_size == input_buffer_size;
-
-            // That is a hard max of what we read in one go.
-            constexpr std::size_t size_buf_32mb = 32 * 1024 * 1024;
-
-            if( read_buf_was_fully_utilized )
-            {
-                // We have a case the whole buffer
-                // used for read operation was used,
-                // so it makes sense to use a larger buffer
-                // for next read operation.
+            // The size of the next read buffer is decided by
+            // underlying connection's read size policy
+            // (see underlying_connection_traits_t::read_size_policy_t).
+            auto recycled_buf = m_recycled_input_buffers
+                                    ? m_recycled_input_buffers->try_pop()
+                                    : std::nullopt;
 
-                latest_explicitly_allocated_read_buf_size =
-                    std::min( input_buffer_size * 2, size_buf_32mb );
-            }
-            else if( confugured_buf_size <= input_buffer_size )
-            {
-                // So we didn't utilze all buf capacity (using adjusted size)
-                // but it is still smth. that is more than
-                // a configured (default) size of a read buffer
-                // connection operated with.
-                // So we need to find a proper value for the next buffer size.
-
-                // TODO: that can be optimized, for now
-                //       it is just a simple approach that works.
-                latest_explicitly_allocated_read_buf_size =
-                    confugured_buf_size * 2;
-
-                while( latest_explicitly_allocated_read_buf_size
-                       < input_buffer_size )
-                {
-                    latest_explicitly_allocated_read_buf_size *= 2;
-                    assert( latest_explicitly_allocated_read_buf_size
-                            <= size_buf_32mb );
-                }
-            }
-            else
-            {
-                // If we are here it means that for current chunk size
-                // a defult connection buffer size is enaugh.
-                latest_explicitly_allocated_read_buf_size = 0;
-            }
-
-            if( latest_explicitly_allocated_read_buf_size )
+            if( recycled_buf )
             {
+                // Entry has consumed some buffer already
+                // so we can reuse it instead of allocating a new one.
                 ctx.next_read_buffer(
-                    ctx.connection().buffer_driver().allocate_input(
-                        latest_explicitly_allocated_read_buf_size ) );
+                    ctx.connection().buffer_driver().reallocate_input(
+                        std::move( *recycled_buf ), ctx.next_read_size() ) );
             }
         }
 
@@ -866,15 +944,9 @@ public:
         weak_ptr_t m_entry;
 
         /**
-         * @brief What was the size of the latest explicitly alocated buffer
-         *        for read operation.
-         *
-         * This is used to adjust the size of read buf in case
-         * we observe that the read buffer is fully utilized.
-         * In that case we start growing the input buffer
-         * so that we can read more in one go.
+         * @brief Input buffers consumed by the entry (optional).
          */
-        std::size_t latest_explicitly_allocated_read_buf_size{};
+        recycled_input_buffers_sptr_t m_recycled_input_buffers;
     };
 
     /**
@@ -891,6 +963,13 @@ public:
         using stats_driver_t       = underlying_stats_driver_t;
         using input_handler_t      = raw_bytes_handler_t;
         using locking_t            = typename Traits::locking_t;
+
+        /**
+         * Entry consumes streams of packages of any size,
+         * so read buffers grow when a burst of data comes
+         * and shrink back when it is over.
+         */
+        using read_size_policy_t = opio::net::tcp::adaptive_read_size_policy_t;
     };
 
     using underlying_connection_t =
@@ -920,6 +999,8 @@ protected:
         , m_logger{ std::move( logger ) }
         , m_buffer_driver{ std::move( buffer_driver ) }
         , m_cfg{ cfg }
+        , m_recycled_input_buffers{ std::make_shared< recycled_input_buffers_t >() }
+        , m_pkg_input{ input_buffer_recycler_t{ m_recycled_input_buffers.get() } }
         , m_shutdown_handler{ std::move( shutdown_handler ) }
         , m_heartbeat_timer{ m_strand }
     {
@@ -953,7 +1034,8 @@ protected:
             underlying_cfg,
             m_logger,
             m_buffer_driver,
-            raw_bytes_handler_t{ m_strand, this->weak_from_this() },
+            raw_bytes_handler_t{
+                m_strand, this->weak_from_this(), m_recycled_input_buffers },
             [ wp = this->weak_from_this(), s = m_strand ]( auto reason ) {
                 if( auto entry = wp.lock(); entry )
                 {
@@ -1260,6 +1342,84 @@ protected:
         }
     }
 
+    /**
+     * @brief Read a given number of bytes as a slice.
+     *
+     * The slice refers the input data in place whenever it lies
+     * in a single input buffer, otherwise the data is copied.
+     *
+     * @param stream  Input stream.
+     * @param n       The number of bytes to read.
+     */
+    [[nodiscard]] static ::opio::net::shared_buffer_slice_t read_slice(
+        pkg_input_base_t & stream,
+        std::size_t n )
+    {
+        if( auto slice = stream.read_shared_slice( n ); slice ) [[likely]]
+        {
+            return std::move( *slice );
+        }
+
+        // The data spans several buffers.
+        ::opio::net::shared_buffer_t buf{ n };
+        stream.read_buffer( buf.data(), buf.size() );
+        return buf.make_slice( 0, n );
+    }
+
+    /**
+     * @brief Parse a package content with an engine that pins its input.
+     *
+     * The content is read with read_slice(), so input buffers
+     * must be sliceable not to copy every package.
+     *
+     * @tparam Protobuf_Engine  Parsing engine (`pins_input == true`).
+     *
+     * @param stream  Input stream positioned at package content.
+     * @param n       The size of package content.
+     */
+    template < typename Protobuf_Engine >
+    [[nodiscard]] static auto parse_pinned_package( pkg_input_base_t & stream,
+                                                    std::size_t n )
+    {
+        static_assert( Protobuf_Engine::pins_input );
+        static_assert(
+            Sliceable_Buffer_Concept< typename buffer_driver_t::input_buffer_t >,
+            "aliasing parsing strategy requires input buffers "
+            "that can be sliced (e.g. shared or pooled buffers traits)" );
+
+        return Protobuf_Engine::parse_package( read_slice( stream, n ) );
+    }
+
+    /**
+     * @brief Read a binary attached to a message.
+     *
+     * If an attached binary is a slice (net::shared_buffer_slice_t)
+     * then it is read with read_slice().
+     *
+     * @tparam Attached_Buffer  The type of attached binary of
+     *                          a message carrier.
+     *
+     * @param stream  Input stream positioned at attached binary.
+     * @param n       The size of attached binary.
+     */
+    template < typename Attached_Buffer >
+    [[nodiscard]] static Attached_Buffer read_attached_buffer(
+        pkg_input_base_t & stream,
+        std::size_t n )
+    {
+        if constexpr( std::is_same_v< Attached_Buffer,
+                                      ::opio::net::shared_buffer_slice_t > )
+        {
+            return read_slice( stream, n );
+        }
+        else
+        {
+            Attached_Buffer buf{ n };
+            stream.read_buffer( buf.data(), buf.size() );
+            return buf;
+        }
+    }
+
     /**
      * @brief Shutdown socket and terminate session.
      */
@@ -1791,6 +1951,27 @@ private:
      */
     const entry_cfg_t m_cfg;
 
+    /**
+     * @brief Input buffers consumed by the entry
+     *        which are to be reused by underlying connection.
+     */
+    recycled_input_buffers_sptr_t m_recycled_input_buffers;
+
+    /**
+     * @brief Passes consumed buffers of `m_pkg_input`
+     *        to `m_recycled_input_buffers`.
+     */
+    struct input_buffer_recycler_t
+    {
+        void operator()( input_buffer_t & buf ) noexcept
+        {
+            // If queue is full buffer is simply left in place.
+            recycled_buffers->try_push( buf );
+        }
+
+        recycled_input_buffers_t * recycled_buffers;
+    };
+
     /**
      * @brief An input stream for reading packages.
      *
@@ -1798,7 +1979,10 @@ private:
      * to either read package headers or to Parse protobuf messages.
      * It cares about delimited buffers handling automatically.
      */
-    pkg_input_t<> m_pkg_input;
+    pkg_input_t< input_buffer_t,
+                 8,  // Buffer_Queue_Capacity
+                 input_buffer_recycler_t >
+        m_pkg_input;
 
     shutdown_handler_variant_t m_shutdown_handler;
 
@@ -1883,6 +2067,169 @@ struct multithread_traits_base_t
     using strand_t                       = opio::net::tcp::real_strand_t;
     using buffer_driver_t = opio::net::heterogeneous_buffer_driver_t;
 };
+
+/**
+ * @brief Single thread traits that use pooled buffers.
+ *
+ * Input buffers and buffers allocated by entry itself (package images)
+ * are taken from a pool, outgoing attached binaries
+ * can still be of different origin.
+ *
+ * Pooled buffers are reference counted, so incoming attached binaries
+ * are slices (opio::net::shared_buffer_slice_t) referring input buffers.
+ *
+ * @see opio::net::pooled_heterogeneous_buffer_driver_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct singlethread_pooled_buffers_traits_base_t
+    : public singlethread_traits_base_t< Stats_Driver,
+                                         Logger,
+                                         Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::pooled_heterogeneous_buffer_driver_t;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::shared_buffer_slice_t >;
+};
+
+/**
+ * @brief Multi thread traits that use pooled buffers.
+ *
+ * @see singlethread_pooled_buffers_traits_base_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct multithread_pooled_buffers_traits_base_t
+    : public multithread_traits_base_t< Stats_Driver,
+                                        Logger,
+                                        Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::pooled_heterogeneous_buffer_driver_t;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::shared_buffer_slice_t >;
+};
+
+/**
+ * @brief Single thread traits that read input into shared buffers.
+ *
+ * Incoming attached binaries are slices
+ * (opio::net::shared_buffer_slice_t) referring input buffers in place
+ * (unless an attached binary spans several input buffers),
+ * so large binaries are not copied.
+ *
+ * @see opio::net::shared_buffer_driver_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct singlethread_shared_input_buffers_traits_base_t
+    : public singlethread_traits_base_t< Stats_Driver,
+                                         Logger,
+                                         Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::shared_buffer_driver_t;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::shared_buffer_slice_t >;
+};
+
+/**
+ * @brief Multi thread traits that read input into shared buffers.
+ *
+ * @see singlethread_shared_input_buffers_traits_base_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct multithread_shared_input_buffers_traits_base_t
+    : public multithread_traits_base_t< Stats_Driver,
+                                        Logger,
+                                        Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::shared_buffer_driver_t;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::shared_buffer_slice_t >;
+};
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+/**
+ * @brief Single thread traits that read input into a mirror-mapped ring.
+ *
+ * Packages are always contiguous in memory (given that ring fits them),
+ * buffers allocated by entry itself are taken from a pool.
+ *
+ * Ring space is reused strictly in order, so a long-lived attached binary
+ * referring the ring would hold all the space after it. That is why
+ * incoming attached binaries are copied into opio::net::simple_buffer_t.
+ *
+ * @see opio::net::mirrored_ring_input_buffer_driver_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct singlethread_mirrored_ring_input_traits_base_t
+    : public singlethread_traits_base_t< Stats_Driver,
+                                         Logger,
+                                         Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::mirrored_ring_input_buffer_driver_t<
+        opio::net::pooled_heterogeneous_buffer_driver_t >;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::simple_buffer_t >;
+};
+
+/**
+ * @brief Multi thread traits that read input into a mirror-mapped ring.
+ *
+ * @see singlethread_mirrored_ring_input_traits_base_t.
+ */
+template < typename Stats_Driver,
+           typename Logger,
+           protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+               protobuf_parsing_strategy::trivial >
+struct multithread_mirrored_ring_input_traits_base_t
+    : public multithread_traits_base_t< Stats_Driver,
+                                        Logger,
+                                        Protobuf_Parsing_Strategy >
+{
+    using buffer_driver_t = opio::net::mirrored_ring_input_buffer_driver_t<
+        opio::net::pooled_heterogeneous_buffer_driver_t >;
+
+    template < typename Message >
+    using protobuf_parsing_engine_t =
+        impl::protobuf_parsing_engine_t< Protobuf_Parsing_Strategy,
+                                         Message,
+                                         opio::net::simple_buffer_t >;
+};
+
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
 /// @}
 
 }  // namespace opio::proto_entry
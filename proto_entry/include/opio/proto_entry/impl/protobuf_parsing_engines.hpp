@@ -6,15 +6,43 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
+#include <span>
 
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/message_lite.h>
+
+// Parsing from absl::Cord is available since protobuf v22.
+#if GOOGLE_PROTOBUF_VERSION >= 4022000
+#    define OPIO_PROTO_ENTRY_HAS_CORD_PARSING
+#    include <absl/strings/cord.h>
+#endif
+
+#include <opio/net/shared_buffer.hpp>
 
 #include <opio/proto_entry/message_carrier.hpp>
 
 namespace opio::proto_entry::impl
 {
 
+//
+// has_cord_parsing_v
+//
+
+/**
+ * @brief Whether protobuf can parse a given message from absl::Cord.
+ *
+ * Is a template, so a check on it fails only for a code that uses it.
+ */
+template < typename Message >
+inline constexpr bool has_cord_parsing_v =
+#if defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+    true;
+#else
+    false;
+#endif
+
 //
 // common_protobuf_parsing_engine_t
 //
@@ -30,6 +58,12 @@ public:
 
     using message_carrier_t = typename parse_results_t::message_carrier_t;
 
+    /**
+     * @brief Whether the engine must be given the package content
+     *        as a slice it can pin.
+     */
+    static constexpr bool pins_input = false;
+
     [[nodiscard]] static std::optional< parse_results_t > parse_package(
         google::protobuf::io::ZeroCopyInputStream & input )
     {
@@ -42,6 +76,27 @@ public:
 
         return res;
     }
+
+    /**
+     * @brief Parse a message from a contiguous chunk of memory.
+     *
+     * A fast path for a message lying in a single input buffer:
+     * no zero-copy stream wrappers are involved.
+     */
+    [[nodiscard]] static std::optional< parse_results_t > parse_package(
+        std::span< const std::byte > input )
+    {
+        std::optional< parse_results_t > res{ parse_results_t{} };
+
+        if( !res->message().ParseFromArray( input.data(),
+                                            static_cast< int >( input.size() ) ) )
+            [[unlikely]]
+        {
+            res = std::nullopt;
+        }
+
+        return res;
+    }
 };
 
 //
@@ -51,10 +106,11 @@ public:
 /**
  * @brief Parse result for case of trivial parse strategy.
  */
-template < typename Message >
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
 struct protobuf_trivial_parse_results_t
 {
-    using message_carrier_t = trivial_proxy_message_carrier_t< Message >;
+    using message_carrier_t =
+        trivial_proxy_message_carrier_t< Message, Attached_Buffer >;
 
     [[nodiscard]] message_carrier_t carry_message()
     {
@@ -62,7 +118,7 @@ struct protobuf_trivial_parse_results_t
     }
 
     [[nodiscard]] message_carrier_t carry_message(
-        net::simple_buffer_t && attached_buf )
+        Attached_Buffer && attached_buf )
     {
         return message_carrier_t{ std::move( m_message ),
                                   std::move( attached_buf ) };
@@ -78,9 +134,9 @@ private:
 // protobuf_trivial_parsing_engine_t
 //
 
-template < typename Message >
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
 using protobuf_trivial_parsing_engine_t = common_protobuf_parsing_engine_t<
-    protobuf_trivial_parse_results_t< Message > >;
+    protobuf_trivial_parse_results_t< Message, Attached_Buffer > >;
 
 //
 // protobuf_with_arena_parse_results_t
@@ -89,10 +145,13 @@ using protobuf_trivial_parsing_engine_t = common_protobuf_parsing_engine_t<
 /**
  * @brief Parse result for case of trivial parse strategy.
  */
-template < typename Message, std::size_t Block_Size = 4 * 1024 >
+template < typename Message,
+           std::size_t Block_Size    = 4 * 1024,
+           typename Attached_Buffer = net::simple_buffer_t >
 struct protobuf_with_arena_parse_results_t
 {
-    using message_carrier_t = with_arena_message_carrier_t< Message >;
+    using message_carrier_t =
+        with_arena_message_carrier_t< Message, Attached_Buffer >;
 
     [[nodiscard]] message_carrier_t carry_message()
     {
@@ -101,7 +160,7 @@ struct protobuf_with_arena_parse_results_t
     }
 
     [[nodiscard]] message_carrier_t carry_message(
-        net::simple_buffer_t && attached_buf )
+        Attached_Buffer && attached_buf )
     {
         assert( m_arena );
         return message_carrier_t{ m_message,
@@ -136,9 +195,116 @@ private:
 // protobuf_with_arena_parsing_engine_t
 //
 
-template < typename Message >
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
 using protobuf_with_arena_parsing_engine_t = common_protobuf_parsing_engine_t<
-    protobuf_with_arena_parse_results_t< Message > >;
+    protobuf_with_arena_parse_results_t< Message, 4 * 1024, Attached_Buffer > >;
+
+//
+// protobuf_aliasing_parse_results_t
+//
+
+/**
+ * @brief Parse result for case of aliasing parse strategy.
+ */
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
+struct protobuf_aliasing_parse_results_t
+{
+    using message_carrier_t =
+        aliasing_message_carrier_t< Message, Attached_Buffer >;
+
+    [[nodiscard]] message_carrier_t carry_message()
+    {
+        return message_carrier_t{ std::move( m_message ),
+                                  std::move( m_pinned_input ) };
+    }
+
+    [[nodiscard]] message_carrier_t carry_message(
+        Attached_Buffer && attached_buf )
+    {
+        return message_carrier_t{ std::move( m_message ),
+                                  std::move( m_pinned_input ),
+                                  std::move( attached_buf ) };
+    }
+
+    [[nodiscard]] Message & message() noexcept { return m_message; }
+
+    /**
+     * @brief Pin the input the message was parsed from.
+     */
+    void pin_input( net::shared_buffer_slice_t input ) noexcept
+    {
+        m_pinned_input = std::move( input );
+    }
+
+private:
+    Message m_message;
+    net::shared_buffer_slice_t m_pinned_input;
+};
+
+//
+// protobuf_aliasing_parsing_engine_t
+//
+
+/**
+ * @brief Parsing engine that lets a message refer to its input.
+ *
+ * Parses a message from a package content given as a slice
+ * and pins the slice in the message carrier.
+ * The message is parsed from absl::Cord that refers to the slice,
+ * so bytes fields declared with `[ctype = CORD]` share the input
+ * instead of copying it. Requires protobuf v22+.
+ *
+ * Generic overloads of parse_package() (inherited) don't pin anything.
+ */
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
+class protobuf_aliasing_parsing_engine_t
+    : public common_protobuf_parsing_engine_t<
+          protobuf_aliasing_parse_results_t< Message, Attached_Buffer > >
+{
+    using base_type_t = common_protobuf_parsing_engine_t<
+        protobuf_aliasing_parse_results_t< Message, Attached_Buffer > >;
+
+    static_assert( has_cord_parsing_v< Message >,
+                   "aliasing parsing strategy requires protobuf v22+ "
+                   "(parsing from absl::Cord)" );
+
+public:
+    using typename base_type_t::message_carrier_t;
+    using typename base_type_t::parse_results_t;
+
+    static constexpr bool pins_input = true;
+
+    using base_type_t::parse_package;
+
+    /**
+     * @brief Parse a message from a package content and pin it.
+     */
+    [[nodiscard]] static std::optional< parse_results_t > parse_package(
+        [[maybe_unused]] net::shared_buffer_slice_t input )
+    {
+        std::optional< parse_results_t > res{ parse_results_t{} };
+
+#if defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+        // The releaser holds a copy of the slice,
+        // so cord fields remain valid on their own.
+        const auto content = absl::MakeCordFromExternal(
+            absl::string_view{ reinterpret_cast< const char * >( input.data() ),
+                               input.size() },
+            [ pin = input ]( absl::string_view ) {} );
+
+        if( !res->message().ParseFromCord( content ) ) [[unlikely]]
+        {
+            res = std::nullopt;
+        }
+        else
+        {
+            res->pin_input( std::move( input ) );
+        }
+#endif  // defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+
+        return res;
+    }
+};
 
 //
 // protobuf_parsing_engine_lut
@@ -152,19 +318,28 @@ struct protobuf_parsing_engine_lut
 template <>
 struct protobuf_parsing_engine_lut< protobuf_parsing_strategy::trivial >
 {
-    template < typename Message >
-    using type = protobuf_trivial_parsing_engine_t< Message >;
+    template < typename Message, typename Attached_Buffer >
+    using type = protobuf_trivial_parsing_engine_t< Message, Attached_Buffer >;
 };
 
 template <>
 struct protobuf_parsing_engine_lut< protobuf_parsing_strategy::with_arena >
 {
-    template < typename Message >
-    using type = protobuf_with_arena_parsing_engine_t< Message >;
+    template < typename Message, typename Attached_Buffer >
+    using type = protobuf_with_arena_parsing_engine_t< Message, Attached_Buffer >;
+};
+
+template <>
+struct protobuf_parsing_engine_lut< protobuf_parsing_strategy::aliasing >
+{
+    template < typename Message, typename Attached_Buffer >
+    using type = protobuf_aliasing_parsing_engine_t< Message, Attached_Buffer >;
 };
 
-template < protobuf_parsing_strategy Protobuf_Parsing_Strategy, typename Message >
+template < protobuf_parsing_strategy Protobuf_Parsing_Strategy,
+           typename Message,
+           typename Attached_Buffer = net::simple_buffer_t >
 using protobuf_parsing_engine_t = typename protobuf_parsing_engine_lut<
-    Protobuf_Parsing_Strategy >::template type< Message >;
+    Protobuf_Parsing_Strategy >::template type< Message, Attached_Buffer >;
 
 }  // namespace opio::proto_entry::impl
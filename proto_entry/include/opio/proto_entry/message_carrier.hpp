@@ -3,6 +3,7 @@
 #include <google/protobuf/arena.h>
 
 #include <opio/net/buffer.hpp>
+#include <opio/net/shared_buffer.hpp>
 
 #include <opio/proto_entry/pkg_header.hpp>
 
@@ -20,12 +21,17 @@ namespace opio::proto_entry
  * Provides a `unique_ptr<M>` like interface to a protobuf message.
  * Which acts as unified interface for arena allocated protobuf messages
  * and heap-allocated messages.
+ *
+ * @tparam Attached_Buffer  The type of a binary attached to the message
+ *                          (net::simple_buffer_t or
+ *                          net::shared_buffer_slice_t).
  */
-template < typename Message >
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
 class trivial_proxy_message_carrier_t
 {
 public:
-    using message_t = Message;
+    using message_t         = Message;
+    using attached_buffer_t = Attached_Buffer;
 
     /**
      * @brief Create an instance of trivial message with
@@ -47,7 +53,7 @@ public:
      */
     explicit trivial_proxy_message_carrier_t(
         message_t && msg,
-        net::simple_buffer_t && attached_buffer )
+        attached_buffer_t && attached_buffer )
         : m_message( std::move( msg ) )
         , m_attached_buffer{ std::move( attached_buffer ) }
     {
@@ -75,18 +81,18 @@ public:
     [[nodiscard]] message_t * operator->() noexcept { return get(); }
     [[nodiscard]] const message_t * operator->() const noexcept { return get(); }
 
-    [[nodiscard]] net::simple_buffer_t & attached_buffer() noexcept
+    [[nodiscard]] attached_buffer_t & attached_buffer() noexcept
     {
         return m_attached_buffer;
     }
-    [[nodiscard]] const net::simple_buffer_t & attached_buffer() const noexcept
+    [[nodiscard]] const attached_buffer_t & attached_buffer() const noexcept
     {
         return m_attached_buffer;
     }
 
 private:
     Message m_message;
-    net::simple_buffer_t m_attached_buffer;
+    attached_buffer_t m_attached_buffer;
 };
 
 //
@@ -100,13 +106,18 @@ private:
  * Which acts as unified interface for arena allocated protobuf messages
  * and heap-allocated messages.
  *
+ * @tparam Attached_Buffer  The type of a binary attached to the message
+ *                          (net::simple_buffer_t or
+ *                          net::shared_buffer_slice_t).
+ *
  * @since v0.11.0
  */
-template < typename Message >
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
 class with_arena_message_carrier_t
 {
 public:
-    using message_t = Message;
+    using message_t         = Message;
+    using attached_buffer_t = Attached_Buffer;
 
     /**
      * @brief Create an instance of arena-backed message with
@@ -136,7 +147,7 @@ public:
     explicit with_arena_message_carrier_t(
         message_t * msg,
         std::unique_ptr< google::protobuf::Arena > arena_anchor,
-        net::simple_buffer_t && attached_buffer )
+        attached_buffer_t && attached_buffer )
         : m_message( msg )
         , m_arena_anchor{ std::move( arena_anchor ) }
         , m_attached_buffer{ std::move( attached_buffer ) }
@@ -174,11 +185,11 @@ public:
     [[nodiscard]] message_t * operator->() noexcept { return get(); }
     [[nodiscard]] const message_t * operator->() const noexcept { return get(); }
 
-    [[nodiscard]] net::simple_buffer_t & attached_buffer() noexcept
+    [[nodiscard]] attached_buffer_t & attached_buffer() noexcept
     {
         return m_attached_buffer;
     }
-    [[nodiscard]] const net::simple_buffer_t & attached_buffer() const noexcept
+    [[nodiscard]] const attached_buffer_t & attached_buffer() const noexcept
     {
         return m_attached_buffer;
     }
@@ -186,7 +197,108 @@ public:
 private:
     Message * m_message;
     std::unique_ptr< google::protobuf::Arena > m_arena_anchor;
-    net::simple_buffer_t m_attached_buffer;
+    attached_buffer_t m_attached_buffer;
+};
+
+//
+// aliasing_message_carrier_t
+//
+
+/**
+ * @brief A class that carries a protobuf message along with
+ *        the input it was parsed from.
+ *
+ * The content of the package the message was parsed from is pinned
+ * by the carrier, so it is safe to refer to it while the carrier is alive
+ * (see pinned_input()). Bytes fields declared with `[ctype = CORD]`
+ * refer to the input in place and hold it on their own.
+ *
+ * @tparam Attached_Buffer  The type of a binary attached to the message
+ *                          (net::simple_buffer_t or
+ *                          net::shared_buffer_slice_t).
+ */
+template < typename Message, typename Attached_Buffer = net::simple_buffer_t >
+class aliasing_message_carrier_t
+{
+public:
+    using message_t         = Message;
+    using attached_buffer_t = Attached_Buffer;
+
+    /**
+     * @brief Create an instance of a message pinning its input.
+     *
+     * @param  msg           A rvalue ref to a message to carry.
+     * @param  pinned_input  The content of a package the message
+     *                       was parsed from.
+     */
+    aliasing_message_carrier_t( message_t && msg,
+                                net::shared_buffer_slice_t pinned_input )
+        : m_message( std::move( msg ) )
+        , m_pinned_input{ std::move( pinned_input ) }
+    {
+    }
+
+    /**
+     * @brief Create an instance of a message pinning its input.
+     *
+     * @param  msg              A rvalue ref to a message to carry.
+     * @param  pinned_input     The content of a package the message
+     *                          was parsed from.
+     * @param  attached_buffer  A bufer complementing the message.
+     */
+    aliasing_message_carrier_t( message_t && msg,
+                                net::shared_buffer_slice_t pinned_input,
+                                attached_buffer_t && attached_buffer )
+        : m_message( std::move( msg ) )
+        , m_pinned_input{ std::move( pinned_input ) }
+        , m_attached_buffer{ std::move( attached_buffer ) }
+    {
+    }
+
+    aliasing_message_carrier_t( const aliasing_message_carrier_t & ) = delete;
+    aliasing_message_carrier_t & operator=( const aliasing_message_carrier_t & ) =
+        delete;
+
+    aliasing_message_carrier_t( aliasing_message_carrier_t && ) = default;
+    aliasing_message_carrier_t & operator=( aliasing_message_carrier_t && ) =
+        default;
+
+    [[nodiscard]] message_t * get() noexcept { return &m_message; }
+    [[nodiscard]] const message_t * get() const noexcept
+    {
+        return const_cast< aliasing_message_carrier_t * >( this )->get();
+    }
+
+    [[nodiscard]] message_t & operator*() noexcept { return *get(); }
+    [[nodiscard]] const message_t & operator*() const noexcept { return *get(); }
+
+    [[nodiscard]] message_t * operator->() noexcept { return get(); }
+    [[nodiscard]] const message_t * operator->() const noexcept { return get(); }
+
+    [[nodiscard]] attached_buffer_t & attached_buffer() noexcept
+    {
+        return m_attached_buffer;
+    }
+    [[nodiscard]] const attached_buffer_t & attached_buffer() const noexcept
+    {
+        return m_attached_buffer;
+    }
+
+    /**
+     * @brief Get the content of the package the message was parsed from.
+     *
+     * Can be used to access raw bytes of the message without a copy
+     * (e.g. make a slice to keep a part of it beyond the carrier).
+     */
+    [[nodiscard]] const net::shared_buffer_slice_t & pinned_input() const noexcept
+    {
+        return m_pinned_input;
+    }
+
+private:
+    Message m_message;
+    net::shared_buffer_slice_t m_pinned_input;
+    attached_buffer_t m_attached_buffer;
 };
 
 //
@@ -205,7 +317,17 @@ enum class protobuf_parsing_strategy
     /**
      * Parsing to a message with allocations on arena.
      */
-    with_arena
+    with_arena,
+    /**
+     * Parsing to a message that pins the input it was parsed from.
+     *
+     * Bytes fields declared with `[ctype = CORD]` refer to the input
+     * in place instead of being copied. Requires protobuf v22+
+     * and input buffers that can be sliced (see shared and pooled
+     * buffers traits). The package content is copied once to be pinned
+     * only if it spans several input buffers.
+     */
+    aliasing
 };
 
 }  // namespace opio::proto_entry
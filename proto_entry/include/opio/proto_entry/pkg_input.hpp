@@ -1,10 +1,17 @@
 #pragma once
 
 #include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
 
 #include <google/protobuf/io/zero_copy_stream.h>
 
 #include <opio/net/buffer.hpp>
+#include <opio/net/shared_buffer.hpp>
 #include <opio/proto_entry/pkg_header.hpp>
 
 namespace opio::proto_entry
@@ -37,6 +44,116 @@ public:
      * @post The data is consumed from stream.
      */
     virtual void read_buffer( void * buffer, std::size_t size ) = 0;
+
+    /**
+     * @brief Get a view of the first n bytes of the stream
+     *        if they lie in a single buffer.
+     *
+     * Allows parsing a message right from the buffer
+     * (e.g. with `ParseFromArray()`) when it is not split between buffers.
+     * The data is not consumed.
+     *
+     * @pre Stream must have at least n bytes.
+     * @pre A ZCBuf interface function `Next()` should not be
+     *      called imeidatly before this.
+     *
+     * @return A view of the data or nullopt if the data spans several buffers.
+     */
+    [[nodiscard]] virtual std::optional< std::span< const std::byte > >
+    view_contiguous( std::size_t n ) const noexcept = 0;
+
+    /**
+     * @brief Reads n bytes as a slice referring the data in place
+     *        if it is possible.
+     *
+     * It is possible if buffers are sliceable
+     * (see Sliceable_Buffer_Concept) and the data lies in a single buffer.
+     * Only in that case the data is consumed.
+     *
+     * @pre Stream must have at least n bytes.
+     * @pre A ZCBuf interface function `Next()` should not be
+     *      called imeidatly before this.
+     *
+     * @return A slice of the data or nullopt.
+     */
+    [[nodiscard]] virtual std::optional< net::shared_buffer_slice_t >
+    read_shared_slice( std::size_t n ) = 0;
+};
+
+//
+// noop_buffer_recycler_t
+//
+
+/**
+ * @brief Default recycler of consumed buffers for pkg_input_t.
+ *
+ * Leaves consumed buffers in place.
+ */
+struct noop_buffer_recycler_t
+{
+    template < typename Buffer >
+    void operator()( [[maybe_unused]] Buffer & buf ) const noexcept
+    {
+    }
+};
+
+//
+// Mergeable_Buffer_Concept
+//
+
+/**
+ * @brief A buffer that can absorb a buffer which data follows
+ *        its own data in memory (e.g. opio::net::mirrored_ring_buffer_t).
+ *
+ * `a.try_merge(b)` returns true if b was appended to a (b is emptied).
+ */
+template < typename Buffer >
+concept Mergeable_Buffer_Concept = requires( Buffer & a, Buffer & b )
+{
+    {
+        a.try_merge( b )
+    }
+    ->std::same_as< bool >;
+};
+
+//
+// Consumable_Buffer_Concept
+//
+
+/**
+ * @brief A buffer that can drop the consumed beginning of its data
+ *        (e.g. opio::net::mirrored_ring_buffer_t).
+ *
+ * `a.consume(n)` drops the first n bytes of a buffer, so the resources
+ * they occupy are given back before the whole buffer is consumed.
+ * It matters for mergeable buffers: with steady input the last buffer
+ * keeps absorbing the next data and might be never consumed entirely.
+ */
+template < typename Buffer >
+concept Consumable_Buffer_Concept = requires( Buffer & a, std::size_t n )
+{
+    a.consume( n );
+};
+
+//
+// Sliceable_Buffer_Concept
+//
+
+/**
+ * @brief A buffer which memory has shared ownership,
+ *        so a part of it can be referred by a slice
+ *        (e.g. opio::net::shared_buffer_t).
+ *
+ * `a.make_slice(offset, n)` returns a slice of n bytes starting at offset.
+ */
+template < typename Buffer >
+concept Sliceable_Buffer_Concept =
+    requires( const Buffer & a, std::size_t offset, std::size_t n )
+{
+    {
+        a.make_slice( offset, n )
+    }
+    ->std::same_as< net::shared_buffer_slice_t >;
 };
 
 //
@@ -47,21 +164,46 @@ public:
  * @brief A class helping with reading packages (header+message)
  *        from a sequence of buffer.
  *
- * @tparam Buffer_Queue_Capacity  Capacity of the queue of buffers.
- *                                It is better to use the power of 2 values.
+ * @tparam Buffer_Queue_Capacity  Inline capacity of the queue of buffers.
+ *                                If more buffers are queued the queue
+ *                                spills to the heap (and keeps growing
+ *                                twice as needed).
+ * @tparam Buffer_Recycler        A callable `void(Buffer&)` which receives
+ *                                every fully consumed buffer and may take it
+ *                                (move it out) for reuse.
  *
  * Incapsulates the mechanics of handling stream of data
  * splitted into multiple buffers.
  *
  * Always keeps an instance of protobuf zero-copy stream
  * that represents entire buffer.
+ *
+ * If buffers are mergeable (see Mergeable_Buffer_Concept) then
+ * a buffer which data goes right after the data of the last buffer
+ * extends the last buffer, so such input is seen as a single
+ * contiguous chunk.
+ *
+ * Appending a buffer never copies its data: if the queue is full
+ * it grows (only buffer objects are moved to a new storage),
+ * so a large package delivered in many reads costs O(1) per read.
  */
 template < typename Buffer                   = opio::net::simple_buffer_t,
-           std::size_t Buffer_Queue_Capacity = 8 >
+           std::size_t Buffer_Queue_Capacity = 8,
+           typename Buffer_Recycler          = noop_buffer_recycler_t >
 class pkg_input_t final : public pkg_input_base_t
 {
+    static_assert( Buffer_Queue_Capacity > 0 );
+
 public:
     using buffer_t = Buffer;
+
+    pkg_input_t() = default;
+
+    explicit pkg_input_t( Buffer_Recycler recycler )
+        : m_recycler{ std::move( recycler ) }
+    {
+    }
+
     // Obtains a chunk of data from the stream.
     //
     // Preconditions:
@@ -84,7 +226,7 @@ public:
 
         if( m_total_size == 0 ) return false;
 
-        *data = m_bufs[ m_first_buffer_pos ].offset_data( m_first_buffer_offset );
+        *data = bufs()[ m_first_buffer_pos ].offset_data( m_first_buffer_offset );
         *size = remained_in_the_first_buffer();
 
         m_byte_size_counter += *size;
@@ -126,6 +268,7 @@ public:
             // In next we always serve first block so backup goes to it.
             // As precondition says, we are safe to do the following:
             m_first_buffer_offset += consumed_size;
+            consume_first_buffer_prefix();
         }
         else
         {
@@ -171,34 +314,37 @@ public:
     {
         assert( !m_first_buffer_served );
 
-        m_total_size += buf.size();
-        if( Buffer_Queue_Capacity > m_buffers_count )
+        const auto buf_size = buf.size();
+
+        if constexpr( Mergeable_Buffer_Concept< buffer_t > )
         {
-            const auto next_pos =
-                ( m_first_buffer_pos + m_buffers_count ) % Buffer_Queue_Capacity;
-            m_bufs[ next_pos ] = std::move( buf );
-            ++m_buffers_count;
+            if( 0 < m_buffers_count && last_buffer().try_merge( buf ) )
+            {
+                m_total_size += buf_size;
+                return;
+            }
         }
-        else
+
+        if( m_capacity == m_buffers_count ) [[unlikely]]
         {
-            // The worst case:
-            // If we have a full queue, so we cannot simply append
-            // so wee just add to last item in queue.
-            const auto last_buf_pos = ( m_first_buffer_pos + m_buffers_count - 1 )
-                                      % Buffer_Queue_Capacity;
-
-            auto & last_buf = m_bufs[ last_buf_pos ];
-
-            const std::size_t append_offset = last_buf.size();
-            last_buf.resize( append_offset + buf.size() );
-            std::memcpy( last_buf.data() + append_offset, buf.data(), buf.size() );
-            // TODO: The above line is potentially throwing,
-            // and if it does then we have invalid m_total_size
-            // (we increase it already).
-            // That is not a big issue (for now), though we should better
-            // keep things valid, but no quick idea of how
-            // to make it look pretty.
+            // The queue is full, so we move buffers
+            // to a larger storage (the data itself stays in place).
+            // If it throws the input remains valid.
+            grow();
         }
+
+        bufs()[ ( m_first_buffer_pos + m_buffers_count ) % m_capacity ] =
+            std::move( buf );
+        ++m_buffers_count;
+        m_total_size += buf_size;
+    }
+
+    /**
+     * @brief Current capacity of the queue of buffers.
+     */
+    [[nodiscard]] std::size_t queue_capacity() const noexcept
+    {
+        return m_capacity;
     }
 
     /**
@@ -248,6 +394,50 @@ public:
         skip_bytes( size );
     }
 
+    [[nodiscard]] std::optional< std::span< const std::byte > > view_contiguous(
+        std::size_t n ) const noexcept final
+    {
+        assert( !m_first_buffer_served );
+        assert( m_total_size >= n );
+
+        if( 0 == n )
+        {
+            return std::span< const std::byte >{};
+        }
+
+        if( remained_in_the_first_buffer() < n ) [[unlikely]]
+        {
+            return std::nullopt;
+        }
+
+        const void * data =
+            bufs()[ m_first_buffer_pos ].offset_data( m_first_buffer_offset );
+        return std::span< const std::byte >{
+            static_cast< const std::byte * >( data ), n
+        };
+    }
+
+    [[nodiscard]] std::optional< net::shared_buffer_slice_t > read_shared_slice(
+        std::size_t n ) final
+    {
+        assert( !m_first_buffer_served );
+        assert( m_total_size >= n );
+
+        if constexpr( Sliceable_Buffer_Concept< buffer_t > )
+        {
+            if( 0 < n && remained_in_the_first_buffer() >= n ) [[likely]]
+            {
+                auto slice =
+                    bufs()[ m_first_buffer_pos ].make_slice( m_first_buffer_offset,
+                                                             n );
+                skip_bytes( n );
+                return slice;
+            }
+        }
+
+        return std::nullopt;
+    }
+
     /**
      * @brief Skip a number of bytes in the buffer.
      *
@@ -270,6 +460,7 @@ public:
             // so we only adjust first buffer offset and total size.
             m_first_buffer_offset += n;
             m_total_size -= n;
+            consume_first_buffer_prefix();
             return;
         }
 
@@ -305,9 +496,54 @@ private:
      * @param  pos  A pos in the queue to increment.
      * @return      The next position in the ring storage.
      */
-    static constexpr auto next_pos( std::size_t pos ) noexcept
+    [[nodiscard]] auto next_pos( std::size_t pos ) const noexcept
     {
-        return ( pos + 1 ) % Buffer_Queue_Capacity;
+        return ( pos + 1 ) % m_capacity;
+    }
+
+    /**
+     * @brief Gets the current queue storage.
+     */
+    [[nodiscard]] buffer_t * bufs() noexcept
+    {
+        return m_heap_bufs ? m_heap_bufs.get() : m_inline_bufs.data();
+    }
+
+    [[nodiscard]] const buffer_t * bufs() const noexcept
+    {
+        return m_heap_bufs ? m_heap_bufs.get() : m_inline_bufs.data();
+    }
+
+    /**
+     * @brief Doubles the capacity of the queue.
+     *
+     * Buffers are moved to a new heap storage in the order of the queue,
+     * so the first buffer goes to the beginning of the storage.
+     * Inline storage is cleared to release buffers kept in it.
+     */
+    void grow()
+    {
+        const auto new_capacity = 2 * m_capacity;
+        auto new_bufs = std::make_unique< buffer_t[] >( new_capacity );
+
+        auto * old_bufs = bufs();
+        for( std::size_t i = 0; i < m_buffers_count; ++i )
+        {
+            new_bufs[ i ] =
+                std::move( old_bufs[ ( m_first_buffer_pos + i ) % m_capacity ] );
+        }
+
+        if( !m_heap_bufs )
+        {
+            for( auto & b : m_inline_bufs )
+            {
+                b = buffer_t{};
+            }
+        }
+
+        m_heap_bufs        = std::move( new_bufs );
+        m_capacity         = new_capacity;
+        m_first_buffer_pos = 0;
     }
 
     /**
@@ -320,16 +556,16 @@ private:
     {
         assert( m_total_size >= n );
 
-        const auto remained_in_this_buffer = m_bufs[ buf_pos ].size() - buf_offset;
+        const auto remained_in_this_buffer = bufs()[ buf_pos ].size() - buf_offset;
 
         if( n < remained_in_this_buffer )
         {
-            std::memcpy( dest, m_bufs[ buf_pos ].offset_data( buf_offset ), n );
+            std::memcpy( dest, bufs()[ buf_pos ].offset_data( buf_offset ), n );
             return;
         }
 
         std::memcpy( dest,
-                     m_bufs[ buf_pos ].offset_data( buf_offset ),
+                     bufs()[ buf_pos ].offset_data( buf_offset ),
                      remained_in_this_buffer );
 
         copy_n_bytes_to( static_cast< char * >( dest ) + remained_in_this_buffer,
@@ -340,22 +576,51 @@ private:
 
     /**
      * @brief Pops the first buffer from queue.
+     *
+     * The buffer is fully consumed so it is handed to recycler.
      */
     void pop_buffer()
     {
         assert( m_buffers_count > 0 );
+        m_recycler( bufs()[ m_first_buffer_pos ] );
         --m_buffers_count;
-        m_first_buffer_pos    = ( m_first_buffer_pos + 1 ) % Buffer_Queue_Capacity;
+        m_first_buffer_pos    = next_pos( m_first_buffer_pos );
         m_first_buffer_offset = 0;
     }
 
+    /**
+     * @brief Drops the consumed part of the first buffer from the buffer.
+     *
+     * Applies only to buffers that support it
+     * (see Consumable_Buffer_Concept).
+     */
+    void consume_first_buffer_prefix() noexcept
+    {
+        if constexpr( Consumable_Buffer_Concept< buffer_t > )
+        {
+            bufs()[ m_first_buffer_pos ].consume(
+                std::exchange( m_first_buffer_offset, 0 ) );
+        }
+    }
+
+    /**
+     * @brief Gets the last buffer in the queue.
+     *
+     * @pre Queue is not empty.
+     */
+    [[nodiscard]] buffer_t & last_buffer() noexcept
+    {
+        assert( m_buffers_count > 0 );
+        return bufs()[ ( m_first_buffer_pos + m_buffers_count - 1 ) % m_capacity ];
+    }
+
     /**
      * @brief Gets a number of bytes available in the first buffer.
      *
      */
     [[nodiscard]] auto remained_in_the_first_buffer() const noexcept
     {
-        return m_bufs[ m_first_buffer_pos ].size() - m_first_buffer_offset;
+        return bufs()[ m_first_buffer_pos ].size() - m_first_buffer_offset;
     }
     //! The total size of accumulated buffer.
     std::size_t m_total_size{};
@@ -387,8 +652,17 @@ private:
      * in the logical queue. The first item in the queue
      * located at @c m_first_buffer_pos in the storage
      * and continues further following the ring principle.
+     *
+     * Inline storage is used until the queue outgrows it,
+     * after that @c m_heap_bufs is used.
      */
-    std::array< buffer_t, Buffer_Queue_Capacity > m_bufs;
+    std::array< buffer_t, Buffer_Queue_Capacity > m_inline_bufs;
+
+    //! Heap storage of the queue (if the queue outgrew inline storage).
+    std::unique_ptr< buffer_t[] > m_heap_bufs;
+
+    //! The capacity of the current queue storage.
+    std::size_t m_capacity{ Buffer_Queue_Capacity };
 
     /**
      * @brief Flag telling if the Next function was called
@@ -403,6 +677,11 @@ private:
      * Bytes dedicated to package headers are not counted for this value.
      */
     std::size_t m_byte_size_counter{};
+
+    /**
+     * @brief Recycler for consumed buffers.
+     */
+    [[no_unique_address]] Buffer_Recycler m_recycler;
 };
 
 }  // namespace opio::proto_entry
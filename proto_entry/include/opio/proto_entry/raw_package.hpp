@@ -0,0 +1,104 @@
+/**
+ * @file
+ *
+ * A package of a given message type that is not parsed.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include <opio/net/shared_buffer.hpp>
+
+namespace opio::proto_entry
+{
+
+//
+// raw_package_t
+//
+
+/**
+ * @brief An unparsed package of a given message type.
+ *
+ * Is given to a message consumer that declares `on_raw_package()`
+ * for a message type instead of a parsed message. The content and
+ * the attached binary refer the input in place whenever possible,
+ * so they can be kept or forwarded without a copy.
+ *
+ * The message can be parsed lazily with parse() or parse_to().
+ *
+ * @tparam Message  Protobuf message type of the package.
+ */
+template < typename Message >
+class raw_package_t
+{
+public:
+    using message_t = Message;
+
+    /**
+     * @brief Create an instance of an unparsed package.
+     *
+     * @param  content          The content of a package
+     *                          (serialized message).
+     * @param  attached_buffer  A binary attached to the message.
+     */
+    explicit raw_package_t( net::shared_buffer_slice_t content,
+                            net::shared_buffer_slice_t attached_buffer = {} )
+        : m_content{ std::move( content ) }
+        , m_attached_buffer{ std::move( attached_buffer ) }
+    {
+    }
+
+    [[nodiscard]] net::shared_buffer_slice_t & content() noexcept
+    {
+        return m_content;
+    }
+    [[nodiscard]] const net::shared_buffer_slice_t & content() const noexcept
+    {
+        return m_content;
+    }
+
+    [[nodiscard]] net::shared_buffer_slice_t & attached_buffer() noexcept
+    {
+        return m_attached_buffer;
+    }
+    [[nodiscard]] const net::shared_buffer_slice_t & attached_buffer()
+        const noexcept
+    {
+        return m_attached_buffer;
+    }
+
+    /**
+     * @brief Parse the content to a given message.
+     *
+     * @return True if the message is parsed successfully.
+     */
+    [[nodiscard]] bool parse_to( message_t & msg ) const
+    {
+        return msg.ParseFromArray( m_content.data(),
+                                   static_cast< int >( m_content.size() ) );
+    }
+
+    /**
+     * @brief Parse the content to a message.
+     *
+     * @return The message if it is parsed successfully.
+     */
+    [[nodiscard]] std::optional< message_t > parse() const
+    {
+        std::optional< message_t > res{ message_t{} };
+
+        if( !parse_to( *res ) ) [[unlikely]]
+        {
+            res = std::nullopt;
+        }
+
+        return res;
+    }
+
+private:
+    net::shared_buffer_slice_t m_content;
+    net::shared_buffer_slice_t m_attached_buffer;
+};
+
+}  // namespace opio::proto_entry
@@ -34,6 +34,28 @@ struct std_entry_shortcuts_factory
                         Protobuf_Parsing_Strategy >,
 
                     Message_Consumer >;
+
+    template < typename Message_Consumer,
+               typename Logger,
+               protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+                   protobuf_parsing_strategy::trivial >
+    using singlethread_pooled_buffers_t =
+        Entry_Type< ::opio::proto_entry::singlethread_pooled_buffers_traits_base_t<
+                        Stats_Driver,
+                        Logger,
+                        Protobuf_Parsing_Strategy >,
+                    Message_Consumer >;
+
+    template < typename Message_Consumer,
+               typename Logger,
+               protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+                   protobuf_parsing_strategy::trivial >
+    using multithread_pooled_buffers_t =
+        Entry_Type< ::opio::proto_entry::multithread_pooled_buffers_traits_base_t<
+                        Stats_Driver,
+                        Logger,
+                        Protobuf_Parsing_Strategy >,
+                    Message_Consumer >;
 };
 
 }  // namespace opio::proto_entry
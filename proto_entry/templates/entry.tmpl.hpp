@@ -401,72 +401,117 @@ protected:
                                this->underlying_connection_id() );
                 } );
 
-                auto parse_results = [&]{
-                    LimitingInputStream message_stream{ &stream, header.content_size };
-
-                    using protobuf_engine_t =
-                        typename base_type_t::template protobuf_engine_t< ${msg.type} >;
-                    auto res = protobuf_engine_t::parse_package( message_stream );
+                if constexpr( ::opio::proto_entry::details::on_raw_package_callback_support_v<
+                                  message_consumer_t, ${msg.type}, Entry_Type > )
+                {
+                    // The consumer takes the package unparsed.
+                    auto content = base_type_t::read_slice( stream, header.content_size );
 
-                    if( message_stream.ByteCount() != header.content_size ) [[unlikely]]
+                    ::opio::net::shared_buffer_slice_t attached_buffer;
+                    if( 0 != header.attached_binary_size )
                     {
-                        this->logger().error( [ & ]( auto out ) {
-                            format_to(
-                                out,
-                                "[{};cid:{}] parsing package expected to consume "
-                                "{} bytes, but actual count is: {} the further"
-                                "stream considered unreliable",
-                                this->remote_endpoint_str(),
-                                this->underlying_connection_id(),
-                                header.content_size,
-                                message_stream.ByteCount() );
-                        } );
-
-                        res.reset();
+                        attached_buffer =
+                            base_type_t::read_slice( stream, header.attached_binary_size );
                     }
 
-                    return res;
-                }();
-
-                if( !parse_results ) [[unlikely]]
-                {
-                    // Parsing fails.
-                    this->logger().error([ & ]( auto out ) {
-                        format_to( out,
-                                   "[{};cid:{}] unable to parse ${msg.type} package",
-                                   this->remote_endpoint_str(),
-                                   this->underlying_connection_id() );
-                    } );
-
-                    this->shutdown_and_terminate(
-                        ::opio::proto_entry::connection_shutdown_context_t{
-                            ::opio::proto_entry::entry_shutdown_reason::invalid_input_package } );
-
-                    return base_type_t::package_handling_result::invalid_package;
+                    opio::proto_entry::details::consume_raw_package(
+                        m_consumer,
+                        header,
+                        ::opio::proto_entry::raw_package_t< ${msg.type} >{
+                            std::move( content ), std::move( attached_buffer ) },
+                        actual_entry );
                 }
-
-                // Avoid any hanging bytes in terms of protobuf ZeroCopy stream:
-                stream.Skip( 0 );
-
-                auto make_message_carier = [&]{
-                    if( 0 == header.attached_binary_size )
+                else
+                {
+                    auto parse_results = [&]{
+                        using protobuf_engine_t =
+                            typename base_type_t::template protobuf_engine_t< ${msg.type} >;
+
+                        if constexpr( protobuf_engine_t::pins_input )
+                        {
+                            // The message carrier pins the content,
+                            // so it is taken in place whenever possible.
+                            return base_type_t::template parse_pinned_package<
+                                protobuf_engine_t >( stream, header.content_size );
+                        }
+                        else
+                        {
+                            // Fast path: the content lies in a single buffer,
+                            // so parse it right from memory.
+                            if( const auto content = stream.view_contiguous( header.content_size );
+                                content ) [[likely]]
+                            {
+                                auto res = protobuf_engine_t::parse_package( *content );
+                                stream.Skip( static_cast< int >( header.content_size ) );
+                                return res;
+                            }
+
+                            LimitingInputStream message_stream{ &stream, header.content_size };
+
+                            auto res = protobuf_engine_t::parse_package( message_stream );
+
+                            if( message_stream.ByteCount() != header.content_size ) [[unlikely]]
+                            {
+                                this->logger().error( [ & ]( auto out ) {
+                                    format_to(
+                                        out,
+                                        "[{};cid:{}] parsing package expected to consume "
+                                        "{} bytes, but actual count is: {} the further"
+                                        "stream considered unreliable",
+                                        this->remote_endpoint_str(),
+                                        this->underlying_connection_id(),
+                                        header.content_size,
+                                        message_stream.ByteCount() );
+                                } );
+
+                                res.reset();
+                            }
+
+                            return res;
+                        }
+                    }();
+
+                    if( !parse_results ) [[unlikely]]
                     {
-                        return parse_results->carry_message();
-                    }
-
-                    auto buf =
-                        this->buffer_driver()
-                            .allocate_input( header.attached_binary_size );
+                        // Parsing fails.
+                        this->logger().error([ & ]( auto out ) {
+                            format_to( out,
+                                       "[{};cid:{}] unable to parse ${msg.type} package",
+                                       this->remote_endpoint_str(),
+                                       this->underlying_connection_id() );
+                        } );
 
-                    stream.read_buffer( buf.data(), buf.size() );
+                        this->shutdown_and_terminate(
+                            ::opio::proto_entry::connection_shutdown_context_t{
+                                ::opio::proto_entry::entry_shutdown_reason::invalid_input_package } );
 
-                    return parse_results->carry_message( std::move( buf ) );
-                };
+                        return base_type_t::package_handling_result::invalid_package;
+                    }
 
-                opio::proto_entry::details::consume_message(
-                    m_consumer,
-                    make_message_carier(),
-                    actual_entry );
+                    // Avoid any hanging bytes in terms of protobuf ZeroCopy stream:
+                    stream.Skip( 0 );
+
+                    auto make_message_carier = [&]{
+                        if( 0 == header.attached_binary_size )
+                        {
+                            return parse_results->carry_message();
+                        }
+
+                        using attached_buffer_t = typename base_type_t::template
+                            message_carrier_t< ${msg.type} >::attached_buffer_t;
+
+                        // Attached binary might refer the input in place
+                        // (see entry_base_t::read_attached_buffer()).
+                        return parse_results->carry_message(
+                            base_type_t::template read_attached_buffer< attached_buffer_t >(
+                                stream, header.attached_binary_size ) );
+                    };
+
+                    opio::proto_entry::details::consume_message(
+                        m_consumer,
+                        make_message_carier(),
+                        actual_entry );
+                }
 
                 m_stats.inc_incoming_${msg.message_str_tag}();
             }
@@ -558,6 +603,20 @@ template< typename Message_Consumer,
 using entry_multithread_t =
     entry_shortcuts::multithread_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
 
+template< typename Message_Consumer,
+          typename Logger,
+          ::opio::proto_entry::protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+              ::opio::proto_entry::protobuf_parsing_strategy::trivial >
+using entry_singlethread_pooled_buffers_t =
+    entry_shortcuts::singlethread_pooled_buffers_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
+
+template< typename Message_Consumer,
+          typename Logger,
+          ::opio::proto_entry::protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+              ::opio::proto_entry::protobuf_parsing_strategy::trivial >
+using entry_multithread_pooled_buffers_t =
+    entry_shortcuts::multithread_pooled_buffers_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
+
 // Shortcut definitions for standard incornations for core_entry type.
 
 using core_entry_shortcuts = ::opio::proto_entry::std_entry_shortcuts_factory<
@@ -577,6 +636,20 @@ template< typename Message_Consumer,
 using core_entry_multithread_t =
     core_entry_shortcuts::multithread_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
 
+template< typename Message_Consumer,
+          typename Logger,
+          ::opio::proto_entry::protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+              ::opio::proto_entry::protobuf_parsing_strategy::trivial >
+using core_entry_singlethread_pooled_buffers_t =
+    core_entry_shortcuts::singlethread_pooled_buffers_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
+
+template< typename Message_Consumer,
+          typename Logger,
+          ::opio::proto_entry::protobuf_parsing_strategy Protobuf_Parsing_Strategy =
+              ::opio::proto_entry::protobuf_parsing_strategy::trivial >
+using core_entry_multithread_pooled_buffers_t =
+    core_entry_shortcuts::multithread_pooled_buffers_t< Message_Consumer, Logger, Protobuf_Parsing_Strategy >;
+
 //
 // Protocol message types meta-programming helper routines
 //
@@ -34,8 +34,14 @@ TEST( OpioProtoEntry, CfgMakeUnderlyingConnectionCfg )  // NOLINT
 {
     entry_full_cfg_t cfg;
 
-    cfg.input_buffer_size          = 123;   // NOLINT
-    cfg.write_timeout_per_1mb_msec = 9999;  // NOLINT
+    cfg.input_buffer_size             = 123;   // NOLINT
+    cfg.write_timeout_per_1mb_msec    = 9999;  // NOLINT
+    cfg.zerocopy_send_threshold       = 8192;  // NOLINT
+    cfg.max_iov_per_write             = 64;    // NOLINT
+    cfg.write_coalescing_delay_usec   = 250;   // NOLINT
+    cfg.write_coalescing_bytes        = 4096;  // NOLINT
+    cfg.write_coalescing_buffers      = 8;     // NOLINT
+    cfg.write_coalescing_use_tcp_cork = true;
 
     const auto s = cfg.make_underlying_connection_cfg();
 
@@ -44,6 +50,14 @@ TEST( OpioProtoEntry, CfgMakeUnderlyingConnectionCfg )  // NOLINT
                std::chrono::duration_cast< std::chrono::milliseconds >(
                    s.write_timeout_per_1mb() )
                    .count() );
+    EXPECT_EQ( cfg.zerocopy_send_threshold, s.zerocopy_send_threshold() );
+    EXPECT_EQ( cfg.max_iov_per_write, s.max_iov_per_write() );
+    EXPECT_EQ( cfg.write_coalescing_delay_usec,
+               s.write_coalescing_delay().count() );
+    EXPECT_EQ( cfg.write_coalescing_bytes, s.write_coalescing_bytes() );
+    EXPECT_EQ( cfg.write_coalescing_buffers, s.write_coalescing_buffers() );
+    EXPECT_EQ( cfg.write_coalescing_use_tcp_cork,
+               s.write_coalescing_use_tcp_cork() );
 }
 
 }  // anonymous namespace
@@ -22,7 +22,13 @@ TEST( OpioProtoEntry, Cfg )  // NOLINT
         "await_heartbeat_reply_timeout_msec" : 7777,
         "max_valid_package_size" : 8000000,
         "input_buffer_size" :      8000000,
-        "write_timeout_per_1mb_msec" : 3333
+        "write_timeout_per_1mb_msec" : 3333,
+        "zerocopy_send_threshold" : 131072,
+        "max_iov_per_write" : 128,
+        "write_coalescing_delay_usec" : 200,
+        "write_coalescing_bytes" : 8192,
+        "write_coalescing_buffers" : 32,
+        "write_coalescing_use_tcp_cork" : true
     })-" );
 
     EXPECT_EQ( cfg.endpoint.port, 1234 );
@@ -35,6 +41,12 @@ TEST( OpioProtoEntry, Cfg )  // NOLINT
     EXPECT_EQ( cfg.max_valid_package_size, 8000000 );
     EXPECT_EQ( cfg.input_buffer_size, 8000000 );
     EXPECT_EQ( cfg.write_timeout_per_1mb_msec, 3333 );
+    EXPECT_EQ( cfg.zerocopy_send_threshold, 131072 );
+    EXPECT_EQ( cfg.max_iov_per_write, 128 );
+    EXPECT_EQ( cfg.write_coalescing_delay_usec, 200 );
+    EXPECT_EQ( cfg.write_coalescing_bytes, 8192 );
+    EXPECT_EQ( cfg.write_coalescing_buffers, 32 );
+    EXPECT_TRUE( cfg.write_coalescing_use_tcp_cork );
 }
 
 TEST( OpioProtoEntry, CfgEmpty )  // NOLINT
@@ -62,6 +74,17 @@ TEST( OpioProtoEntry, CfgEmpty )  // NOLINT
     EXPECT_EQ( cfg.input_buffer_size, details::default_input_buffer_size );
     EXPECT_EQ( cfg.write_timeout_per_1mb_msec,
                details::default_write_timeout_per_1mb_msec );
+    EXPECT_EQ( cfg.zerocopy_send_threshold,
+               details::default_zerocopy_send_threshold );
+    EXPECT_EQ( cfg.max_iov_per_write, details::default_max_iov_per_write );
+    EXPECT_EQ( cfg.write_coalescing_delay_usec,
+               details::default_write_coalescing_delay_usec );
+    EXPECT_EQ( cfg.write_coalescing_bytes,
+               details::default_write_coalescing_bytes );
+    EXPECT_EQ( cfg.write_coalescing_buffers,
+               details::default_write_coalescing_buffers );
+    EXPECT_EQ( cfg.write_coalescing_use_tcp_cork,
+               details::default_write_coalescing_use_tcp_cork );
 }
 
 }  // anonymous namespace
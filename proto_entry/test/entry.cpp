@@ -1536,6 +1536,9 @@ struct input_ctx_mock_t
 
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     MOCK_METHOD( void, next_read_buffer, ( opio::net::simple_buffer_t ) );
+
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    MOCK_METHOD( std::size_t, next_read_size, (), ( const ) );
 };
 
 //
@@ -1565,7 +1568,7 @@ protected:
     }
 };
 
-TEST_F( OpioProtoEntryRawBytesHandler, ReadBufSizeNoAdjustments )  // NOLINT
+TEST_F( OpioProtoEntryRawBytesHandler, ReadBufNotProvided )  // NOLINT
 {
     using entry_t             = test_entry_t< message_consumer_mock_t >;
     using raw_bytes_handler_t = typename entry_t::raw_bytes_handler_t;
@@ -1574,96 +1577,55 @@ TEST_F( OpioProtoEntryRawBytesHandler, ReadBufSizeNoAdjustments )  // NOLINT
 
     raw_bytes_handler_t handler{ ioctx.get_executor(), {} };
 
+    // Without recycled buffers it is up to connection
+    // to prepare the next read buffer whatever the size is.
     buf.resize( 16 );
     handler( ctx );
 
-    buf.resize( 24 );
-    handler( ctx );
-
-    buf.resize( 31 );
-    handler( ctx );
-
-    buf.resize( 30 );
+    buf.resize( 32 );
     handler( ctx );
 
     buf.resize( 8 );
     handler( ctx );
 }
 
-// NOLINTNEXTLINE
-TEST_F( OpioProtoEntryRawBytesHandler, ReadBufSizeGrowAndShrink )
+TEST_F( OpioProtoEntryRawBytesHandler, ReadBufReuseRecycled )  // NOLINT
 {
     using entry_t             = test_entry_t< message_consumer_mock_t >;
     using raw_bytes_handler_t = typename entry_t::raw_bytes_handler_t;
+    using recycled_input_buffers_t = typename entry_t::recycled_input_buffers_t;
 
     asio_ns::io_context ioctx( 1 );
 
-    raw_bytes_handler_t handler{ ioctx.get_executor(), {} };
+    auto recycled = std::make_shared< recycled_input_buffers_t >();
+    raw_bytes_handler_t handler{ ioctx.get_executor(), {}, recycled };
 
-    // Force to grow.
-    buf.resize( 32 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 64, buf.size() );
-    } );
-    handler( ctx );
-
-    // CauseForce to grow.
-    buf.resize( 64 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 128, buf.size() );
-    } );
-    handler( ctx );
-
-    // CauseForce to grow.
-    buf.resize( 128 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 256, buf.size() );
-    } );
-    handler( ctx );
-
-    // CauseForce to grow.
-    buf.resize( 256 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 512, buf.size() );
-    } );
-    handler( ctx );
-
-    // Must remain the same.
-    buf.resize( 257 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 512, buf.size() );
-    } );
-    handler( ctx );
-
-    // Must shrink.
-    buf.resize( 256 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 256, buf.size() );
-    } );
-    handler( ctx );
+    // A buffer consumed by entry.
+    opio::net::simple_buffer_t consumed{ 100 };
+    const auto * consumed_data = consumed.data();
+    consumed.shrink_size( 10 );
+    ASSERT_TRUE( recycled->try_push( consumed ) );
 
-    // Must remain the same as previous time.
-    buf.resize( 255 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 256, buf.size() );
-    } );
-    handler( ctx );
-
-    // Must shrink (2 steps).
-    buf.resize( 63 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 64, buf.size() );
+    buf.resize( 16 );
+    EXPECT_CALL( ctx, next_read_size() ).WillOnce( Return( 32 ) );
+    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( [ & ]( auto b ) {
+        EXPECT_EQ( 32, b.size() );
+        EXPECT_EQ( consumed_data, b.data() );
     } );
     handler( ctx );
 
-    // Must remain growed.
+    // Reused buffer respects the size decided by connection.
+    opio::net::simple_buffer_t another_consumed{ 16 };
+    ASSERT_TRUE( recycled->try_push( another_consumed ) );
     buf.resize( 32 );
-    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( []( auto buf ) {
-        EXPECT_EQ( 64, buf.size() );
+    EXPECT_CALL( ctx, next_read_size() ).WillOnce( Return( 64 ) );
+    EXPECT_CALL( ctx, next_read_buffer( _ ) ).WillOnce( [ & ]( auto b ) {
+        EXPECT_EQ( 64, b.size() );
     } );
     handler( ctx );
 
-    buf.resize( 31 );
+    // Nothing to reuse.
+    buf.resize( 16 );
     handler( ctx );
 }
 
@@ -1742,6 +1704,214 @@ TEST( OpioProtoEntry, HandleHeartBeatWhenDisconnected )  // NOLINT
                msec_from_x_to_now( started_at ) );
 }
 
+//
+// raw_package_consumer_t
+//
+
+/**
+ * @brief A consumer that takes YyyRequest packages unparsed.
+ */
+struct raw_package_consumer_t
+{
+    template < typename Entry >
+    void on_raw_package( const pkg_header_t & header,
+                         raw_package_t< utest::YyyRequest > pkg,
+                         [[maybe_unused]] Entry & e )
+    {
+        EXPECT_EQ( header.content_size, pkg.content().size() );
+        EXPECT_EQ( header.attached_binary_size, pkg.attached_buffer().size() );
+        raw_packages.push_back( std::move( pkg ) );
+    }
+
+    template < typename Message_Carrier, typename Entry >
+    void on_message( [[maybe_unused]] Message_Carrier msg,
+                     [[maybe_unused]] Entry & e )
+    {
+        ++parsed_messages;
+    }
+
+    std::vector< raw_package_t< utest::YyyRequest > > raw_packages;
+    int parsed_messages{};
+};
+
+TEST( OpioProtoEntry, RawPackageConsumer )  // NOLINT
+{
+    asio_ns::io_context ioctx;
+    asio_ns::ip::tcp::socket server_socket{ ioctx };
+    asio_ns::ip::tcp::socket client_socket{ ioctx };
+    connect_pair( ioctx, server_socket, client_socket );
+
+    raw_package_consumer_t consumer;
+
+    using entry_t = test_entry_t< raw_package_consumer_t * >;
+    auto entry =
+        entry_t::make( std::move( server_socket ), [ & ]( auto & params ) {
+            params.logger( make_test_logger( "ENTRY" ) )
+                .message_consumer( &consumer );
+        } );
+
+    utest::YyyRequest yyy;
+    yyy.set_req_id( 2024 );
+    utest::XxxRequest xxx;
+    xxx.set_req_id( 42 );
+
+    const auto attached_bin = ::opio::net::simple_buffer_t::make_from(
+        { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' } );
+
+    auto send = [ & ]( const auto & buf ) {
+        client_socket.send( asio_ns::const_buffer{ buf.data(), buf.size() } );
+    };
+
+    send( utest::make_package_image( yyy ) );
+    send( utest::make_package_image( yyy, attached_bin.size() ) );
+    send( attached_bin );
+    send( utest::make_package_image( xxx ) );
+
+    ioctx.run_for( std::chrono::milliseconds( 10 ) );
+
+    entry->close();
+    ioctx.run_for( std::chrono::milliseconds( 10 ) );
+
+    // YyyRequest is not parsed, XxxRequest is.
+    ASSERT_EQ( consumer.raw_packages.size(), 2 );
+    EXPECT_EQ( consumer.parsed_messages, 1 );
+
+    for( const auto & pkg : consumer.raw_packages )
+    {
+        const auto msg = pkg.parse();
+        ASSERT_TRUE( msg );
+        EXPECT_EQ( msg->req_id(), 2024 );
+    }
+
+    EXPECT_TRUE( consumer.raw_packages[ 0 ].attached_buffer().empty() );
+    EXPECT_EQ( consumer.raw_packages[ 1 ].attached_buffer().make_string_view(),
+               "0123456789" );
+}
+
+//
+// attached_bin_consumer_t
+//
+
+/**
+ * @brief A consumer that keeps binaries attached to received messages.
+ */
+struct attached_bin_consumer_t
+{
+    template < typename Message_Carrier, typename Entry >
+    void on_message( Message_Carrier msg, [[maybe_unused]] Entry & e )
+    {
+        attached_bins.emplace_back( msg.attached_buffer().make_string_view() );
+    }
+
+    std::vector< std::string > attached_bins;
+};
+
+/**
+ * @brief Receive messages with and without attached binary
+ *        with an entry of a given type.
+ *
+ * Instantiates generated entry code with traits of a given entry.
+ */
+template < typename Entry >
+void check_attached_bin_delivery()
+{
+    asio_ns::io_context ioctx;
+    asio_ns::ip::tcp::socket server_socket{ ioctx };
+    asio_ns::ip::tcp::socket client_socket{ ioctx };
+    connect_pair( ioctx, server_socket, client_socket );
+
+    attached_bin_consumer_t consumer;
+
+    auto entry =
+        Entry::make( std::move( server_socket ), [ & ]( auto & params ) {
+            params.logger( make_test_logger( "ENTRY" ) )
+                .message_consumer( &consumer );
+        } );
+
+    utest::YyyRequest yyy;
+    yyy.set_req_id( 2024 );
+
+    const auto attached_bin = ::opio::net::simple_buffer_t::make_from(
+        { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9' } );
+
+    auto send = [ & ]( const auto & buf ) {
+        client_socket.send( asio_ns::const_buffer{ buf.data(), buf.size() } );
+    };
+
+    send( utest::make_package_image( yyy ) );
+    send( utest::make_package_image( yyy, attached_bin.size() ) );
+    send( attached_bin );
+
+    ioctx.run_for( std::chrono::milliseconds( 10 ) );
+
+    entry->close();
+    ioctx.run_for( std::chrono::milliseconds( 10 ) );
+
+    ASSERT_EQ( consumer.attached_bins.size(), 2 );
+    EXPECT_TRUE( consumer.attached_bins[ 0 ].empty() );
+    EXPECT_EQ( consumer.attached_bins[ 1 ], "0123456789" );
+}
+
+TEST( OpioProtoEntry, PooledBuffersAttachedBin )  // NOLINT
+{
+    check_attached_bin_delivery< utest::entry_singlethread_pooled_buffers_t<
+        attached_bin_consumer_t *,
+        opio::logger::logger_t > >();
+
+    check_attached_bin_delivery< utest::entry_multithread_pooled_buffers_t<
+        attached_bin_consumer_t *,
+        opio::logger::logger_t > >();
+}
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+TEST( OpioProtoEntry, MirroredRingInputAttachedBin )  // NOLINT
+{
+    using st_traits_t =
+        singlethread_mirrored_ring_input_traits_base_t< utest::noop_stats_driver_t,
+                                                        opio::logger::logger_t >;
+    using mt_traits_t =
+        multithread_mirrored_ring_input_traits_base_t< utest::noop_stats_driver_t,
+                                                       opio::logger::logger_t >;
+
+    // Attached binaries must not hold the ring space.
+    static_assert( std::is_same_v< entry_base_t< st_traits_t >::message_carrier_t<
+                                       utest::YyyRequest >::attached_buffer_t,
+                                   opio::net::simple_buffer_t > );
+
+    check_attached_bin_delivery<
+        utest::entry_t< st_traits_t, attached_bin_consumer_t * > >();
+
+    check_attached_bin_delivery<
+        utest::entry_t< mt_traits_t, attached_bin_consumer_t * > >();
+}
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+#if defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+TEST( OpioProtoEntry, AliasingParsingAttachedBin )  // NOLINT
+{
+    using st_traits_t = singlethread_shared_input_buffers_traits_base_t<
+        utest::noop_stats_driver_t,
+        opio::logger::logger_t,
+        protobuf_parsing_strategy::aliasing >;
+    using mt_traits_t = multithread_pooled_buffers_traits_base_t<
+        utest::noop_stats_driver_t,
+        opio::logger::logger_t,
+        protobuf_parsing_strategy::aliasing >;
+
+    // Generated code takes the pinned input path only.
+    static_assert( st_traits_t::protobuf_parsing_engine_t<
+                   utest::YyyRequest >::pins_input );
+    static_assert( mt_traits_t::protobuf_parsing_engine_t<
+                   utest::YyyRequest >::pins_input );
+
+    check_attached_bin_delivery<
+        utest::entry_t< st_traits_t, attached_bin_consumer_t * > >();
+
+    check_attached_bin_delivery<
+        utest::entry_t< mt_traits_t, attached_bin_consumer_t * > >();
+}
+#endif  // defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+
 #define OPIO_PROTO_ENTRY_TEST_PROTOBUF_PARSING_STRATEGY \
     opio::proto_entry::protobuf_parsing_strategy::trivial
 
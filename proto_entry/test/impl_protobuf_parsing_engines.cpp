@@ -28,6 +28,13 @@ TEST( OpioProtoEntryImplProtobufParsingEngine, Enum2TypeLUT )  // NOLINT
         impl::protobuf_with_arena_parsing_engine_t< msg_t > >;
 
     EXPECT_TRUE( with_arena_parsing_engine_lut_as_expected );
+
+    const auto aliasing_parsing_engine_lut_as_expected = std::is_same_v<
+        impl::protobuf_parsing_engine_t< protobuf_parsing_strategy::aliasing,
+                                         msg_t >,
+        impl::protobuf_aliasing_parsing_engine_t< msg_t > >;
+
+    EXPECT_TRUE( aliasing_parsing_engine_lut_as_expected );
 }
 
 class OpioProtoEntryImplProtobufParsingEngines : public testing::Test
@@ -85,4 +92,91 @@ TEST_F( OpioProtoEntryImplProtobufParsingEngines, WithArenaParsing )  // NOLINT
     EXPECT_EQ( msg->req_id(), req_id_value );
 }
 
+TEST_F( OpioProtoEntryImplProtobufParsingEngines, ParsingFromArray )  // NOLINT
+{
+    const std::span< const std::byte > input{ buf.data(), buf.size() };
+
+    using trivial_engine_t =
+        impl::protobuf_parsing_engine_t< protobuf_parsing_strategy::trivial,
+                                         utest::YyyRequest >;
+    using with_arena_engine_t =
+        impl::protobuf_parsing_engine_t< protobuf_parsing_strategy::with_arena,
+                                         utest::YyyRequest >;
+
+    auto trivial_res = trivial_engine_t::parse_package( input );
+    ASSERT_TRUE( trivial_res );
+    EXPECT_EQ( trivial_res->message().req_id(), req_id_value );
+
+    auto with_arena_res = with_arena_engine_t::parse_package( input );
+    ASSERT_TRUE( with_arena_res );
+    EXPECT_EQ( with_arena_res->message().req_id(), req_id_value );
+
+    // Truncated input.
+    EXPECT_FALSE( trivial_engine_t::parse_package( input.first( 1 ) ) );
+}
+
+#if defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+
+TEST_F( OpioProtoEntryImplProtobufParsingEngines, AliasingParsing )  // NOLINT
+{
+    using engine_t =
+        impl::protobuf_parsing_engine_t< protobuf_parsing_strategy::aliasing,
+                                         utest::YyyRequest >;
+
+    static_assert( engine_t::pins_input );
+
+    opio::net::shared_buffer_t input{ buf.data(), buf.size() };
+
+    auto parse_res = engine_t::parse_package( input.make_slice( 0, buf.size() ) );
+    ASSERT_TRUE( parse_res );
+    EXPECT_EQ( parse_res->message().req_id(), req_id_value );
+
+    {
+        auto msg = parse_res->carry_message();
+        EXPECT_EQ( msg->req_id(), req_id_value );
+
+        // The carrier pins the input.
+        EXPECT_EQ( input.use_count(), 2 );
+        EXPECT_EQ( msg.pinned_input().data(), input.data() );
+        EXPECT_EQ( msg.pinned_input().size(), buf.size() );
+    }
+    EXPECT_EQ( input.use_count(), 1 );
+
+    // Truncated input is not pinned.
+    EXPECT_FALSE( engine_t::parse_package( input.make_slice( 0, 1 ) ) );
+    EXPECT_EQ( input.use_count(), 1 );
+}
+
+TEST( OpioProtoEntryImplProtobufParsingEngine,  // NOLINT
+      AliasingParsingSharesCord )
+{
+    using engine_t =
+        impl::protobuf_parsing_engine_t< protobuf_parsing_strategy::aliasing,
+                                         utest::CordHolder >;
+
+    utest::CordHolder src;
+    src.set_data( std::string( 64 * 1024, 'x' ) );
+    const auto serialized = src.SerializeAsString();
+
+    opio::net::shared_buffer_t input{ serialized.data(), serialized.size() };
+
+    auto parse_res =
+        engine_t::parse_package( input.make_slice( 0, serialized.size() ) );
+    ASSERT_TRUE( parse_res );
+
+    auto msg = parse_res->carry_message();
+    const absl::Cord & data = msg->data();
+    ASSERT_EQ( data.size(), 64 * 1024 );
+
+    // The field refers the input in place.
+    const auto * input_begin = reinterpret_cast< const char * >( input.data() );
+    for( const absl::string_view chunk : data.Chunks() )
+    {
+        EXPECT_GE( chunk.data(), input_begin );
+        EXPECT_LE( chunk.data() + chunk.size(), input_begin + input.size() );
+    }
+}
+
+#endif  // defined( OPIO_PROTO_ENTRY_HAS_CORD_PARSING )
+
 }  // anonymous namespace
@@ -78,6 +78,31 @@ TEST( OpioProtoEntryMessageCarrier, TrivialProxyWithAttachedBuffer )  // NOLINT
     ASSERT_EQ( msg_carrier.attached_buffer().size(), 0 );
 }
 
+TEST( OpioProtoEntryMessageCarrier, TrivialProxyWithAttachedSlice )  // NOLINT
+{
+    namespace proto = opio::proto_entry::utest;
+
+    proto::XxxRequest msg;
+    msg.set_req_id( 42 );
+
+    shared_buffer_t input{ "xx0123456789yy", 14 };
+
+    trivial_proxy_message_carrier_t msg_carrier{ std::move( msg ),
+                                                 input.make_slice( 2, 10 ) };
+    static_assert( std::is_same_v< decltype( msg_carrier )::attached_buffer_t,
+                                   shared_buffer_slice_t > );
+
+    ASSERT_EQ( msg_carrier->req_id(), 42 );
+
+    // Refers the input in place.
+    ASSERT_EQ( msg_carrier.attached_buffer().data(), input.data() + 2 );
+    ASSERT_EQ( msg_carrier.attached_buffer().make_string_view(), "0123456789" );
+
+    auto bin = std::move( msg_carrier.attached_buffer() );
+    ASSERT_EQ( bin.make_string_view(), "0123456789" );
+    ASSERT_EQ( msg_carrier.attached_buffer().size(), 0 );
+}
+
 TEST( OpioProtoEntryMessageCarrier, WithArena )  // NOLINT
 {
     namespace proto = opio::proto_entry::utest;
@@ -170,4 +195,34 @@ TEST( OpioProtoEntryMessageCarrier, WithArenaWithAttachedBuffer )  // NOLINT
     ASSERT_EQ( msg_carrier.attached_buffer().size(), 0 );
 }
 
+TEST( OpioProtoEntryMessageCarrier, Aliasing )  // NOLINT
+{
+    namespace proto = opio::proto_entry::utest;
+
+    proto::XxxRequest msg;
+    msg.set_req_id( 42 );
+
+    shared_buffer_t input{ "0123456789", 10 };
+
+    {
+        aliasing_message_carrier_t< proto::XxxRequest > msg_carrier{
+            std::move( msg ), input.make_slice( 0, 4 ), simple_buffer_t{ 8 }
+        };
+
+        ASSERT_EQ( msg_carrier->req_id(), 42 );
+        ASSERT_EQ( msg_carrier.attached_buffer().size(), 8 );
+
+        // Input is pinned.
+        ASSERT_EQ( input.use_count(), 2 );
+        ASSERT_EQ( msg_carrier.pinned_input().make_string_view(), "0123" );
+
+        auto moved = std::move( msg_carrier );
+        ASSERT_EQ( moved->req_id(), 42 );
+        ASSERT_EQ( input.use_count(), 2 );
+        ASSERT_EQ( moved.pinned_input().data(), input.data() );
+    }
+
+    ASSERT_EQ( input.use_count(), 1 );
+}
+
 }  // anonymous namespace
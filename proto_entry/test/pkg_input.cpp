@@ -1,5 +1,10 @@
 #include <opio/proto_entry/pkg_input.hpp>
 
+#include <opio/net/mirrored_ring_buffer.hpp>
+
+#include <string_view>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "utest.pb.h"
@@ -223,6 +228,232 @@ TEST( OpioProtoEntryPkgInput, OwnRoutinesRingQueue2 )  // NOLINT
     }
 }
 
+TEST( OpioProtoEntryPkgInput, OwnRoutinesRecycleConsumedBuffers )  // NOLINT
+{
+    std::vector< opio::net::simple_buffer_t > recycled;
+
+    auto recycler = [ &recycled ]( opio::net::simple_buffer_t & buf ) {
+        recycled.push_back( std::move( buf ) );
+    };
+
+    pkg_input_t< opio::net::simple_buffer_t, 4, decltype( recycler ) > input{
+        recycler
+    };
+
+    input.append( make_buffer( 100, '1' ) );
+    input.append( make_buffer( 50, '2' ) );
+    input.append( make_buffer( 10, '3' ) );
+    input.skip_bytes( 99 );
+    ASSERT_TRUE( recycled.empty() );
+
+    // Exhaust first and second buffers.
+    input.skip_bytes( 51 );
+    ASSERT_EQ( recycled.size(), 2 );
+    EXPECT_EQ( recycled[ 0 ].size(), 100 );
+    EXPECT_EQ( recycled[ 0 ].data()[ 0 ], std::byte{ '1' } );
+    EXPECT_EQ( recycled[ 1 ].size(), 50 );
+    EXPECT_EQ( recycled[ 1 ].data()[ 0 ], std::byte{ '2' } );
+
+    ASSERT_EQ( input.size(), 10 );
+
+    char dest[ 10 ];
+    input.read_buffer( dest, sizeof( dest ) );
+    ASSERT_EQ( recycled.size(), 3 );
+    EXPECT_EQ( std::string_view( dest, sizeof( dest ) ), "3333333333" );
+}
+
+TEST( OpioProtoEntryPkgInput, OwnRoutinesQueueGrows )  // NOLINT
+{
+    pkg_input_t< opio::net::simple_buffer_t, 2 > input{};
+    ASSERT_EQ( input.queue_capacity(), 2 );
+
+    // Consume some data to make the ring wrap around.
+    input.append( make_buffer( 5, 'x' ) );
+    input.skip_bytes( 5 );
+
+    std::vector< const std::byte * > appended_data;
+    for( char c = 'a'; c <= 'j'; ++c )
+    {
+        auto buf = make_buffer( 10, c );
+        appended_data.push_back( buf.data() );
+        input.append( std::move( buf ) );
+    }
+
+    ASSERT_EQ( input.size(), 100 );
+    EXPECT_EQ( input.queue_capacity(), 16 );
+
+    // Buffers are queued as is, the data is not copied.
+    for( char c = 'a'; c <= 'j'; ++c )
+    {
+        const auto view = input.view_contiguous( 10 );
+        ASSERT_TRUE( view );
+        EXPECT_EQ( view->data(), appended_data[ c - 'a' ] );
+        EXPECT_EQ( view->front(), static_cast< std::byte >( c ) );
+
+        // Spans two buffers.
+        if( 'j' != c )
+        {
+            EXPECT_FALSE( input.view_contiguous( 11 ) );
+        }
+        input.skip_bytes( 10 );
+    }
+
+    ASSERT_EQ( input.size(), 0 );
+
+    input.append( make_buffer( 10, '1' ) );
+    input.append( make_buffer( 10, '2' ) );
+    char dest[ 15 ];
+    input.read_buffer( dest, sizeof( dest ) );
+    EXPECT_EQ( std::string_view( dest, sizeof( dest ) ), "111111111122222" );
+}
+
+//
+// adjacent_slice_t
+//
+
+/**
+ * @brief A mergeable buffer referring a piece of external memory.
+ */
+struct adjacent_slice_t
+{
+    std::byte * ptr{};
+    std::size_t n{};
+
+    std::size_t size() const noexcept { return n; }
+    std::byte * data() noexcept { return ptr; }
+    const std::byte * data() const noexcept { return ptr; }
+    const std::byte * offset_data( std::size_t k ) const noexcept
+    {
+        return ptr + k;
+    }
+
+    void resize( [[maybe_unused]] std::size_t k ) { ADD_FAILURE(); }
+
+    bool try_merge( adjacent_slice_t & next ) noexcept
+    {
+        if( ptr + n != next.ptr )
+        {
+            return false;
+        }
+
+        n += std::exchange( next.n, 0 );
+        return true;
+    }
+};
+
+TEST( OpioProtoEntryPkgInput, OwnRoutinesMergeAdjacentBuffers )  // NOLINT
+{
+    static_assert( Mergeable_Buffer_Concept< adjacent_slice_t > );
+    static_assert( !Mergeable_Buffer_Concept< opio::net::simple_buffer_t > );
+
+    std::string mem( 300, '1' );
+    mem.replace( 100, 50, std::string( 50, '2' ) );
+    mem.replace( 150, 150, std::string( 150, '3' ) );
+
+    auto * p = reinterpret_cast< std::byte * >( mem.data() );
+
+    pkg_input_t< adjacent_slice_t, 2 > input{};
+    input.append( adjacent_slice_t{ p, 100 } );
+    input.append( adjacent_slice_t{ p + 100, 50 } );
+    input.append( adjacent_slice_t{ p + 150, 150 } );
+    ASSERT_EQ( input.size(), 300 );
+
+    // Not adjacent.
+    std::string other( 10, '4' );
+    input.append(
+        adjacent_slice_t{ reinterpret_cast< std::byte * >( other.data() ), 10 } );
+    ASSERT_EQ( input.size(), 310 );
+
+    const void * data = nullptr;
+    int size          = 0;
+
+    ASSERT_TRUE( input.Next( &data, &size ) );
+    EXPECT_EQ( data, mem.data() );
+    EXPECT_EQ( std::string_view( static_cast< const char * >( data ), size ),
+               mem );
+
+    ASSERT_TRUE( input.Next( &data, &size ) );
+    EXPECT_EQ( std::string_view( static_cast< const char * >( data ), size ),
+               other );
+
+    ASSERT_FALSE( input.Next( &data, &size ) );
+}
+
+#if defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
+TEST( OpioProtoEntryPkgInput, OwnRoutinesMirroredRingIsReused )  // NOLINT
+{
+    using opio::net::mirrored_ring_buffer_t;
+
+    static_assert( Consumable_Buffer_Concept< mirrored_ring_buffer_t > );
+    static_assert( !Consumable_Buffer_Concept< opio::net::simple_buffer_t > );
+
+    opio::net::mirrored_ring_input_buffer_driver_t<> driver{ 64 * 1024 };
+    const auto cap = driver.ring_capacity();
+
+    pkg_input_t< mirrored_ring_buffer_t > input{};
+
+    // Packages are consumed only while some data follows them,
+    // so the last buffer always has unconsumed data
+    // and next reads are merged into it.
+    constexpr std::size_t pkg_size  = 1000;
+    constexpr std::size_t read_size = 1500;
+
+    const std::byte * ring_base = nullptr;
+    std::size_t streamed        = 0;
+    std::size_t packages        = 0;
+
+    while( streamed < 8 * cap )
+    {
+        auto buf = driver.allocate_input( read_size );
+        ASSERT_EQ( buf.size(), read_size );
+
+        if( !ring_base )
+        {
+            ring_base = buf.data();
+        }
+
+        // No new ring is started.
+        ASSERT_GE( buf.data(), ring_base );
+        ASSERT_LT( buf.data(), ring_base + 2 * cap );
+
+        for( std::size_t i = 0; i < read_size; ++i )
+        {
+            *buf.offset_data( i ) =
+                static_cast< std::byte >( ( streamed + i ) / pkg_size );
+        }
+        streamed += read_size;
+        input.append( driver.reduce_size_input( std::move( buf ), read_size ) );
+
+        while( input.size() > pkg_size )
+        {
+            const auto expected = static_cast< std::byte >( packages++ );
+
+            if( packages % 2 )
+            {
+                const auto view = input.view_contiguous( pkg_size );
+                ASSERT_TRUE( view );
+                ASSERT_EQ( view->front(), expected );
+                ASSERT_EQ( view->back(), expected );
+                ASSERT_TRUE( input.Skip( pkg_size ) );
+            }
+            else
+            {
+                const void * data = nullptr;
+                int size          = 0;
+                ASSERT_TRUE( input.Next( &data, &size ) );
+                ASSERT_LT( pkg_size, static_cast< std::size_t >( size ) );
+                ASSERT_EQ( *static_cast< const std::byte * >( data ), expected );
+                input.BackUp( size - static_cast< int >( pkg_size ) );
+            }
+        }
+    }
+
+    EXPECT_EQ( packages, ( streamed - 1 ) / pkg_size );
+}
+
+#endif  // defined( OPIO_NET_HAS_MIRRORED_RING_BUFFER )
+
 TEST( OpioProtoEntryPkgInput, OwnRoutinesViewPackageHeader )  // NOLINT
 {
     pkg_input_t input{};
@@ -262,6 +493,80 @@ TEST( OpioProtoEntryPkgInput,
     ASSERT_EQ( header.attached_binary_size, h.attached_binary_size );
 }
 
+TEST( OpioProtoEntryPkgInput, OwnRoutinesViewContiguous )  // NOLINT
+{
+    pkg_input_t input{};
+    input.append( make_buffer( 10, std::byte{ 'a' } ) );
+    input.append( make_buffer( 10, std::byte{ 'b' } ) );
+
+    ASSERT_TRUE( input.view_contiguous( 0 ) );
+    EXPECT_TRUE( input.view_contiguous( 0 )->empty() );
+
+    auto view = input.view_contiguous( 10 );
+    ASSERT_TRUE( view );
+    ASSERT_EQ( view->size(), 10 );
+    EXPECT_EQ( view->front(), std::byte{ 'a' } );
+    EXPECT_EQ( view->back(), std::byte{ 'a' } );
+
+    // Spans two buffers.
+    EXPECT_FALSE( input.view_contiguous( 11 ) );
+
+    // Data is not consumed.
+    EXPECT_EQ( input.size(), 20 );
+
+    input.skip_bytes( 8 );
+    EXPECT_FALSE( input.view_contiguous( 3 ) );
+    view = input.view_contiguous( 2 );
+    ASSERT_TRUE( view );
+    EXPECT_EQ( view->size(), 2 );
+
+    input.skip_bytes( 2 );
+    view = input.view_contiguous( 10 );
+    ASSERT_TRUE( view );
+    EXPECT_EQ( view->front(), std::byte{ 'b' } );
+}
+
+TEST( OpioProtoEntryPkgInput, OwnRoutinesReadSharedSlice )  // NOLINT
+{
+    {
+        // Buffers are not sliceable.
+        pkg_input_t input{};
+        input.append( make_buffer( 10, 'a' ) );
+        EXPECT_FALSE( input.read_shared_slice( 5 ) );
+        EXPECT_EQ( input.size(), 10 );
+    }
+
+    pkg_input_t< opio::net::shared_buffer_t > input{};
+    opio::net::shared_buffer_t buf1{ "0123456789", 10 };
+    const auto * data = buf1.data();
+    input.append( std::move( buf1 ) );
+    input.append( opio::net::shared_buffer_t{ "abcdefghij", 10 } );
+
+    auto slice = input.read_shared_slice( 4 );
+    ASSERT_TRUE( slice );
+    EXPECT_EQ( slice->data(), data );
+    EXPECT_EQ( slice->make_string_view(), "0123" );
+    EXPECT_EQ( input.size(), 16 );
+
+    // Spans two buffers: nothing is consumed.
+    EXPECT_FALSE( input.read_shared_slice( 7 ) );
+    EXPECT_EQ( input.size(), 16 );
+
+    // Consumes the first buffer entirely.
+    auto slice2 = input.read_shared_slice( 6 );
+    ASSERT_TRUE( slice2 );
+    EXPECT_EQ( slice2->data(), data + 4 );
+    EXPECT_EQ( slice2->make_string_view(), "456789" );
+    EXPECT_EQ( input.size(), 10 );
+
+    char dest[ 10 ];
+    input.read_buffer( dest, sizeof( dest ) );
+    EXPECT_EQ( std::string_view( dest, sizeof( dest ) ), "abcdefghij" );
+
+    // Slices keep the data of consumed buffer.
+    EXPECT_EQ( slice->make_string_view(), "0123" );
+}
+
 TEST( OpioProtoEntryPkgInput, ZCBufNext )  // NOLINT
 {
     {
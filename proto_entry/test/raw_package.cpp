@@ -0,0 +1,129 @@
+#include <opio/proto_entry/entry_base.hpp>
+
+#include <gtest/gtest.h>
+
+#include "utest.pb.h"
+
+namespace /* anonymous */
+{
+
+using namespace opio::proto_entry;  // NOLINT
+
+namespace proto = opio::proto_entry::utest;
+
+struct fake_entry_t
+{
+};
+
+// Takes XxxRequest unparsed and all the rest as messages.
+struct raw_consumer_t
+{
+    template < typename Entry >
+    void on_raw_package( const pkg_header_t & header,
+                         raw_package_t< proto::XxxRequest > pkg,
+                         [[maybe_unused]] Entry & e )
+    {
+        content_size = header.content_size;
+        raw_pkg.emplace( std::move( pkg ) );
+    }
+
+    template < typename Message_Carrier, typename Entry >
+    void on_message( [[maybe_unused]] Message_Carrier msg,
+                     [[maybe_unused]] Entry & e )
+    {
+    }
+
+    std::uint32_t content_size{};
+    std::optional< raw_package_t< proto::XxxRequest > > raw_pkg;
+};
+
+struct parsed_only_consumer_t
+{
+    template < typename Message_Carrier, typename Entry >
+    void on_message( [[maybe_unused]] Message_Carrier msg,
+                     [[maybe_unused]] Entry & e )
+    {
+    }
+};
+
+TEST( OpioProtoEntryRawPackage, Parse )  // NOLINT
+{
+    proto::XxxRequest msg;
+    msg.set_req_id( 42 );
+    const auto data = msg.SerializeAsString();
+
+    opio::net::shared_buffer_t input{ data.data(), data.size() };
+
+    raw_package_t< proto::XxxRequest > pkg{ input.make_slice( 0, data.size() ) };
+    EXPECT_EQ( pkg.content().data(), input.data() );
+    EXPECT_TRUE( pkg.attached_buffer().empty() );
+
+    const auto parsed = pkg.parse();
+    ASSERT_TRUE( parsed );
+    EXPECT_EQ( parsed->req_id(), 42 );
+
+    proto::XxxRequest parsed_to;
+    ASSERT_TRUE( pkg.parse_to( parsed_to ) );
+    EXPECT_EQ( parsed_to.req_id(), 42 );
+
+    // Truncated content.
+    raw_package_t< proto::XxxRequest > truncated{ input.make_slice( 0, 1 ) };
+    EXPECT_FALSE( truncated.parse() );
+}
+
+TEST( OpioProtoEntryRawPackage, CallbackSupport )  // NOLINT
+{
+    using details::on_raw_package_callback_support_v;
+
+    EXPECT_TRUE( ( on_raw_package_callback_support_v< raw_consumer_t,
+                                                      proto::XxxRequest,
+                                                      fake_entry_t > ) );
+    EXPECT_FALSE( ( on_raw_package_callback_support_v< raw_consumer_t,
+                                                       proto::YyyRequest,
+                                                       fake_entry_t > ) );
+    EXPECT_FALSE( ( on_raw_package_callback_support_v< parsed_only_consumer_t,
+                                                       proto::XxxRequest,
+                                                       fake_entry_t > ) );
+
+    // Pointer-like consumers.
+    EXPECT_TRUE( ( on_raw_package_callback_support_v< raw_consumer_t *,
+                                                      proto::XxxRequest,
+                                                      fake_entry_t > ) );
+    EXPECT_TRUE(
+        ( on_raw_package_callback_support_v< std::unique_ptr< raw_consumer_t >,
+                                             proto::XxxRequest,
+                                             fake_entry_t > ) );
+    EXPECT_TRUE(
+        ( on_raw_package_callback_support_v< std::shared_ptr< raw_consumer_t >,
+                                             proto::XxxRequest,
+                                             fake_entry_t > ) );
+    EXPECT_TRUE(
+        ( on_raw_package_callback_support_v< std::weak_ptr< raw_consumer_t >,
+                                             proto::XxxRequest,
+                                             fake_entry_t > ) );
+}
+
+TEST( OpioProtoEntryRawPackage, ConsumeRawPackage )  // NOLINT
+{
+    opio::net::shared_buffer_t input{ "0123456789", 10 };
+
+    auto consumer = std::make_unique< raw_consumer_t >();
+    fake_entry_t entry;
+
+    details::consume_raw_package(
+        consumer,
+        pkg_header_t::make( pkg_content_message, 0, 6, 4 ),
+        raw_package_t< proto::XxxRequest >{ input.make_slice( 0, 6 ),
+                                            input.make_slice( 6, 4 ) },
+        entry );
+
+    EXPECT_EQ( consumer->content_size, 6 );
+    ASSERT_TRUE( consumer->raw_pkg );
+    EXPECT_EQ( consumer->raw_pkg->content().make_string_view(), "012345" );
+    EXPECT_EQ( consumer->raw_pkg->attached_buffer().make_string_view(), "6789" );
+
+    // The consumer keeps the input.
+    EXPECT_EQ( input.use_count(), 3 );
+}
+
+}  // anonymous namespace